@@ -30,14 +30,9 @@ void Audio_Level_Vis::init() {
     }
     
 
-    //compute the uint16_t decay parameter from the desired time constant
-    //do this by first computing $e^-1$ --> corresponds to decay after a single time constant
-    //from here, figure out the amount of incremental decay for this level of decay to happen after the specified time constant
-    //then convert that number into a Q0.32 fixed-point format
-    double time_constant_decay_ratio = exp((double)-1.0);
-    double tau_decay_samples = (double)App_Constants::LEVEL_VIS_DECAY_TIME_CONSTANT_SEC * (double)App_Constants::AUDIO_SAMPLE_RATE_HZ;
-    double decay_per_sample = pow(time_constant_decay_ratio, (double)1.0/tau_decay_samples);
-    peak_decay = (int32_t)((double)(std::numeric_limits<int32_t>::max() + 1.0) * decay_per_sample);
+    //compute the Q1.31 decay parameter from the desired time constant
+    //i.e. the amount of incremental decay per sample such that we decay to 1/e after the specified time constant
+    peak_decay = compute_decay_q31(App_Constants::LEVEL_VIS_DECAY_TIME_CONSTANT_SEC, App_Constants::AUDIO_SAMPLE_RATE_HZ);
 }
 
 void Audio_Level_Vis::update(const Audio_Block_t& block_in) {
@@ -54,11 +49,8 @@ void Audio_Level_Vis::update(const Audio_Block_t& block_in) {
         if(sample_magnitude > peak_memory) peak_memory = sample_magnitude;
 
         //decay our peak memory by a single step
-        //`peak_decay` is in a fixed-point decimal Q1.31 format --> 32-bit multiply + 32-bit shift is exactly what we need 
-        //use a DSP instruction; may be faster, IDK
-        //have to perform an additional left shift since we're only using 31 decimal spaces instead of 32
-        //not sure why there isn't an arm instruction like this for unsigned integers but pop off
-        peak_memory = multiply_32x32_rshift32(peak_memory, peak_decay) << 1;
+        //`peak_decay` is in a fixed-point decimal Q1.31 format
+        peak_memory = apply_decay_q31(peak_memory, peak_decay);
     }
 
     //at the end of our sample process, write the LEDs with the appropriate output state given the peak values
@@ -22,6 +22,7 @@
 
 #include <config.h>
 #include <dspinst.h> //for SIMD instruction for speed and such
+#include <effect_dsp/dsp_helpers.h> //for fixed-point exponential decay
 
 class Audio_Level_Vis {
 public:
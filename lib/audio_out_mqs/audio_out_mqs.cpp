@@ -9,6 +9,7 @@ DMAChannel Audio_Out_MQS::mqs_dma(false); //don't allocate just yet
 DMAMEM __attribute__((aligned(32))) Audio_Out_MQS::Audio_Out_DMA_Mem Audio_Out_MQS::dma_memory;
 Context_Callback_Function<void> Audio_Out_MQS::user_cb; //user callback function on DMA half-completion
 bool Audio_Out_MQS::dma_mem_write_to_fronthalf = false; //which half of the DMA mem to write to
+volatile bool Audio_Out_MQS::muted = false; //start unmuted
 
 //=========================== PUBLIC MEMBER FUNCTIONS ======================
 
@@ -64,7 +65,12 @@ void Audio_Out_MQS::update(const Audio_Block_t& block_in) {
 	//just copy over the block into the correct half of the buffer
 	//using copy function from standard library to achieve this -- should get efficiently compliled
 	//type conversion from int16_t to int32_t should be implicit too and handled as efficiently as possible I think
-	if(dma_mem_write_to_fronthalf)
+	//write zeros instead if we're muted
+	if(muted) {
+		if(dma_mem_write_to_fronthalf) dma_memory.half_buffers.fronthalf.fill(0);
+		else dma_memory.half_buffers.backhalf.fill(0);
+	}
+	else if(dma_mem_write_to_fronthalf)
 		std::copy(block_in.begin(), block_in.end(), dma_memory.half_buffers.fronthalf.begin());
 	else
 		std::copy(block_in.begin(), block_in.end(), dma_memory.half_buffers.backhalf.begin());
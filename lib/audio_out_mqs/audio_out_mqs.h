@@ -68,6 +68,10 @@ public:
     static void pause_interrupt();
     static void resume_interrupt();
 
+    //silence the output (e.g. while tuning); the effect chain still runs as usual
+    static inline void set_mute(bool mute) { muted = mute; }
+    static inline bool get_mute() { return muted; }
+
 
 private:
     //function that gets called when DMA transfers are half-complete / complete
@@ -91,6 +95,9 @@ private:
     static DMAMEM __attribute__((aligned(32))) Audio_Out_DMA_Mem dma_memory;
     static bool dma_mem_write_to_fronthalf; //and a flag that directs which part of the DMA buffer to write to
 
+    //when set, write silence instead of the block we're handed
+    static volatile bool muted;
+
     //and own a callback function that gets called when the DMA requests are half-complete, i.e. we need more data to process
     //making this a Context_Callback_Function to allow this to easily hook up to an instance of a particular class
     static Context_Callback_Function<void> user_cb;
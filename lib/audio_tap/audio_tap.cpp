@@ -0,0 +1,155 @@
+#include <audio_tap.h>
+
+//======================== STATIC VARIABLE DEFINITION =====================
+
+volatile bool Audio_Tap::tuner_feed_enabled = false;
+Biquad_Cascade Audio_Tap::tuner_aa_filter(2);
+Audio_Tap::Tuner_Ring_t Audio_Tap::tuner_ring;
+volatile bool Audio_Tap::spectrum_feed_enabled = false;
+volatile size_t Audio_Tap::spectrum_tap_point = Audio_Tap::TAP_OUTPUT;
+Audio_Tap::Spectrum_Ring_t Audio_Tap::spectrum_ring;
+volatile uint8_t Audio_Tap::scope_state = Audio_Tap::SCOPE_IDLE;
+size_t Audio_Tap::scope_tap_point = Audio_Tap::TAP_OUTPUT;
+int32_t Audio_Tap::scope_trigger_level = 0;
+bool Audio_Tap::scope_auto_trigger = true;
+bool Audio_Tap::scope_below_level = false;
+bool Audio_Tap::scope_triggered = false;
+uint32_t Audio_Tap::scope_wait_blocks = 0;
+size_t Audio_Tap::scope_fill = 0;
+Audio_Tap::Scope_Buffer_t Audio_Tap::scope_buffer = {0};
+volatile bool Audio_Tap::capture_enabled = false;
+volatile size_t Audio_Tap::capture_tap_point = Audio_Tap::TAP_OUTPUT;
+uint32_t Audio_Tap::capture_sequence = 0;
+Audio_Tap::Capture_Ring_t Audio_Tap::capture_ring;
+
+//================================= PUBLIC FUNCTIONS =============================
+
+//design the tuner's anti-aliasing filter
+//4th order Butterworth (two sections at the Butterworth Qs), corner at 2/3 of the decimated Nyquist frequency
+void Audio_Tap::init() {
+    const float corner_hz = TUNER_SAMPLE_RATE_HZ / 3.0f;
+    Biquad_Cascade::Coeff_Set_t& coeffs = tuner_aa_filter.get_staging_coeffs();
+    coeffs[0] = Biquad_Cascade::design_lowpass(corner_hz, 0.5412f);
+    coeffs[1] = Biquad_Cascade::design_lowpass(corner_hz, 1.3066f);
+    tuner_aa_filter.publish_coeffs();
+}
+
+//################# RUNS IN THE AUDIO UPDATE ###################
+
+void Audio_Tap::update(const Chain_Buffers_t& chain_buffers) {
+    //tuner --> filter the input, keep every `TUNER_DECIMATION`th sample
+    if(tuner_feed_enabled) {
+        static Audio_Block_t filtered;
+        static std::array<int16_t, App_Constants::PROCESSING_BLOCK_SIZE / App_Constants::TUNER_DECIMATION> decimated;
+
+        tuner_aa_filter.process(chain_buffers[0], filtered);
+        for(size_t i = 0; i < decimated.size(); i++)
+            decimated[i] = filtered[i * App_Constants::TUNER_DECIMATION];
+        tuner_ring.push(decimated.data(), decimated.size());
+    }
+
+    //spectrum --> straight copy of the selected buffer
+    if(spectrum_feed_enabled)
+        spectrum_ring.push(chain_buffers[spectrum_tap_point].data(), App_Constants::PROCESSING_BLOCK_SIZE);
+
+    //scope --> only does anything between being armed and filling up
+    if(scope_state == SCOPE_ARMED || scope_state == SCOPE_CAPTURING)
+        update_scope(chain_buffers);
+
+    //capture --> tag the block and push it whole; if the ring's full it just gets dropped (the sequence number still counts it)
+    if(capture_enabled) {
+        static Capture_Block_t block;
+        block.sequence = capture_sequence++;
+        block.tap_point = capture_tap_point;
+        block.samples = chain_buffers[capture_tap_point];
+        capture_ring.push(&block, 1);
+    }
+}
+
+void Audio_Tap::update_scope(const Chain_Buffers_t& chain_buffers) {
+    const Audio_Block_t& block = chain_buffers[scope_tap_point];
+    size_t start = 0;
+
+    //look for a rising edge through the trigger level
+    //signal has to have been under the level (by the hysteresis) first, so noise riding on the level doesn't retrigger
+    if(scope_state == SCOPE_ARMED) {
+        start = block.size();
+        for(size_t i = 0; i < block.size(); i++) {
+            if(!scope_below_level) {
+                if(block[i] < scope_trigger_level - App_Constants::SCOPE_TRIGGER_HYSTERESIS) scope_below_level = true;
+            }
+            else if(block[i] >= scope_trigger_level) {
+                start = i;
+                scope_triggered = true;
+                break;
+            }
+        }
+
+        //nothing yet --> keep waiting, unless we've waited long enough to just start capturing
+        if(start == block.size()) {
+            if(!scope_auto_trigger || ++scope_wait_blocks < SCOPE_AUTO_TRIGGER_BLOCKS) return;
+            start = 0;
+        }
+        scope_state = SCOPE_CAPTURING;
+    }
+
+    //copy as much as fits, hand the buffer over once it's full
+    size_t count = min(block.size() - start, scope_buffer.size() - scope_fill);
+    std::copy(block.begin() + start, block.begin() + start + count, scope_buffer.begin() + scope_fill);
+    scope_fill += count;
+    if(scope_fill == scope_buffer.size()) {
+        std::atomic_signal_fence(std::memory_order_release);
+        scope_state = SCOPE_DONE;
+    }
+}
+
+//################# end RUNS IN THE AUDIO UPDATE ###################
+
+//audio update doesn't touch the filter or the ring while the feed is off
+//so it's safe to reset them before turning the feed back on
+void Audio_Tap::enable_tuner_feed(bool enable) {
+    if(enable && !tuner_feed_enabled) {
+        tuner_aa_filter.reset();
+        tuner_ring.clear();
+    }
+    tuner_feed_enabled = enable;
+}
+
+//same deal as the tuner; the tap point can be changed on the fly, the consumer just sees a seam in the samples
+void Audio_Tap::enable_spectrum_feed(bool enable, size_t tap_point) {
+    spectrum_tap_point = min(tap_point, TAP_OUTPUT);
+    if(enable && !spectrum_feed_enabled) spectrum_ring.clear();
+    spectrum_feed_enabled = enable;
+}
+
+//same deal as the other feeds; sequence numbers restart so the far end sees a fresh stream
+void Audio_Tap::enable_capture_feed(bool enable, size_t tap_point) {
+    capture_tap_point = min(tap_point, TAP_OUTPUT);
+    if(enable && !capture_enabled) {
+        capture_sequence = 0;
+        capture_ring.clear();
+    }
+    capture_enabled = enable;
+}
+
+//park the state machine first so the audio update doesn't see a half-written configuration
+//audio update preempts `loop()`, so once the state is idle it's guaranteed to stay out of the way
+void Audio_Tap::arm_scope(size_t tap_point, int16_t trigger_level, bool auto_trigger) {
+    scope_state = SCOPE_IDLE;
+    std::atomic_signal_fence(std::memory_order_seq_cst);
+
+    scope_tap_point = min(tap_point, TAP_OUTPUT);
+    scope_trigger_level = trigger_level;
+    scope_auto_trigger = auto_trigger;
+    scope_below_level = false;
+    scope_triggered = false;
+    scope_wait_blocks = 0;
+    scope_fill = 0;
+
+    std::atomic_signal_fence(std::memory_order_release);
+    scope_state = SCOPE_ARMED;
+}
+
+void Audio_Tap::disarm_scope() {
+    scope_state = SCOPE_IDLE;
+}
@@ -0,0 +1,131 @@
+#pragma once
+
+/*
+ * Hub for getting audio out of the audio update and into code running in `loop()`
+ * The audio update hands over every buffer in the effect chain once per block; this class copies what consumers have asked for
+ *      \--> nothing gets processed here beyond copying/decimating, all the analysis runs in the consumer
+ *      \--> feeds are off by default, so the audio update only pays for the feeds a page actually has open
+ *
+ * Feeds:
+ *      \--> tuner: input decimated by `TUNER_DECIMATION` (4th order Butterworth anti-aliasing filter first), into a lock-free ring
+ *      \--> spectrum: full-rate copy of any point in the chain (input, after any slot, or the final output), into a lock-free ring
+ *      \--> scope: one-shot triggered capture from any point in the chain into a preallocated buffer
+ *              \--> armed from `loop()`, then the audio update waits for a rising edge through the trigger level and fills the buffer
+ *              \--> once it's full the audio update leaves it alone until it's re-armed, so the consumer can read it without locking
+ *      \--> capture: whole blocks from any point in the chain, tagged with a sequence number, into a lock-free ring (for streaming to a host)
+ *              \--> blocks that don't fit are dropped but still use up a sequence number, so the far end can tell what went missing
+ *
+ * Intention is to use this class statically, i.e. don't instantiate it
+ */
+
+#include <array>
+#include <Arduino.h>
+
+#include <config.h> //for audio block type, chain length, and tap configuration
+#include <sample_ring.h> //lock-free handoff to `loop()`
+#include <effect_dsp/biquad_cascade.h> //anti-aliasing filter for decimated feeds
+
+class Audio_Tap {
+public:
+    //prevent all flavors of making an instance of one of these
+    Audio_Tap() = delete;
+    Audio_Tap(const Audio_Tap& other) = delete;
+    void operator=(const Audio_Tap& other) = delete;
+
+    //every buffer the audio update runs through: the input, then the output of every effect slot (last is the final output)
+    typedef std::array<Audio_Block_t, App_Constants::NUM_EFFECTS + 1> Chain_Buffers_t;
+
+    //decimated feed for the tuner
+    static constexpr uint32_t TUNER_SAMPLE_RATE_HZ = App_Constants::AUDIO_SAMPLE_RATE_HZ / App_Constants::TUNER_DECIMATION;
+    typedef Sample_Ring<App_Constants::TUNER_RING_SIZE> Tuner_Ring_t;
+    static_assert(App_Constants::PROCESSING_BLOCK_SIZE % App_Constants::TUNER_DECIMATION == 0, "Tuner decimation must divide the block size!");
+
+    //full-rate feed for the spectrum analyzer
+    typedef Sample_Ring<App_Constants::SPECTRUM_RING_SIZE> Spectrum_Ring_t;
+
+    //indices into the chain buffers for the ends of the chain
+    static constexpr size_t TAP_INPUT = 0;
+    static constexpr size_t TAP_OUTPUT = App_Constants::NUM_EFFECTS;
+
+    //triggered capture for the scope
+    typedef std::array<int16_t, App_Constants::SCOPE_CAPTURE_SIZE> Scope_Buffer_t;
+    static constexpr uint32_t SCOPE_AUTO_TRIGGER_BLOCKS = App_Constants::SCOPE_AUTO_TRIGGER_MS * App_Constants::AUDIO_SAMPLE_RATE_HZ
+                                                            / (1000 * App_Constants::PROCESSING_BLOCK_SIZE);
+
+    //tagged blocks for streaming out
+    struct Capture_Block_t {
+        uint32_t sequence;
+        uint8_t tap_point;
+        Audio_Block_t samples;
+    };
+    typedef Sample_Ring<App_Constants::CAPTURE_RING_BLOCKS, Capture_Block_t> Capture_Ring_t;
+
+    //set up the anti-aliasing filters
+    static void init();
+
+    //copy out whatever the consumers want; call this from the audio update once the chain has run
+    static void update(const Chain_Buffers_t& chain_buffers);
+
+    //start/stop feeding the tuner ring; starting clears out anything stale
+    static void enable_tuner_feed(bool enable);
+    static inline Tuner_Ring_t& get_tuner_ring() { return tuner_ring; }
+
+    //start/stop feeding the spectrum ring from the buffer at `tap_point` in the chain; starting clears out anything stale
+    static void enable_spectrum_feed(bool enable, size_t tap_point = TAP_OUTPUT);
+    static inline Spectrum_Ring_t& get_spectrum_ring() { return spectrum_ring; }
+
+    //start a scope capture from the buffer at `tap_point`, triggering when the signal rises through `trigger_level`
+    //with `auto_trigger` set, capture starts anyway if nothing triggers within `SCOPE_AUTO_TRIGGER_MS` (so a quiet signal still shows up)
+    //re-arming throws away whatever capture was in progress
+    static void arm_scope(size_t tap_point, int16_t trigger_level, bool auto_trigger);
+    static void disarm_scope();
+
+    //once this returns true, the capture buffer is ours until the next `arm_scope()`
+    static inline bool scope_capture_ready() { return scope_state == SCOPE_DONE; }
+    static inline bool scope_capture_triggered() { return scope_triggered; } //false if the capture was started by the auto trigger
+    static inline const Scope_Buffer_t& get_scope_capture() { return scope_buffer; }
+
+    //start/stop feeding the capture ring from the buffer at `tap_point`; starting clears out anything stale and restarts the sequence count
+    static void enable_capture_feed(bool enable, size_t tap_point = TAP_OUTPUT);
+    static inline bool capture_feed_enabled() { return capture_enabled; }
+    static inline Capture_Ring_t& get_capture_ring() { return capture_ring; }
+
+private:
+    //anti-aliasing filter + ring for the tuner
+    static volatile bool tuner_feed_enabled;
+    static Biquad_Cascade tuner_aa_filter;
+    static Tuner_Ring_t tuner_ring;
+
+    //where the spectrum feed comes from + its ring
+    static volatile bool spectrum_feed_enabled;
+    static volatile size_t spectrum_tap_point;
+    static Spectrum_Ring_t spectrum_ring;
+
+    //scope capture runs through these states; `loop()` moves it to armed (or idle), the audio update does the rest
+    enum Scope_State : uint8_t {
+        SCOPE_IDLE = 0,
+        SCOPE_ARMED,
+        SCOPE_CAPTURING,
+        SCOPE_DONE
+    };
+    static volatile uint8_t scope_state;
+
+    //scope capture configuration and progress; only touched by the audio update while armed or capturing
+    static size_t scope_tap_point;
+    static int32_t scope_trigger_level;
+    static bool scope_auto_trigger;
+    static bool scope_below_level; //signal has to dip under the trigger level (minus some hysteresis) before it can trigger
+    static bool scope_triggered;
+    static uint32_t scope_wait_blocks;
+    static size_t scope_fill;
+    static Scope_Buffer_t scope_buffer;
+
+    //where the capture feed comes from, the next sequence number, and its ring
+    static volatile bool capture_enabled;
+    static volatile size_t capture_tap_point;
+    static uint32_t capture_sequence;
+    static Capture_Ring_t capture_ring;
+
+    //wait for the trigger/fill the scope capture
+    static void update_scope(const Chain_Buffers_t& chain_buffers);
+};
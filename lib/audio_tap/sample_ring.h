@@ -0,0 +1,79 @@
+#pragma once
+
+/*
+ * Single-producer, single-consumer ring buffer of audio samples (or anything else that's cheap to copy, e.g. whole blocks)
+ * Used to hand audio from the audio update (producer, interrupt context) to code running in `loop()` (consumer)
+ *
+ * Lock-free:
+ *      \--> only the producer writes `head`, only the consumer writes `tail`; both are free-running counters
+ *      \--> sample data is written before `head` is published, and read before `tail` is published
+ *      \--> the producer never blocks; if the consumer falls behind, whatever doesn't fit is dropped
+ *
+ * Both sides run on the same core, so signal fences (compiler barriers) are enough to keep the ordering
+ * Capacity needs to be a power of two so the counters can wrap freely
+ */
+
+#include <array>
+#include <atomic> //for signal fences
+#include <Arduino.h>
+
+template<size_t CAPACITY, typename T = int16_t>
+class Sample_Ring {
+public:
+    static_assert((CAPACITY & (CAPACITY - 1)) == 0, "Sample ring capacity must be a power of two!");
+
+    //=============== PRODUCER SIDE ===============
+
+    //copy in as many samples as will fit, returns how many were written
+    size_t push(const T* samples, size_t count) {
+        uint32_t h = head;
+        size_t space = CAPACITY - (size_t)(h - tail);
+        if(count > space) count = space;
+
+        for(size_t i = 0; i < count; i++)
+            buffer[(h + i) & (CAPACITY - 1)] = samples[i];
+
+        //publish the samples only after they've been written
+        std::atomic_signal_fence(std::memory_order_release);
+        head = h + count;
+        return count;
+    }
+
+    //=============== CONSUMER SIDE ===============
+
+    //how many samples are waiting to be read
+    size_t available() const { return (size_t)(head - tail); }
+
+    //copy out up to `count` samples, returns how many were read
+    size_t pop(T* dest, size_t count) {
+        uint32_t t = tail;
+        size_t ready = (size_t)(head - t);
+        std::atomic_signal_fence(std::memory_order_acquire);
+        if(count > ready) count = ready;
+
+        for(size_t i = 0; i < count; i++)
+            dest[i] = buffer[(t + i) & (CAPACITY - 1)];
+
+        //hand the space back only after we're done reading it
+        std::atomic_signal_fence(std::memory_order_release);
+        tail = t + count;
+        return count;
+    }
+
+    //skip over up to `count` samples without reading them, returns how many were skipped
+    size_t discard(size_t count) {
+        uint32_t t = tail;
+        size_t ready = (size_t)(head - t);
+        if(count > ready) count = ready;
+        tail = t + count;
+        return count;
+    }
+
+    //throw away everything waiting to be read
+    void clear() { tail = head; }
+
+private:
+    std::array<T, CAPACITY> buffer = {};
+    volatile uint32_t head = 0;
+    volatile uint32_t tail = 0;
+};
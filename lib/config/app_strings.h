@@ -0,0 +1,150 @@
+#pragma once
+
+/*
+ * All the fixed text in the UI: effect names, parameter labels and choices, edit page headers, menu text
+ * Same deal as `App_Constants`, just for strings
+ *      \--> every entry is an `App_String` made from a literal at compile time, so the text lives once in flash
+ *      \--> effects, parameters and menus hold and pass these handles around instead of copying `std::string`s
+ *      \--> handles to the same entry compare by pointer (e.g. matching an active effect's name against the list of available ones)
+ *
+ * Text that's built at runtime (e.g. names of cabinets loaded off the SD card) still needs somewhere to live,
+ * but can be handed around the same way once it's made
+ */
+
+#include <array>
+
+#include <utils.h> //for the string handle
+#include <config.h> //for the number of effect channels
+
+namespace App_Strings {
+    //=========================== EFFECT NAMES ===========================
+    constexpr App_String EFFECT_DEFAULT = "Default Name";
+    constexpr App_String EFFECT_PASSTHROUGH = "Default Passthrough";
+    constexpr App_String EFFECT_TEST_PARAMS = "Passthrough Param";
+    constexpr App_String EFFECT_IIR_LP = "IIR Low-pass";
+    constexpr App_String EFFECT_IIR_HP = "IIR High-pass";
+    constexpr App_String EFFECT_VOL_FIXED_POINT = "Fixed Pt. Vol";
+    constexpr App_String EFFECT_VOL_FLOAT_POINT = "Float Pt. Vol";
+    constexpr App_String EFFECT_CAB_FENDER_TWIN = "Fender Twin Reverb";
+    constexpr App_String EFFECT_CAB_SD = "SD Cabinet";
+    constexpr App_String EFFECT_NOISE_GATE = "Noise Gate";
+    constexpr App_String EFFECT_COMPRESSOR = "Compressor";
+    constexpr App_String EFFECT_OVERDRIVE = "Overdrive";
+    constexpr App_String EFFECT_PARAMETRIC_EQ = "Parametric EQ";
+    constexpr App_String EFFECT_CHORUS = "Chorus";
+    constexpr App_String EFFECT_FLANGER = "Flanger";
+    constexpr App_String EFFECT_VIBRATO = "Vibrato";
+    constexpr App_String EFFECT_DELAY = "Delay";
+    constexpr App_String EFFECT_REVERB = "Reverb";
+
+    //====================== EFFECT EDIT PAGE HEADERS ======================
+    constexpr App_String EDIT_TEST_PARAMS = "Edit Dummy Params";
+    constexpr App_String EDIT_CUTOFF = "Edit Cutoff Freq";
+    constexpr App_String EDIT_VOLUME = "Edit Volume";
+    constexpr App_String EDIT_CAB_SD = "Select Cabinet";
+    constexpr App_String EDIT_NOISE_GATE = "Edit Noise Gate";
+    constexpr App_String EDIT_COMPRESSOR = "Edit Compressor";
+    constexpr App_String EDIT_OVERDRIVE = "Edit Overdrive";
+    constexpr App_String EDIT_PARAMETRIC_EQ = "Edit EQ Bands";
+    constexpr App_String EDIT_CHORUS = "Edit Chorus";
+    constexpr App_String EDIT_FLANGER = "Edit Flanger";
+    constexpr App_String EDIT_VIBRATO = "Edit Vibrato";
+    constexpr App_String EDIT_DELAY = "Edit Delay";
+    constexpr App_String EDIT_REVERB = "Edit Reverb";
+
+    //for effects without anything to edit
+    constexpr App_String NO_PARAMS_DIVIDER = "======";
+    constexpr App_String NO_PARAMS_LINE_1 = "This Effect Has No";
+    constexpr App_String NO_PARAMS_LINE_2 = "Editable Parameters";
+
+    //========================= PARAMETER LABELS =========================
+    //these get drawn under a narrow column, so keep them short
+    constexpr App_String LABEL_LIN = "Lin";
+    constexpr App_String LABEL_LOG = "Log";
+    constexpr App_String LABEL_SEL = "Sel";
+    constexpr App_String LABEL_CUTOFF = "Cutoff";
+    constexpr App_String LABEL_VOLUME = "Volume";
+    constexpr App_String LABEL_CAB = "Cab";
+    constexpr App_String LABEL_THRESHOLD = "Thresh";
+    constexpr App_String LABEL_HYSTERESIS = "Hyst";
+    constexpr App_String LABEL_RATIO = "Ratio";
+    constexpr App_String LABEL_KNEE = "Knee";
+    constexpr App_String LABEL_ATTACK = "Attack";
+    constexpr App_String LABEL_HOLD = "Hold";
+    constexpr App_String LABEL_RELEASE = "Release";
+    constexpr App_String LABEL_DRIVE = "Drive";
+    constexpr App_String LABEL_CURVE = "Curve";
+    constexpr App_String LABEL_LOW = "Low";
+    constexpr App_String LABEL_LO_MID = "Lo-Mid";
+    constexpr App_String LABEL_HI_MID = "Hi-Mid";
+    constexpr App_String LABEL_HIGH = "High";
+    constexpr App_String LABEL_RATE = "Rate";
+    constexpr App_String LABEL_DEPTH = "Depth";
+    constexpr App_String LABEL_FEEDBACK = "Fdbk";
+    constexpr App_String LABEL_MIX = "Mix";
+    constexpr App_String LABEL_TIME = "Time";
+    constexpr App_String LABEL_SIZE = "Size";
+    constexpr App_String LABEL_DECAY = "Decay";
+    constexpr App_String LABEL_DAMPING = "Damp";
+
+    //======================== PARAMETER UNITS ========================
+    //suffixes drawn right after a numerical parameter's value
+    constexpr App_String UNITS_DB = "dB";
+    constexpr App_String UNITS_MS = "ms";
+    constexpr App_String UNITS_S = "s";
+    constexpr App_String UNITS_HZ = "Hz";
+    constexpr App_String UNITS_PERCENT = "%";
+    constexpr App_String UNITS_RATIO = ":1";
+
+    //======================== PARAMETER CHOICES ========================
+    //waveshaper curves, same order as `Waveshaper::Curve`
+    constexpr App_String CURVE_DIODE = "Diode";
+    constexpr App_String CURVE_TUBE = "Tube";
+    constexpr App_String CURVE_HARD_CLIP = "Hard Clip";
+    constexpr App_String CURVE_FOLDBACK = "Foldback";
+
+    //selection for the dummy parameter effect
+    constexpr App_String TEST_TYPE_1 = "Type 1";
+    constexpr App_String TEST_TYPE_2 = "Type 2";
+    constexpr App_String TEST_TYPE_3 = "Type 3";
+    constexpr App_String TEST_TYPE_4 = "Type 4";
+    constexpr App_String TEST_TYPE_5 = "Type 5";
+
+    //stands in for the cabinet list when nothing loaded off the SD card
+    constexpr App_String NO_SD_CABS = "No SD Cabs";
+
+    //============================ MENUS ============================
+    constexpr App_String MENU_BACK = "<< Back";
+    constexpr App_String MENU_SETTINGS = "Settings";
+    constexpr App_String MENU_ACTIVE_EFFECTS = "Active Effects:";
+    constexpr App_String MENU_TUNER = "Tuner";
+    constexpr App_String MENU_SPECTRUM = "Spectrum Analyzer";
+    constexpr App_String MENU_SCOPE = "Oscilloscope";
+    constexpr App_String MENU_DUMMY_SETTING = "Dummy Setting 4 - Sample Text";
+
+    //one per effect channel: header of the page that picks its effect, and the main screen text while it's selected
+    constexpr std::array<App_String, 4> CHOOSE_EFFECT_HEADERS = {
+        "Choose Effect 1", "Choose Effect 2", "Choose Effect 3", "Choose Effect 4"
+    };
+    constexpr std::array<App_String, 4> CHANNEL_CHOOSE_EFFECT = {
+        "Channel [1] - Choose Effect", "Channel [2] - Choose Effect", "Channel [3] - Choose Effect", "Channel [4] - Choose Effect"
+    };
+    static_assert(CHOOSE_EFFECT_HEADERS.size() == App_Constants::NUM_EFFECTS, "Need a choose effect header for every effect channel!");
+    static_assert(CHANNEL_CHOOSE_EFFECT.size() == App_Constants::NUM_EFFECTS, "Need a main screen prompt for every effect channel!");
+
+    //======================== IDLE SCREEN ========================
+    constexpr App_String IDLE_HEADER = "Idle Screen";
+    constexpr std::array<App_String, 6> IDLE_MESSAGE = {
+        "This page reduces noise",
+        "by turning off LEDs",
+        "and halting the screen",
+        "",
+        "Turn/click effect knobs",
+        "to return to home page"
+    };
+
+    //======================== TUNER SCREEN ========================
+    constexpr App_String TUNER_HEADER = "Tuner";
+    constexpr App_String TUNER_MUTE = "MUTE"; //top right while the output is muted
+    constexpr App_String TUNER_NO_PITCH = "--"; //in place of the note name when nothing's detected
+}
@@ -93,6 +93,7 @@ namespace App_Constants {
     constexpr uint8_t MQS_DMA_INT_PRIO = 10;
     constexpr uint8_t AUDIO_BLOCK_PROCESS_PRIO = 20;
     constexpr uint8_t ENC_SAMPLING_PRIO = 30;
+    constexpr uint8_t DISPLAY_DMA_INT_PRIO = 128; //only clears a flag, nothing time critical
 
     //encoder and switch bounce time (seconds)
     //switch algorithm will sample switches at this frequency
@@ -117,6 +118,12 @@ namespace App_Constants {
     // inline const u8g2_cb_t* SCREEN_ROTATION = U8G2_R0;
     constexpr uint8_t DISPLAY_I2C_ADDRESS = 0x78; //8-bit address, 0x3C in 7-bit format
 
+    //display I2C transport (DMA-driven, see `display_i2c.h`)
+    //SH1106 is only rated for 400kHz; enable 1MHz Fast-mode Plus if the panel on hand is happy with it
+    constexpr bool DISPLAY_I2C_FAST_MODE_PLUS = false;
+    constexpr size_t DISPLAY_I2C_QUEUE_WORDS = 1536; //a full frame plus per-transfer overhead fits; bigger submits just go out in pieces
+    constexpr uint32_t DISPLAY_I2C_STUCK_TIMEOUT_US = 15000; //give up on a transfer if a bus line is held low this long
+
     //bright and dim levels for the RGB LEDs
     constexpr float UI_LED_LEVEL_BRIGHT = 1.0f;
     constexpr float UI_LED_LEVEL_DIM = UI_LED_LEVEL_BRIGHT * 0.25;
@@ -153,11 +160,12 @@ namespace App_Constants {
     //how long the quick edit screen should take to timeout 
     constexpr uint32_t QUICK_EDIT_TIMEOUT_MS = 1000;
 
-    //how frequently to redraw the screen for pages that require continuous redrawing
-    constexpr uint32_t SCREEN_REDRAW_MS = 50; //40FPS
+    //how frequently the screen can be redrawn; pages only actually redraw when something's asked for it (`UI_Page::request_redraw()`)
+    //animated pages (scrolling text, meters) redraw at this rate for as long as they're animating
+    constexpr uint32_t SCREEN_REDRAW_MS = 50; //20FPS max
 
     //for the settings screen, we'll increment our fade at the following rate
-    //update happens every `SCREEN_REDRAW_MS`; a value of 1/SCREEN_REDRAW_MS corresponds
+    //update happens every `SCREEN_REDRAW_MS` while selected; a value of 1/SCREEN_REDRAW_MS corresponds
     //to a transition of 1 color per second
     constexpr float SETTINGS_LED_FADE_INC = 0.75f/(float)SCREEN_REDRAW_MS;
 
@@ -169,6 +177,62 @@ namespace App_Constants {
     //idle screen reduces noise by reducing processor I/O activity
     //by turning off all LEDs and halting screen rendering updates
     constexpr uint32_t IDLE_SCREEN_TIMEOUT_MS = 10000;
+
+    //cabinet impulse responses loaded off the SD card at boot
+    //will look for WAV files in this directory, loading at most `MAX_SD_CABS` of them
+    //each impulse response will be truncated to `SD_CAB_MAX_TAPS` after being resampled to the audio sample rate
+    constexpr const char* SD_CAB_DIRECTORY = "/cabs";
+    constexpr size_t MAX_SD_CABS = 16;
+    constexpr size_t SD_CAB_MAX_TAPS = 512;
+
+    //longest delay time the delay effect supports
+    //buffer goes in PSRAM if it's fitted, otherwise fall back to a much shorter buffer in internal RAM
+    constexpr uint32_t DELAY_MAX_TIME_PSRAM_MS = 2000;
+    constexpr uint32_t DELAY_MAX_TIME_RAM_MS = 500;
+
+    //print how many CPU cycles each effect slot takes per audio block over serial (for profiling)
+    //peak cycle counts are reset after every report
+    constexpr bool REPORT_EFFECT_CYCLES = false;
+    constexpr uint32_t EFFECT_CYCLES_REPORT_MS = 1000;
+
+    //print how many bytes the display updates are pushing over I2C over serial (for profiling)
+    //only the tiles that changed get sent, so this shows what each page actually costs
+    constexpr bool REPORT_DISPLAY_TRAFFIC = false;
+    constexpr uint32_t DISPLAY_TRAFFIC_REPORT_MS = 1000;
+
+    //tuner configuration
+    //audio update decimates the input by this much before handing it off; pitch detection runs in `loop()` on the decimated feed
+    //ring holds this many decimated samples, and detection runs at this interval
+    //the output is muted while the tuner is up unless this is turned off (can still be toggled from the tuner page)
+    constexpr size_t TUNER_DECIMATION = 4;
+    constexpr size_t TUNER_RING_SIZE = 2048;
+    constexpr uint32_t TUNER_DETECT_MS = 50;
+    constexpr bool TUNER_MUTE_DEFAULT = true;
+    constexpr float TUNER_REFERENCE_HZ = 440.0f;
+    constexpr float TUNER_IN_TUNE_CENTS = 3.0f;
+
+    //spectrum analyzer configuration
+    //audio update copies full-rate blocks into a ring this big; the page transforms the newest `SPECTRUM_FFT_SIZE` samples every redraw
+    //bars span this frequency range (log spaced), and this many dB below full scale is the bottom of the display
+    constexpr size_t SPECTRUM_RING_SIZE = 2048;
+    constexpr size_t SPECTRUM_FFT_SIZE = 1024;
+    constexpr float SPECTRUM_MIN_HZ = 40.0f;
+    constexpr float SPECTRUM_MAX_HZ = 20000.0f;
+    constexpr float SPECTRUM_RANGE_DB = 72.0f;
+
+    //scope configuration
+    //audio update captures this many samples per trigger (enough for the slowest timebase across the display)
+    //signal has to fall this far under the trigger level before the next rising edge counts
+    //in auto mode, capture starts anyway after waiting this long for a trigger
+    constexpr size_t SCOPE_CAPTURE_SIZE = 1024;
+    constexpr int32_t SCOPE_TRIGGER_HYSTERESIS = 256;
+    constexpr uint32_t SCOPE_AUTO_TRIGGER_MS = 100;
+
+    //USB capture configuration
+    //audio update hands whole blocks to `loop()` through a ring this many blocks deep (32 blocks is ~85ms of slack)
+    //throughput test streams dummy frames as fast as USB will take them for this long
+    constexpr size_t CAPTURE_RING_BLOCKS = 32;
+    constexpr uint32_t CAPTURE_THROUGHPUT_TEST_MS = 2000;
 };
 
 namespace Audio_Clocking_Constants {
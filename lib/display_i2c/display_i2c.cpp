@@ -0,0 +1,207 @@
+#include <display_i2c.h>
+
+//========================= STATIC VARIABLE INITIALIZATION =========================
+
+DMAChannel Display_I2C::i2c_dma(false); //don't allocate just yet
+DMAMEM __attribute__((aligned(32))) std::array<uint32_t, App_Constants::DISPLAY_I2C_QUEUE_WORDS> Display_I2C::queue;
+size_t Display_I2C::queue_len = 0;
+
+bool Display_I2C::initialized = false;
+bool Display_I2C::in_frame = false;
+volatile bool Display_I2C::dma_active = false;
+bool Display_I2C::error_flag = false;
+uint32_t Display_I2C::error_count = 0;
+
+//=========================== PUBLIC MEMBER FUNCTIONS ======================
+
+void Display_I2C::init() {
+    if(initialized) return;
+    initialized = true;
+
+    /*
+     * Peripheral setup, mirroring what the Teensy `Wire` library does for LPI2C1
+     *  \--> run the peripheral off the 24MHz oscillator, and turn its clock on
+     *  \--> pins 18 (SDA) and 19 (SCL) as open drain with pull-ups, routed to LPI2C1
+     */
+    CCM_CSCDR2 = (CCM_CSCDR2 & ~CCM_CSCDR2_LPI2C_CLK_PODF(63)) | CCM_CSCDR2_LPI2C_CLK_SEL;
+    CCM_CCGR2 |= CCM_CCGR2_LPI2C1(CCM_CCGR_ON);
+
+    const uint32_t PAD_CONFIG = IOMUXC_PAD_ODE | IOMUXC_PAD_SRE | IOMUXC_PAD_DSE(4) | IOMUXC_PAD_SPEED(1) |
+                                IOMUXC_PAD_PKE | IOMUXC_PAD_PUE | IOMUXC_PAD_PUS(3);
+    CORE_PIN18_PADCONFIG = PAD_CONFIG;
+    CORE_PIN18_CONFIG = 3 | 0x10; //ALT3 = LPI2C1_SDA, force input path on (SION) so the peripheral can read the line back
+    IOMUXC_LPI2C1_SDA_SELECT_INPUT = 1;
+    CORE_PIN19_PADCONFIG = PAD_CONFIG;
+    CORE_PIN19_CONFIG = 3 | 0x10; //ALT3 = LPI2C1_SCL
+    IOMUXC_LPI2C1_SCL_SELECT_INPUT = 1;
+
+    /*
+     * Bus timing, in 24MHz clock cycles (values from `Wire`'s `setClock()`)
+     * SH1106 is only specified up to 400kHz; plenty of modules run fine at 1MHz Fast-mode Plus, but check on the actual panel
+     * Pin low timeout catches a bus that's stuck low, so a wedged display can't hang the UI
+     */
+    LPI2C1_MCR = LPI2C_MCR_RST;
+    LPI2C1_MCR = 0;
+    if(App_Constants::DISPLAY_I2C_FAST_MODE_PLUS) {
+        LPI2C1_MCCR0 = LPI2C_MCCR0_CLKHI(9) | LPI2C_MCCR0_CLKLO(10) | LPI2C_MCCR0_DATAVD(4) | LPI2C_MCCR0_SETHOLD(7);
+        LPI2C1_MCFGR2 = LPI2C_MCFGR2_FILTSDA(1) | LPI2C_MCFGR2_FILTSCL(1) | LPI2C_MCFGR2_BUSIDLE(2900);
+    }
+    else {
+        LPI2C1_MCCR0 = LPI2C_MCCR0_CLKHI(26) | LPI2C_MCCR0_CLKLO(28) | LPI2C_MCCR0_DATAVD(12) | LPI2C_MCCR0_SETHOLD(18);
+        LPI2C1_MCFGR2 = LPI2C_MCFGR2_FILTSDA(2) | LPI2C_MCFGR2_FILTSCL(2) | LPI2C_MCFGR2_BUSIDLE(3600);
+    }
+    LPI2C1_MCCR1 = LPI2C1_MCCR0;
+    LPI2C1_MCFGR0 = 0;
+    LPI2C1_MCFGR1 = LPI2C_MCFGR1_PRESCALE(0);
+    LPI2C1_MCFGR3 = LPI2C_MCFGR3_PINLOW(App_Constants::DISPLAY_I2C_STUCK_TIMEOUT_US * 24 / 256 + 1);
+
+    //ask for more words whenever the transmit FIFO has room for a couple
+    LPI2C1_MFCR = LPI2C_MFCR_TXWATER(1) | LPI2C_MFCR_RXWATER(1);
+    LPI2C1_MCR = LPI2C_MCR_MEN;
+
+    /*
+     * DMA setup
+     *  \--> source gets pointed at the queue every time we send
+     *  \--> destination is the master transmit data register; each 32-bit word is a command + data byte
+     *  \--> run when LPI2C1 asks for more data; stop and interrupt once the whole queue is in the FIFO
+     */
+    i2c_dma.begin(true);
+    i2c_dma.destination((volatile unsigned long&) LPI2C1_MTDR);
+    i2c_dma.triggerAtHardwareEvent(DMAMUX_SOURCE_LPI2C1);
+    i2c_dma.disableOnCompletion();
+    i2c_dma.interruptAtCompletion();
+    i2c_dma.attachInterrupt(dma_isr, App_Constants::DISPLAY_DMA_INT_PRIO);
+}
+
+//let the previous frame finish going out on the bus before queueing the next one
+//then poll the status one last time, so a NACK on the last few words still gets flagged before the caller checks for errors
+void Display_I2C::begin_frame() {
+    wait_idle();
+    check_bus_errors();
+    queue_len = 0;
+    in_frame = true;
+}
+
+void Display_I2C::end_frame() {
+    in_frame = false;
+    kick();
+}
+
+//busy while the DMA's still feeding the FIFO, or the FIFO's still draining onto the bus
+bool Display_I2C::busy() {
+    if(check_bus_errors()) return false;
+    if(dma_active) return true;
+    return (LPI2C1_MFSR & 0x07) != 0 || (LPI2C1_MSR & LPI2C_MSR_MBF) != 0;
+}
+
+bool Display_I2C::check_and_clear_error() {
+    bool error = error_flag;
+    error_flag = false;
+    return error;
+}
+
+//I2C displays send the D/C selection as a control byte in the data, so all we see is START/bytes/STOP
+uint8_t Display_I2C::byte_cb(u8x8_t* u8x8, uint8_t msg, uint8_t arg_int, void* arg_ptr) {
+    switch(msg) {
+        case U8X8_MSG_BYTE_INIT:
+            init();
+            break;
+
+        case U8X8_MSG_BYTE_SET_DC:
+            break;
+
+        case U8X8_MSG_BYTE_START_TRANSFER:
+            //on its own, make sure whatever went before has fully gone out first
+            if(!in_frame) {
+                wait_idle();
+                queue_len = 0;
+            }
+            //U8g2 keeps the 8-bit address (R/W bit clear), which is exactly what goes on the bus
+            push((CMD_START << 8) | (u8x8_GetI2CAddress(u8x8) & 0xFE));
+            break;
+
+        case U8X8_MSG_BYTE_SEND: {
+            const uint8_t* data = reinterpret_cast<const uint8_t*>(arg_ptr);
+            for(uint8_t i = 0; i < arg_int; i++) push((CMD_TRANSMIT << 8) | data[i]);
+            break;
+        }
+
+        case U8X8_MSG_BYTE_END_TRANSFER:
+            push(CMD_STOP << 8);
+            //on its own, send it now and wait, same as the stock transport
+            if(!in_frame) {
+                kick();
+                wait_idle();
+            }
+            break;
+
+        default:
+            return 0;
+    }
+    return 1;
+}
+
+//=============================================== PRIVATE UTILITY FUNCTIONS ===========================================
+
+//queue's full --> send what we have so far and start filling it again
+//the transfer in progress just carries on once the new words go out
+void Display_I2C::push(uint32_t word) {
+    if(queue_len == queue.size()) {
+        kick();
+        wait_queue_free();
+        queue_len = 0;
+    }
+    queue[queue_len++] = word;
+}
+
+void Display_I2C::kick() {
+    if(queue_len == 0) return;
+
+    //DMA reads straight from RAM, so get the queue out of the cache first
+    arm_dcache_flush(queue.data(), queue_len * sizeof(uint32_t));
+
+    //point the DMA at the queue and let the peripheral start requesting words
+    i2c_dma.sourceBuffer((const volatile unsigned long*) queue.data(), queue_len * sizeof(uint32_t));
+    dma_active = true;
+    i2c_dma.enable();
+    LPI2C1_MDER = LPI2C_MDER_TDDE;
+}
+
+//the DMA's done reading the queue, so it can be overwritten (the last few words may still be in the FIFO)
+void Display_I2C::wait_queue_free() {
+    while(dma_active && !check_bus_errors());
+}
+
+//everything's out on the bus
+void Display_I2C::wait_idle() {
+    while(busy());
+}
+
+//the display NACKed, we lost arbitration, or the bus is stuck
+//peripheral stops processing commands until the flags are cleared, so the DMA would otherwise wait forever
+bool Display_I2C::check_bus_errors() {
+    const uint32_t ERROR_FLAGS = LPI2C_MSR_NDF | LPI2C_MSR_ALF | LPI2C_MSR_FEF | LPI2C_MSR_PLTF;
+    if((LPI2C1_MSR & ERROR_FLAGS) == 0) return false;
+
+    //abandon the transfer: stop the DMA, throw out what's in the FIFOs, then clear the flags (write 1 to clear)
+    i2c_dma.disable();
+    LPI2C1_MDER = 0;
+    dma_active = false;
+    LPI2C1_MCR |= LPI2C_MCR_RTF | LPI2C_MCR_RRF;
+    LPI2C1_MSR = ERROR_FLAGS;
+
+    error_flag = true;
+    error_count++;
+    return true;
+}
+
+//DMA has put the last word in the FIFO
+void Display_I2C::dma_isr() {
+    //stop requesting, flag that the queue is free
+    LPI2C1_MDER = 0;
+    dma_active = false;
+    i2c_dma.clearInterrupt();
+
+    //ensure everything is synchronized--need this instruction in the ISR
+    asm volatile("dsb");
+}
@@ -0,0 +1,107 @@
+#pragma once
+
+/*
+ * Static class that drives the OLED's I2C bus (LPI2C1, pins 18/19) with DMA instead of U8g2's blocking `Wire` transport
+ * Plugs into U8g2 as a U8x8 byte callback, so everything above it (fonts, drawing, `sendBuffer()`, `updateDisplayArea()`) stays the same
+ *
+ * How it works:
+ *      \--> every byte U8g2 hands us gets turned into an LPI2C command word (START + address, data byte, STOP) in a queue
+ *      \--> the queue gets DMA'd into the LPI2C transmit FIFO; the peripheral paces the DMA, the CPU isn't involved
+ *      \--> the frame buffer is copied into the queue as it goes, so it's free to draw into again as soon as the submit returns
+ *
+ * Two ways transfers go out:
+ *      \--> frames: wrap the `sendBuffer()`/`updateDisplayArea()` calls in `begin_frame()` and `end_frame()`
+ *              \--> `end_frame()` starts the DMA and returns straight away; check `busy()` to see if it's still going out
+ *              \--> `begin_frame()` waits until the previous frame is all the way out (only if frames come faster than the bus can carry them),
+ *                   so any error from that frame has been flagged by the time it returns
+ *      \--> everything else (init sequence, contrast, power save): sent and waited on transfer-by-transfer, like the stock transport
+ *
+ * If the display NACKs or the bus gets stuck, the transfer is abandoned and an error is flagged
+ *      \--> what made it onto the screen is unknown at that point, so whoever keeps track of that should resend everything
+ *      \--> errors are only noticed while polling the bus (`busy()`, `begin_frame()`), never from an interrupt
+ *
+ * Intention is to use this class statically, i.e. don't instantiate it
+ */
+
+#include <array>
+
+#include <Arduino.h> //for types, interface
+#include <DMAChannel.h> //streaming command words into the I2C peripheral
+#include <U8g2lib.h> //byte callback types, display class
+
+#include <config.h> //for bus speed, queue size, interrupt priority
+
+class Display_I2C {
+public:
+    //prevent all flavors of making an instance of one of these
+    Display_I2C() = delete;
+    Display_I2C(const Display_I2C& other) = delete;
+    void operator=(const Display_I2C& other) = delete;
+
+    //set up the I2C peripheral, its pins and the DMA channel
+    //safe to call more than once (U8g2 calls it through the byte callback on `begin()`)
+    static void init();
+
+    //queue up a frame's worth of transfers, then send them in the background
+    //check for errors after `begin_frame()`, that's when the previous frame is known to be done
+    static void begin_frame();
+    static void end_frame();
+
+    //whether the last submitted transfers are still going out
+    //also where bus errors get noticed, so poll this rather than waiting on a flag
+    static bool busy();
+
+    //true if a transfer has been abandoned since the last call
+    static bool check_and_clear_error();
+    static inline uint32_t get_error_count() { return error_count; }
+
+    //U8x8 byte callback; hand this to the U8g2 setup function
+    static uint8_t byte_cb(u8x8_t* u8x8, uint8_t msg, uint8_t arg_int, void* arg_ptr);
+
+private:
+    //LPI2C master transmit commands (upper byte of a transmit FIFO word)
+    static constexpr uint32_t CMD_TRANSMIT = 0;
+    static constexpr uint32_t CMD_STOP = 2;
+    static constexpr uint32_t CMD_START = 4;
+
+    //append a word to the queue; sends (and waits on) what's queued if it's full
+    static void push(uint32_t word);
+
+    //start sending the queue out
+    static void kick();
+
+    //block until the DMA's done with the queue (so it can be refilled), or until everything's out on the bus
+    static void wait_queue_free();
+    static void wait_idle();
+
+    //after a bus error, abandon the transfer and get the peripheral ready to go again; true if that happened
+    static bool check_bus_errors();
+
+    //DMA has written the last word into the FIFO
+    static void dma_isr();
+
+    //own a DMA channel that feeds the LPI2C1 transmit FIFO
+    static DMAChannel i2c_dma;
+
+    //command words waiting to go out (or going out)
+    //DMA-accessible, aligned to cache lines so flushing it doesn't touch anything else
+    static DMAMEM __attribute__((aligned(32))) std::array<uint32_t, App_Constants::DISPLAY_I2C_QUEUE_WORDS> queue;
+    static size_t queue_len;
+
+    static bool initialized;
+    static bool in_frame; //queueing a frame, don't send on every end of transfer
+    static volatile bool dma_active; //cleared by the DMA ISR
+    static bool error_flag;
+    static uint32_t error_count;
+};
+
+/*
+ * SH1106 128x64 full frame buffer display running over `Display_I2C`
+ * Same as `U8G2_SH1106_128X64_NONAME_F_HW_I2C`, just with the DMA transport underneath
+ */
+class U8G2_SH1106_128X64_NONAME_F_DMA_I2C : public U8G2 {
+public:
+    U8G2_SH1106_128X64_NONAME_F_DMA_I2C(const u8g2_cb_t* rotation): U8G2() {
+        u8g2_Setup_sh1106_i2c_128x64_noname_f(&u8g2, rotation, Display_I2C::byte_cb, u8x8_gpio_and_delay_arduino);
+    }
+};
@@ -19,12 +19,13 @@
 
 #include <ui_page.h> //for some render-related function
 #include <encoder.h>
+#include <utils.h> //for string handles
 
 //all methods will basically be implementation defined
 class Effect_Parameter {
 public:
     //default constructor just stores the label of the parameter
-    Effect_Parameter(const std::string _label): label(_label) {}
+    Effect_Parameter(App_String _label): label(_label) {}
 
     //forward destructor to derived classes
     virtual ~Effect_Parameter() {}
@@ -48,13 +49,21 @@ public:
     //   but doing this just in case
     virtual void synchronize() {}
 
+    //generic access to the value, for anything that isn't the knob (e.g. remote control)
+    //numerical parameters work in their own units, selections work in choice indices
+    //setting clamps to the range and moves the attached encoder too
+    virtual float get_value() { return 0; }
+    virtual void set_value(float value) {}
+    virtual float get_min_value() { return 0; }
+    virtual float get_max_value() { return 0; }
+
     //provide methods to get the bounding box width and height of the parameter
     inline uint32_t get_edit_width() { return PARAM_EDIT_RENDER_WIDTH; }
     inline uint32_t get_edit_height() { return PARAM_EDIT_RENDER_HEIGHT; }
     inline uint32_t get_quick_edit_width() { return PARAM_QE_RENDER_WIDTH; }
     inline uint32_t get_quick_edit_height() { return PARAM_QE_RENDER_HEIGHT; }
     //along with the parameter label
-    inline std::string get_label() { return label; }
+    inline App_String get_label() { return label; }
 
 protected:
     //point to an encoder that will be used to modify our parameter
@@ -62,7 +71,7 @@ protected:
     Rotary_Encoder* enc = nullptr;
 
     //and store the label of the parameter
-    const std::string label;
+    const App_String label;
 
     //dimensions of the parameter in px when rendered on the screen in normal edit context
     const uint32_t PARAM_EDIT_RENDER_WIDTH = 24;
@@ -2,11 +2,13 @@
 #include <effect_param_num_lin.h>
 
 //just save all the values into the constructor 
-Effect_Parameter_Num_Lin::Effect_Parameter_Num_Lin( const std::string _label, const float _param_min, 
-                                                    const float _param_max, const float _param_step, const float param_default):
+Effect_Parameter_Num_Lin::Effect_Parameter_Num_Lin( App_String _label, const float _param_min, 
+                                                    const float _param_max, const float _param_step, const float param_default,
+                                                    const uint8_t decimals, const char* units):
     Effect_Parameter(_label), //save the label with the parent class
     param_min(_param_min), param_max(_param_max), 
-    encoder_max_count((uint32_t)((param_max - param_min) / _param_step))
+    encoder_max_count((uint32_t)((param_max - param_min) / _param_step)),
+    value_text(decimals, units)
 {
     //compute the starting encoder position given the default value
     last_encoder_count = (uint32_t)map(param_default, param_min, param_max, 0, encoder_max_count);
@@ -40,6 +42,7 @@ void Effect_Parameter_Num_Lin::synchronize() {
         //counts are different, recompute parameter value and save the new counts
         param_value = map((float)encoder_pos, 0, encoder_max_count, param_min, param_max);
         last_encoder_count = encoder_pos;
+        UI_Page::request_redraw(); //value on screen is stale now
     }
 }
 
@@ -47,12 +50,22 @@ void Effect_Parameter_Num_Lin::synchronize() {
 //make sure to call `synchronize()` before reading this
 float Effect_Parameter_Num_Lin::get() { return param_value; }
 
+//force the parameter to a particular value
+//recompute the encoder position the same way the constructor does, then push it to the encoder if we have one
+void Effect_Parameter_Num_Lin::set(float value) {
+    value = constrain(value, param_min, param_max);
+    last_encoder_count = (uint32_t)(map(value, param_min, param_max, 0, encoder_max_count) + 0.5f);
+    param_value = map((float)last_encoder_count, 0, encoder_max_count, param_min, param_max);
+    if(enc != nullptr) enc->set_counts(last_encoder_count);
+    UI_Page::request_redraw();
+}
+
 //render the parameter
 //will show up as a label of the parameter at the bottom
 //a bar chart roughly visualizing the value w.r.t. the entire range
 //and the actual numerical value above it
 //x,y offset describe the top left corner of the effect
-//by default renders 1 decimal place
+//renders the number of decimal places and units given to the constructor (1 decimal place, no units by default)
 void Effect_Parameter_Num_Lin::draw(uint32_t x_offset, uint32_t y_offset, U8G2& graphics_handle) {
     
     //NOTE: DON'T CLEAR THE SCREEN BUFFER! WILL BE DONE BY THE HOST PAGE!
@@ -61,12 +74,11 @@ void Effect_Parameter_Num_Lin::draw(uint32_t x_offset, uint32_t y_offset, U8G2&
     u8g2_uint_t font_height = (graphics_handle.getAscent() - graphics_handle.getDescent());
 
     //######### Draw parameter value at the top of active screen area ###########
-    std::string param_val_raw = std::to_string(param_value);
-    std::string param_val_trunc = param_val_raw.substr(0, param_val_raw.find(".")+2);
-    
+    //text is cached, so only format and measure it when the value has changed (always measured in this same font)
+    if(value_text.update(param_value)) value_text_width = graphics_handle.getStrWidth(value_text.c_str());
+
     graphics_handle.setFontPosTop(); //reference text position from the top 
-    u8g2_uint_t text_width = graphics_handle.getStrWidth(param_val_trunc.c_str());
-    graphics_handle.drawStr(x_offset + (PARAM_EDIT_RENDER_WIDTH - text_width)/2, y_offset, param_val_trunc.c_str());
+    graphics_handle.drawStr(x_offset + (PARAM_EDIT_RENDER_WIDTH - value_text_width)/2, y_offset, value_text.c_str());
 
     //######### Draw the parameter label at the bottom of the screen ##########
     graphics_handle.setFontPosBottom(); //reference text position from the bottom
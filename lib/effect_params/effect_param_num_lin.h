@@ -12,13 +12,16 @@
 #include <string>
 
 #include <effect_param.h>
+#include <param_format.h> //for rendering the value without allocating
 #include <encoder.h>
 
 class Effect_Parameter_Num_Lin : public Effect_Parameter {
 public:
     //constructor, takes in min, max, and step values of the parameter (step --> how much a single encoder tick should change the value)
+    //value is shown with `decimals` decimal places followed by `units` (e.g. "Hz"; has to be a string literal or otherwise outlive the parameter)
     //TODO: sanity check inputs maybe, not sure if `static_assert` could catch some of these?
-    Effect_Parameter_Num_Lin(const std::string _label, const float _param_min, const float _param_max, const float _param_step, const float param_default);
+    Effect_Parameter_Num_Lin(App_String _label, const float _param_min, const float _param_max, const float _param_step, const float param_default,
+                             const uint8_t decimals = 1, const char* units = "");
 
     //should basically configure the max value of the encoder and its steps position
     //shouldn't attach any callbacks --> that's what the owner program should do
@@ -39,6 +42,16 @@ public:
     //make sure to call `synchronize()` before reading this
     float get();
 
+    //force the parameter to a particular value (clamped to the parameter range, snapped to the nearest step)
+    //moves the attached encoder too, so turning the knob afterwards picks up from the new value
+    void set(float value);
+
+    //generic access just forwards to the above
+    float get_value() override { return get(); }
+    void set_value(float value) override { set(value); }
+    float get_min_value() override { return param_min; }
+    float get_max_value() override { return param_max; }
+
 private:
     //store the min, max and encoder max counts
     //don't really need to save `step` as that's effectively encoded into `encoder_max_count`
@@ -50,4 +63,8 @@ private:
     uint32_t last_encoder_count = 0;    //don't recalculate if encoder value didn't change
                                         //also useful to initialize encoder value 
     float param_value;
+
+    //value as rendered on screen, only reformatted (and re-measured) when the value changes
+    Param_Value_Text value_text;
+    u8g2_uint_t value_text_width = 0;
 };
\ No newline at end of file
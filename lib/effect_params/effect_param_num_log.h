@@ -12,14 +12,17 @@
 #include <string>
 
 #include <effect_param.h>
+#include <param_format.h> //for rendering the value without allocating
 #include <encoder.h>
 
 class Effect_Parameter_Num_Log : public Effect_Parameter {
 public:
     //constructor, takes in min, max, and num_points
     //num_points describes how many degrees of granularity there should be between max and min
+    //value is shown with `decimals` decimal places followed by `units` (e.g. "Hz"; has to be a string literal or otherwise outlive the parameter)
     //TODO: sanity check inputs maybe, not sure if `static_assert` could catch some of these?
-    Effect_Parameter_Num_Log(const std::string _label, const float _param_min, const float _param_max, const uint32_t _num_points, const float param_default);
+    Effect_Parameter_Num_Log(App_String _label, const float _param_min, const float _param_max, const uint32_t _num_points, const float param_default,
+                             const uint8_t decimals = 1, const char* units = "");
 
     //should basically configure the max value of the encoder and its steps position
     //shouldn't attach any callbacks --> that's what the owner program should do
@@ -40,6 +43,16 @@ public:
     //make sure to call `synchronize()` before reading this
     float get();
 
+    //force the parameter to a particular value (clamped to the parameter range, snapped to the nearest step)
+    //moves the attached encoder too, so turning the knob afterwards picks up from the new value
+    void set(float value);
+
+    //generic access just forwards to the above
+    float get_value() override { return get(); }
+    void set_value(float value) override { set(value); }
+    float get_min_value() override { return exp(ln_param_min); }
+    float get_max_value() override { return exp(ln_param_max); }
+
 private:
     //store the min, max and step values of the parameter
     const float ln_param_min;
@@ -51,4 +64,8 @@ private:
                                         //also useful to initialize encoder value 
     float param_value;
     float log_param_value;              //save this so we don't have to recompute every screen render
+
+    //value as rendered on screen, only reformatted (and re-measured) when the value changes
+    Param_Value_Text value_text;
+    u8g2_uint_t value_text_width = 0;
 };
\ No newline at end of file
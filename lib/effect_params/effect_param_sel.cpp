@@ -2,7 +2,7 @@
 #include <effect_param_sel.h>
 
 //just save all the values into the constructor 
-Effect_Parameter_Sel::Effect_Parameter_Sel(const std::string _label, App_Span<std::string> _choices, std::string _default_choice):
+Effect_Parameter_Sel::Effect_Parameter_Sel(App_String _label, App_Span<App_String> _choices, App_String _default_choice):
     Effect_Parameter(_label), //save the label with the parent class
     active_choice(),  //default initialize the scroll string
     choices(_choices) //save our span of choices
@@ -34,7 +34,11 @@ void Effect_Parameter_Sel::synchronize() {
     //if we have an attached encoder, read it
     if(enc != nullptr) {
         //choice index directly corresponds to encoder counts
-        choice_index = enc->get_counts();
+        uint32_t encoder_pos = enc->get_counts();
+        if(encoder_pos == choice_index) return;
+
+        choice_index = encoder_pos;
+        UI_Page::request_redraw(); //selection on screen is stale now
     }
 }
 
@@ -42,6 +46,12 @@ void Effect_Parameter_Sel::synchronize() {
 //make sure to call `synchronize()` before reading this
 uint32_t Effect_Parameter_Sel::get() { return choice_index; }
 
+void Effect_Parameter_Sel::set(uint32_t index) {
+    choice_index = min(index, (uint32_t)(choices.size() - 1));
+    if(enc != nullptr) enc->set_counts(choice_index);
+    UI_Page::request_redraw();
+}
+
 //render the parameter
 //will show up as a label of the parameter at the bottom
 //a bar chart roughly visualizing the value w.r.t. the entire range
@@ -21,7 +21,7 @@ public:
     //constructor, takes in labels of all the choices
     //single encoder count per choice
     //if default choice isn't in the list of choices, it'll default choice will be the first element
-    Effect_Parameter_Sel(const std::string _label, App_Span<std::string> _choices, std::string _default_choice);
+    Effect_Parameter_Sel(App_String _label, App_Span<App_String> _choices, App_String _default_choice);
 
     //should basically configure the max value of the encoder and its steps position
     //shouldn't attach any callbacks --> that's what the owner program should do
@@ -41,6 +41,15 @@ public:
     //`Effect` has to act on this numerical value accordingly
     uint32_t get();
 
+    //force a particular choice (clamped to the list); moves the attached encoder too
+    void set(uint32_t index);
+
+    //generic access works in choice indices
+    float get_value() override { return get(); }
+    void set_value(float value) override { set((uint32_t)max(value + 0.5f, 0.0f)); }
+    float get_min_value() override { return 0; }
+    float get_max_value() override { return choices.size() - 1; }
+
 private:
     //have a scroll string that scrolls the active item
     //and a `last_choice_index` to restart the scrolling text
@@ -48,7 +57,7 @@ private:
     uint32_t last_choice_index = -1; //bogus max value
 
     //point to an array of strings that name each of the choices
-    App_Span<std::string> choices;
+    App_Span<App_String> choices;
 
     //save the previous encoder count to remember which choice we selected
     uint32_t choice_index = 0; //default to first choice 
@@ -0,0 +1,58 @@
+#include <param_format.h>
+
+//========================= PARAM_FORMAT ========================
+
+size_t Param_Format::format(char* buf, size_t buf_size, float value, uint8_t decimals, const char* units) {
+    if(buf_size == 0) return 0;
+
+    static constexpr std::array<uint32_t, MAX_DECIMALS + 1> POW_10 = {1, 10, 100, 1000, 10000};
+    if(decimals > MAX_DECIMALS) decimals = MAX_DECIMALS;
+    const uint32_t scale = POW_10[decimals];
+
+    //round the magnitude to fixed point with `decimals` fractional digits
+    //comparison written so a NaN ends up clamped too instead of hitting an undefined conversion
+    bool negative = value < 0;
+    float scaled = (negative ? -value : value) * (float)scale + 0.5f;
+    static constexpr float FIXED_LIMIT = 4294967040.0f; //largest float below 2^32
+    uint32_t fixed = (scaled < FIXED_LIMIT) ? (uint32_t)scaled : (uint32_t)FIXED_LIMIT;
+    if(fixed == 0) negative = false; //don't print "-0.0"
+
+    //build the number back to front: fractional digits, decimal point, integer digits, sign
+    //longest case is a sign, 10 integer digits, a point and MAX_DECIMALS digits
+    std::array<char, 1 + 10 + 1 + MAX_DECIMALS> digits;
+    size_t n = 0;
+    uint32_t integer_part = fixed / scale;
+    uint32_t frac_part = fixed % scale;
+    for(uint8_t i = 0; i < decimals; i++) {
+        digits[n++] = '0' + (frac_part % 10);
+        frac_part /= 10;
+    }
+    if(decimals > 0) digits[n++] = '.';
+    do {
+        digits[n++] = '0' + (integer_part % 10);
+        integer_part /= 10;
+    } while(integer_part > 0);
+    if(negative) digits[n++] = '-';
+
+    //copy the number out in the right order, then the units, as much as fits
+    size_t len = 0;
+    while(n > 0 && len < buf_size - 1) buf[len++] = digits[--n];
+    for(const char* c = units; *c != '\0' && len < buf_size - 1; c++) buf[len++] = *c;
+    buf[len] = '\0';
+    return len;
+}
+
+//========================= PARAM_VALUE_TEXT ========================
+
+Param_Value_Text::Param_Value_Text(uint8_t _decimals, const char* _units):
+    decimals(_decimals), units(_units != nullptr ? _units : "")
+{}
+
+bool Param_Value_Text::update(float value) {
+    if(formatted && value == formatted_value) return false;
+
+    Param_Format::format(text.data(), text.size(), value, decimals, units);
+    formatted_value = value;
+    formatted = true;
+    return true;
+}
@@ -0,0 +1,58 @@
+#pragma once
+
+/*
+ * Allocation-free number formatting for parameter widgets
+ * Parameters redraw their value every frame they're on screen; `std::to_string()` + `substr()` meant a couple of heap strings
+ * and a full float print each time
+ *
+ * Two pieces:
+ *      \--> `Param_Format::format()`: writes a value into a caller-provided buffer with a fixed number of decimals and an optional units suffix
+ *              \--> rounds to fixed point and prints the integer digits, so no float `printf` (which can allocate on newlib)
+ *      \--> `Param_Value_Text`: a parameter's formatted value, kept in a fixed buffer and only reformatted when the value changes
+ *
+ * No U8g2 or Arduino dependency on purpose, so it can be checked on the host too
+ */
+
+#include <array>
+#include <stddef.h>
+#include <stdint.h>
+
+class Param_Format {
+public:
+    //prevent all flavors of making an instance of one of these
+    Param_Format() = delete;
+    Param_Format(const Param_Format& other) = delete;
+    void operator=(const Param_Format& other) = delete;
+
+    //more decimals than this get clamped; a float doesn't carry much more than that anyway
+    static constexpr uint8_t MAX_DECIMALS = 4;
+
+    //write `value` rounded to `decimals` places, followed by `units` (e.g. "Hz", "dB", "%"; can be empty) into `buf`
+    //always null-terminates, truncating if `buf_size` is too small; returns the number of characters written
+    //magnitudes past what fits in 32 bits of fixed point get clamped
+    static size_t format(char* buf, size_t buf_size, float value, uint8_t decimals, const char* units);
+};
+
+class Param_Value_Text {
+public:
+    //long enough for any parameter value we'd fit on the screen, plus a short units suffix
+    static constexpr size_t MAX_CHARS = 15;
+
+    //`units` has to outlive this (i.e. pass a string literal)
+    Param_Value_Text(uint8_t _decimals = 1, const char* _units = "");
+
+    //reformat if `value` differs from the value the text was last formatted from
+    //returns true if the text changed (so anything derived from it, like its rendered width, should be recomputed)
+    bool update(float value);
+
+    //the formatted text, valid until the next `update()`
+    inline const char* c_str() const { return text.data(); }
+
+private:
+    const uint8_t decimals;
+    const char* const units;
+
+    std::array<char, MAX_CHARS + 1> text = {};
+    float formatted_value = 0;
+    bool formatted = false; //nothing in `text` until the first `update()`
+};
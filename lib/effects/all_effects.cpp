@@ -11,52 +11,111 @@
 #include <effect_vol_fixed_point.h>
 #include <effect_vol_float_point.h>
 #include <effect_cab_sim.h>
+#include <effect_cab_sim_sd.h>
 #include <effect_overdrive.h>
+#include <effect_parametric_eq.h>
+#include <effect_delay.h>
+#include <effect_fdn_reverb.h>
+#include <effect_noise_gate.h>
+#include <effect_compressor.h>
+#include <effect_mod_delay.h>
+
+//======================== EFFECT REGISTRY =====================
+
+//make an effect that just needs the theme color and name it's registered with
+template<class Effect>
+static std::unique_ptr<Effect_Interface> construct_effect(const Effect_Descriptor& descriptor) {
+    return std::make_unique<Effect>(descriptor.theme_color, descriptor.name);
+}
 
-//======================== STATIC VARIABLE DEFINITION =====================
-//################### USE THIS SPACE TO INSTANTIATE "MASTERs" OF ALL EFFECTS #################
+//effects that need more than that to be constructed get a factory of their own
+static std::unique_ptr<Effect_Interface> construct_fender_twin(const Effect_Descriptor& descriptor) {
+    return std::make_unique<Effect_Cab_Sim>(descriptor.theme_color, descriptor.name, Effect_Cab_Sim::FENDER_TWIN_REVERB);
+}
+static std::unique_ptr<Effect_Interface> construct_chorus(const Effect_Descriptor& descriptor) {
+    return std::make_unique<Effect_Mod_Delay>(descriptor.theme_color, descriptor.name, App_Strings::EDIT_CHORUS, Effect_Mod_Delay::CHORUS);
+}
+static std::unique_ptr<Effect_Interface> construct_flanger(const Effect_Descriptor& descriptor) {
+    return std::make_unique<Effect_Mod_Delay>(descriptor.theme_color, descriptor.name, App_Strings::EDIT_FLANGER, Effect_Mod_Delay::FLANGER);
+}
+static std::unique_ptr<Effect_Interface> construct_vibrato(const Effect_Descriptor& descriptor) {
+    return std::make_unique<Effect_Mod_Delay>(descriptor.theme_color, descriptor.name, App_Strings::EDIT_VIBRATO, Effect_Mod_Delay::VIBRATO);
+}
+
+//fill out a descriptor; the icon comes straight from the effect class
+template<class Effect>
+static constexpr Effect_Descriptor describe(App_String name, RGB_LED::COLOR theme_color,
+                                            std::unique_ptr<Effect_Interface> (*construct)(const Effect_Descriptor&) = construct_effect<Effect>)
+{
+    return {name, &Effect::icon, theme_color, construct};
+}
+
+//################### USE THIS SPACE TO REGISTER ALL EFFECTS #################
+//order here is the order they show up in the effect select menus; the first one is what every slot starts with
 
-Effect_Interface* const Effects_Manager::available_effects[] = {
-        //initialize some passthrough tests
-        new Effect_Test_Passthrough(RGB_LED::WHITE, "Default Passthrough"),
+static constexpr Effect_Descriptor EFFECT_REGISTRY[] = {
+    //passthrough tests
+    describe<Effect_Test_Passthrough>(App_Strings::EFFECT_PASSTHROUGH, RGB_LED::WHITE),
+    describe<Effect_Test_Param>(App_Strings::EFFECT_TEST_PARAMS, RGB_LED::RED),
 
-        //Initialize passthrough test with param
-        new Effect_Test_Param(RGB_LED::RED, "Passthrough Param"),
+    //lowpass and highpass filters
+    /* TODO FIR filter */
+    describe<Effect_IIR_LP>(App_Strings::EFFECT_IIR_LP, RGB_LED::YELLOW),
+    describe<Effect_IIR_HP>(App_Strings::EFFECT_IIR_HP, RGB_LED::PURPLE),
 
-        //Initialize a prototype lowpass FIR and IIR filter
-        /* TODO FIR filter */
-        new Effect_IIR_LP(),
-        new Effect_IIR_HP(),
+    //digital volume control (fixed/float impl)
+    describe<Effect_Vol_Fixed_Point>(App_Strings::EFFECT_VOL_FIXED_POINT, RGB_LED::GREEN),
+    describe<Effect_Vol_Float_Point>(App_Strings::EFFECT_VOL_FLOAT_POINT, RGB_LED::CYAN),
 
-        //Prototypes for digital volume control (fixed/float impl)
-        new Effect_Vol_Fixed_Point(),
-        new Effect_Vol_Float_Point(),
+    //cab sim effects
+    describe<Effect_Cab_Sim>(App_Strings::EFFECT_CAB_FENDER_TWIN, RGB_LED::BLUE, construct_fender_twin),
+    describe<Effect_Cab_Sim_SD>(App_Strings::EFFECT_CAB_SD, RGB_LED::BLUE), //impulse responses loaded off the SD card
 
-        //cab sim effects
-        new Effect_Cab_Sim(RGB_LED::BLUE, "Fender Twin Reverb", Effect_Cab_Sim::FENDER_TWIN_REVERB),
+    //dynamics
+    describe<Effect_Noise_Gate>(App_Strings::EFFECT_NOISE_GATE, RGB_LED::YELLOW),
+    describe<Effect_Compressor>(App_Strings::EFFECT_COMPRESSOR, RGB_LED::GREEN),
 
-        //overdrive effects
-        new Effect_Overdrive(),
-    };
+    //overdrive effects
+    describe<Effect_Overdrive>(App_Strings::EFFECT_OVERDRIVE, RGB_LED::RED),
 
-//################### end EFFECT MASTER DEFINITION #####################
+    //tone shaping
+    describe<Effect_Parametric_EQ>(App_Strings::EFFECT_PARAMETRIC_EQ, RGB_LED::GREEN),
+
+    //modulation effects
+    describe<Effect_Mod_Delay>(App_Strings::EFFECT_CHORUS, RGB_LED::BLUE, construct_chorus),
+    describe<Effect_Mod_Delay>(App_Strings::EFFECT_FLANGER, RGB_LED::PURPLE, construct_flanger),
+    describe<Effect_Mod_Delay>(App_Strings::EFFECT_VIBRATO, RGB_LED::CYAN, construct_vibrato),
+
+    //time-based effects
+    describe<Effect_Delay>(App_Strings::EFFECT_DELAY, RGB_LED::CYAN),
+    describe<Effect_FDN_Reverb>(App_Strings::EFFECT_REVERB, RGB_LED::PURPLE),
+};
+
+//################### end EFFECT REGISTRY #####################
+
+//======================== STATIC VARIABLE DEFINITION =====================
 
 //have a convenience variable that knows the number of available effects
-const size_t Effects_Manager::NUM_AVAIALBLE_EFFECTS = sizeof(available_effects) / sizeof(available_effects[0]); 
+const size_t Effects_Manager::NUM_AVAIALBLE_EFFECTS = sizeof(EFFECT_REGISTRY) / sizeof(EFFECT_REGISTRY[0]); 
 
 //declare the effects manager array whatever default values; properly initialized in `init()` below
 Active_Effects_t Effects_Manager::active_effects = {};
+uint32_t Effects_Manager::chain_version = 0;
+
+//no cycles recorded until the audio update runs
+std::array<volatile uint32_t, App_Constants::NUM_EFFECTS> Effects_Manager::effect_cycles = {};
+std::array<volatile uint32_t, App_Constants::NUM_EFFECTS> Effects_Manager::effect_cycles_peak = {};
 
 //================================= PUBLIC MEMBER FUNCTIONS =============================
 
 //initialize the active effects array
-//just make copies of the first audio effect in our list as a default
+//just make instances of the first audio effect in our list as a default
 void Effects_Manager::init() {
     for(auto& effect : active_effects) 
-        effect = available_effects[0]->clone();
+        effect = EFFECT_REGISTRY[0].construct(EFFECT_REGISTRY[0]);
 }
 
-//replace the effect at `effect_index` with a clone of the effect at `effect_no_in_list`
+//replace the effect at `effect_index` with a fresh instance of the effect at `effect_no_in_list`
 //call `connect()` and `disconnect()` as necessary
 void Effects_Manager::replace(size_t effect_index, size_t effect_no_in_list) {
     //sanity check the inputs, return if they're outta range
@@ -70,11 +129,13 @@ void Effects_Manager::replace(size_t effect_index, size_t effect_no_in_list) {
     //disconnect the "outgoing" effect
     active_effects[effect_index]->disconnect();
 
-    //make a copy of our master effect in our list
-    active_effects[effect_index] = available_effects[effect_no_in_list]->clone();
+    //make a new instance of the effect from its descriptor
+    const Effect_Descriptor& descriptor = EFFECT_REGISTRY[effect_no_in_list];
+    active_effects[effect_index] = descriptor.construct(descriptor);
 
     //and connect the effect to the system
     active_effects[effect_index]->connect();
+    chain_version++;
 
     //ensure all memory addresses of the effects are synchronized
     //ensures no invalid memory accesses once audio update interrupt is resumed
@@ -85,22 +146,7 @@ void Effects_Manager::replace(size_t effect_index, size_t effect_no_in_list) {
     Audio_Out_MQS::resume_interrupt();
 }
 
-//get the names of the available effects
-App_Span<std::string> Effects_Manager::get_available_names() {
-    //maintain a statically allocated array of effect names
-    //return a pointer to this array and its size 
-    static std::array<std::string, NUM_AVAIALBLE_EFFECTS> effect_names;
-    static bool initialized = false; //flag to only do this work once 
-    
-    //if we haven't initialized the array yet
-    //grab the names of each element and store them in the corresponding index
-    //set the initialized flag too
-    if(!initialized) {
-        for(size_t i = 0; i < NUM_AVAIALBLE_EFFECTS; i++)
-            effect_names[i] = available_effects[i]->get_name();
-        initialized = true;
-    }
-
-    //return a "DIY std::span" that refers to this array we've created
-    return App_Span<std::string>(effect_names);
-}
\ No newline at end of file
+//get the descriptors of the available effects
+App_Span<const Effect_Descriptor> Effects_Manager::get_available_effects() {
+    return App_Span<const Effect_Descriptor>(EFFECT_REGISTRY, NUM_AVAIALBLE_EFFECTS);
+}
@@ -5,6 +5,11 @@
  * use this class to create UI menus, create UI menu actions, and load effects themselves
  * Will also hold the collection of active effects in an array of `std::unique_ptr`s
  * 
+ * Available effects are a constant table of `Effect_Descriptor`s (the "registry", see `all_effects.cpp`)
+ *      \--> name, icon and theme color are readable without making an instance of the effect
+ *      \--> an effect only gets constructed when it's loaded into a slot
+ *      \--> adding an effect is one line in the registry
+ * 
  * Intention is to use this class statically, i.e. don't instantiate it
  * 
  * By Ishaan Gov
@@ -16,10 +21,22 @@
 
 #include <effect_interface.h> //hold container of effects
 #include <config.h> //for constants
+#include <utils.h> //for App_Span, App_String
 
 //typedef outta convenience
 typedef std::array<std::unique_ptr<Effect_Interface>, App_Constants::NUM_EFFECTS> Active_Effects_t;
 
+//everything we need to know about an available effect before there's an instance of it
+//entries are built at compile time and live in flash
+struct Effect_Descriptor {
+    App_String name;
+    const Effect_Icon_t* icon; //the effect class's static icon
+    RGB_LED::COLOR theme_color;
+
+    //make a fresh instance of the effect on the heap, configured from this descriptor
+    std::unique_ptr<Effect_Interface> (*construct)(const Effect_Descriptor& descriptor);
+};
+
 class Effects_Manager {
 public:
     //prevent all flavors of making an instance of one of these
@@ -36,26 +53,36 @@ public:
     //replace the effect at the specified index with the effect from our list at the speficied index
     static void replace(size_t effect_index, size_t effect_no_in_list);
 
-    //get the names of all the available effects, in the order of their indices
-    //would like to return a reference to a std::array but compile-time array size computation is unavailable
-    //next best thing is an `App_span` which will hopefully have a similar interface
-    static App_Span<std::string> get_available_names();
+    //bumped every time an effect gets replaced; anything caching something about the chain can compare against this
+    static inline uint32_t get_chain_version() { return chain_version; }
+
+    //get the descriptors of all the available effects, in the order of their indices
+    static App_Span<const Effect_Descriptor> get_available_effects();
 
     //individual and collective getter functions for the active effects
     static inline std::unique_ptr<Effect_Interface>& get_active_effect(size_t i) { return active_effects[i]; }
     static inline Active_Effects_t& get_active_effects() { return active_effects; }
 
+    //CPU usage of each active effect, in CPU cycles per audio block
+    //audio update records the cycles each slot took; peak holds the worst case since the last `reset_peak_cycles()`
+    static inline void record_cycles(size_t i, uint32_t cycles) {
+        effect_cycles[i] = cycles;
+        if(cycles > effect_cycles_peak[i]) effect_cycles_peak[i] = cycles;
+    }
+    static inline uint32_t get_cycles(size_t i) { return effect_cycles[i]; }
+    static inline uint32_t get_peak_cycles(size_t i) { return effect_cycles_peak[i]; }
+    static inline void reset_peak_cycles() { for(auto& peak : effect_cycles_peak) peak = 0; }
+
 private:
-    //have a collection of all possible effects
-    //can't directly own instances of a base class since that doesn't allow for polymorphic behavior
-    //instead we have to own pointers to effects
-    //"prototypes" of these effects will be created on the heap (i.e. a single copy of each effect)
-    //  \--> these will exist throughout the lifetime of the program and won't be touched
-    //  \--> as such, c-style pointers should be fine for something like this
-    //making this a c-style container since it's tricky to automatically deduce the size for a std::array
-    static Effect_Interface* const available_effects[];
+    //the registry itself lives in `all_effects.cpp` (so this header doesn't need to pull in every effect)
+    //just keep the number of entries here
     static const size_t NUM_AVAIALBLE_EFFECTS;
 
     //most importantly, hold an array of `std::unique_ptr`s to active effects
     static Active_Effects_t active_effects;
+    static uint32_t chain_version;
+
+    //cycle counts of the active effects (written from the audio update)
+    static std::array<volatile uint32_t, App_Constants::NUM_EFFECTS> effect_cycles;
+    static std::array<volatile uint32_t, App_Constants::NUM_EFFECTS> effect_cycles_peak;
 };
\ No newline at end of file
@@ -65,79 +65,38 @@ const Effect_Icon_t Effect_Cab_Sim::icon = {
 //=========================== OVERRIDDEN PUBLIC FUNCTIONS =========================
 
 //save the name, effect theme color, and impulse kernel
-Effect_Cab_Sim::Effect_Cab_Sim(RGB_LED::COLOR _theme_color, std::string _name, const Impulse_Response_t& _impulse_kernel):
+Effect_Cab_Sim::Effect_Cab_Sim(RGB_LED::COLOR _theme_color, App_String _name, const Impulse_Response_t& _impulse_kernel):
     name(_name),
     theme_color(_theme_color),
     impulse_kernel(_impulse_kernel)
-{}
-
-//copy constructor just invokes the default constructor with the same parameters as the original
-Effect_Cab_Sim::Effect_Cab_Sim(const Effect_Cab_Sim& other):
-    name(other.name),
-    theme_color(other.theme_color),
-    impulse_kernel(other.impulse_kernel)
-{}
-
-//function we call to actually instantiate a new effect on the heap
-//return a unique pointer 
-std::unique_ptr<Effect_Interface> Effect_Cab_Sim::clone() {
-    return std::make_unique<Effect_Cab_Sim>(*new Effect_Cab_Sim(*this));
+{
+    load_kernel();
 }
 
-std::string Effect_Cab_Sim::get_name() { return name; }
-Effect_Icon_t Effect_Cab_Sim::get_icon() { return icon; }
+App_String Effect_Cab_Sim::get_name() { return name; }
+const Effect_Icon_t& Effect_Cab_Sim::get_icon() { return icon; }
 RGB_LED::COLOR Effect_Cab_Sim::get_theme_color() { return theme_color; }
 
 //======================================= CORE OF THE EFFECT --> CONVOLUTIONAL REVERB ==============================
 
-/**
- * TODO: this
-*/
+//all the heavy lifting is done by the FIR kernel
 void Effect_Cab_Sim::audio_update(const Audio_Block_t& block_in, Audio_Block_t& block_out) {
-    //go through all of the samples in the block 
-    for(size_t block_sample_index = 0; block_sample_index < block_in.size(); block_sample_index++) {
-        //reference the samples at the particular index
-        const auto& sample_in = block_in[block_sample_index];
-        auto& sample_out = block_out[block_sample_index];
-
-        //drop the particular input sample into our circular sample buffer
-        sample_memory[sample_memory_head] = sample_in;
-
-        //actually run the convolution
-        //use 32x16 multiply-accumulate (MAC) DSP instructions to make this happen
-        int32_t sum = 0;
-        size_t sample_buffer_ptr = sample_memory_head; //most recent sample
-        for(const auto& tap : impulse_kernel) {
-            const auto& sample = sample_memory[sample_buffer_ptr]; //grab the FIR tap and the corresponding sample
-            sum = signed_multiply_accumulate_32x16b(sum, tap, (uint32_t)sample); //run the MAC using DSP instructions
-
-            //tap will move "forward in time"
-            //sample index will move "backward in time"
-            //roll-over the sample buffer pointer as necessary 
-            if(sample_buffer_ptr == 0) sample_buffer_ptr = sample_memory.size() - 1;
-            else sample_buffer_ptr--;
-        }
-        
-        //since FIR taps are Q1.31, we need to left shift our sum by 1
-        //and additionaly compensate for any sorta coefficient scaling done
-        //  \--> the latter is done to ensure that at no point our FIR sum exceeds the 32-bit accumulator
-        sum = sum << 1;
-        sum = sum * impulse_kernel.size();
-
-        //we'll do some additional processing here to ensure that the output sample safely clips to min/max limits
-	//instead of doing some funky rollover
-	if(sum > ((int32_t)std::numeric_limits<int16_t>::max()) << SUM_SHIFT_AMT) //upward going clip
-		sample_out = std::numeric_limits<int16_t>::max();
-	else if (sum < ((int32_t)std::numeric_limits<int16_t>::min()) << SUM_SHIFT_AMT) //upward going clip
-		sample_out = std::numeric_limits<int16_t>::min();
-        else 
-		sample_out = (int16_t)(sum >> SUM_SHIFT_AMT);
-
-        //not forgetting to increment the circular buffer for the sample memory; roll over to zero as necessary
-        sample_memory_head++;
-        if(sample_memory_head >= sample_memory.size()) sample_memory_head = 0;
+    cab_fir.process(block_in, block_out);
+}
+
+//convert our impulse response table into Q15 taps
+//table entries are scaled down by the length of the kernel and the post-scale factor (see header)
+//multiplying by the length and shifting by `SUM_SHIFT_AMT` (16 - IMPULSE_POST_SCALE_SHIFT) undoes both --> plain Q15 h
+//same overall gain as the old kernel, which shifted the post-scale factor back out of its sum too
+void Effect_Cab_Sim::load_kernel() {
+    std::array<int16_t, std::tuple_size<Impulse_Response_t>::value> taps_q15;
+    for(size_t i = 0; i < impulse_kernel.size(); i++) {
+        int32_t tap = (impulse_kernel[i] * (int32_t)impulse_kernel.size()) >> SUM_SHIFT_AMT;
+        taps_q15[i] = (int16_t)constrain(tap, (int32_t)std::numeric_limits<int16_t>::min(), (int32_t)std::numeric_limits<int16_t>::max());
     }
+    cab_fir.set_kernel(App_Span<const int16_t>(taps_q15.data(), taps_q15.size()));
 }
+
 //=========================== OVERRIDDEN PRIVATE FUNCTIONS =========================
 
 //override the entry function, schedule a transition after one second
@@ -149,11 +108,11 @@ void Effect_Cab_Sim::impl_on_entry() {
 
 void Effect_Cab_Sim::draw() {
     //display a message on the screen
-    static const std::array<std::string, 4> no_param_msg = {
+    static const std::array<App_String, 4> no_param_msg = {
         name,
-        "======",
-        "This Effect Has No",
-        "Editable Parameters"
+        App_Strings::NO_PARAMS_DIVIDER,
+        App_Strings::NO_PARAMS_LINE_1,
+        App_Strings::NO_PARAMS_LINE_2
     };
 
     //compute the coordinates of the text such that it's center aligned
@@ -176,5 +135,5 @@ void Effect_Cab_Sim::draw() {
     for(size_t i = 0; i < no_param_msg.size(); i++) 
         graphics_handle.drawStr(x_coords[i], y_coords[i], no_param_msg[i].c_str());
     graphics_handle.setFontPosBaseline(); //restore font reference to default
-    graphics_handle.sendBuffer();
+    UI_Page::send_buffer();
 }
\ No newline at end of file
@@ -11,7 +11,7 @@
 #include <limits> //numeric limits of int16_t
 #include <effect_interface.h> //implements interface specified here
 #include <scheduler.h> //to stage a transition
-#include <dspinst.h> //for DSP instructions for convolution
+#include <effect_dsp/fir_direct_q15.h> //FIR kernel that actually runs the convolution
 
 class Effect_Cab_Sim : public Effect_Interface {
 public:
@@ -23,19 +23,12 @@ public:
     //###################################################################################
 
     //default constructor -- just call the base class constructor
-    Effect_Cab_Sim(RGB_LED::COLOR _theme_color, std::string _name, const Impulse_Response_t& _impulse_kernel);
-
-    //copy constructor--invokes the default constructor with the same parameters as the template
-    Effect_Cab_Sim(const Effect_Cab_Sim& other);
-    
-    //implement the clone function to produce instances of this effect that are copies of the original
-    //need to override base class so we produce copies of the derived class instead
-    std::unique_ptr<Effect_Interface> clone() override;
+    Effect_Cab_Sim(RGB_LED::COLOR _theme_color, App_String _name, const Impulse_Response_t& _impulse_kernel);
 
     //provide implementations for the following functions:
     void audio_update(const Audio_Block_t& block_in, Audio_Block_t& block_out) override;
-    std::string get_name() override;
-    Effect_Icon_t get_icon() override;
+    App_String get_name() override;
+    const Effect_Icon_t& get_icon() override;
     RGB_LED::COLOR get_theme_color() override;
 
     //################################################################################
@@ -45,6 +38,13 @@ public:
 
     //################################################################################
 
+    //icon is shared with the SD card cab sim
+    static const Effect_Icon_t icon;
+
+    //how much headroom (as a power of two) the impulse response kernels are scaled with
+    //see notes about the impulse kernel below; impulse responses loaded off the SD card are normalized with this too
+    static constexpr size_t IMPULSE_POST_SCALE_SHIFT = 4; //corresponds to 16
+
 private:
     //define implementation for `draw()` in the effect edit context
     //will just print "no params to adjust" centered on display
@@ -53,11 +53,8 @@ private:
     //override the entry function, schedule a transition after one second
     void impl_on_entry() override;
     
-    //have an icon for the effect, will be constant for all instances
-    static const Effect_Icon_t icon;
-
     //have a particular name for our instance
-    const std::string name; 
+    const App_String name; 
 
     //also have a theme color that can be configured instance-by-instance
     const RGB_LED::COLOR theme_color;    
@@ -66,21 +63,23 @@ private:
     /**
      * NOTES ABOUT THIS:
      *  - Impulse response is scaled by the length of the impulse kernel to avoid numerical overflow
-     *      - since we are adding `impulse_kernel_length` 32 bit numbers, we expect the sum to be at most log2(`impulse_kernel_length`) + 32 bits
+     *      - this was needed when summing 32 bit numbers in a 32 bit accumulator
+     *      - the FIR kernel has 64-bit accumulators, but we keep the table format so existing IRs drop right in
      *  - Impulse response is further scaled by an `IMPULSE_POST_SCALING` factor
      *      - this ensures that the signal safely clips if numeric limits are exceeded in the case of a "worst case signal"
      *      - "worst case signal" means the FIR convolution will produce its maximum possible value (exceeding numeric limits) 
+     *  - Taps get converted to Q15 when the effect is constructed --> Q15 tap = (tap * kernel_length) >> SUM_SHIFT_AMT
     */
     const Impulse_Response_t& impulse_kernel;
-    static constexpr size_t IMPULSE_POST_SCALE_SHIFT = 4; //corresponds to 16
     static constexpr size_t SUM_SHIFT_AMT = 16 - IMPULSE_POST_SCALE_SHIFT;
+
+    //convert the impulse kernel into Q15 taps and load them into our FIR
+    void load_kernel();
     
-    //additionally have some sample memory for the convolution to happen
-    //will use the 32x16 MAC dsp instruction to do the convolution
-    //will use a circular buffer, so we need to remember where the buffer `head` is
-    static constexpr Impulse_Response_t dummy_imp = {0}; //need this just to get the size of the impulse response
-    std::array<Audio_Sample_t, dummy_imp.size()> sample_memory = {0}; //zero initialize
-    size_t sample_memory_head = 0; //point to the beginning of the sample memory
+    //the FIR filter that does the actual convolution
+    //keeps its own (linearized) sample history and runs dual 16x16 MACs
+    FIR_Direct_Q15 cab_fir;
+    static_assert(std::tuple_size<Impulse_Response_t>::value <= FIR_Direct_Q15::MAX_TAPS, "Impulse response too long for FIR kernel!");
 
     //use this to schedule a transition back to the previous page
     Scheduler done_editing_sched;
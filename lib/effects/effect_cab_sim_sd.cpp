@@ -0,0 +1,90 @@
+#include <effect_cab_sim_sd.h>
+
+//=========================== OVERRIDDEN PUBLIC FUNCTIONS =========================
+
+//save the name and effect theme color during initialization
+//cab choices come straight from the SD card library
+Effect_Cab_Sim_SD::Effect_Cab_Sim_SD(RGB_LED::COLOR _theme_color, App_String _name):
+    name(_name),
+    theme_color(_theme_color),
+    cab_select(App_Strings::LABEL_CAB, Cab_IR_Library::get_names(), ""),
+    effect_edit(to_return_page, leds, encs) //initialize our edit page implementation
+{
+    //set the header text and theme color for the effects edit menu
+    effect_edit.set_display_text(App_Strings::EDIT_CAB_SD);
+    effect_edit.set_LED_color(theme_color);
+
+    //set the parameters to edit/render in the edit menu
+    effect_edit.set_render_parmeter(&cab_select, 2);
+
+    //start off running the default cabinet
+    update_kernel();
+}
+
+//start watching for cabinet changes when we're added to the signal chain
+void Effect_Cab_Sim_SD::connect() {
+    kernel_update_sched.schedule_interval_ms(Context_Callback_Function<void>(reinterpret_cast<void*>(this), update_kernel_cb), KERNEL_UPDATE_MS);
+}
+
+//and stop when we're taken out of it
+void Effect_Cab_Sim_SD::disconnect() {
+    kernel_update_sched.deschedule();
+}
+
+//################# CORE OF THE EFFECT ###################
+
+void Effect_Cab_Sim_SD::audio_update(const Audio_Block_t& block_in, Audio_Block_t& block_out) {
+    //nothing loaded off the SD card --> just pass audio through
+    if(Cab_IR_Library::get_num_cabs() == 0) {
+        block_out = block_in;
+        return;
+    }
+
+    //synchronize our parameter for reading/rendering
+    //and leave the selection for the main loop to load; the FIR picks up the new kernel once it's published
+    cab_select.synchronize();
+    selected_cab_index = cab_select.get();
+
+    cab_fir.process(block_in, block_out);
+}
+
+//runs in the main loop context
+void Effect_Cab_Sim_SD::update_kernel() {
+    const uint32_t selected = selected_cab_index;
+    if(selected == loaded_cab_index) return;
+
+    //kernels are already processed and cached, so this is just a copy into the kernel the audio update isn't using
+    cab_fir.stage_kernel(Cab_IR_Library::get_kernel(selected));
+    cab_fir.publish_kernel();
+    loaded_cab_index = selected;
+}
+
+//################# end CORE OF THE EFFECT ###################
+
+App_String Effect_Cab_Sim_SD::get_name() { return name; }
+const Effect_Icon_t& Effect_Cab_Sim_SD::get_icon() { return icon; }
+RGB_LED::COLOR Effect_Cab_Sim_SD::get_theme_color() { return theme_color; }
+Effect_Parameter* Effect_Cab_Sim_SD::get_quick_edit_param() { return effect_edit.get_quick_edit_param(); }
+Effect_Parameter* Effect_Cab_Sim_SD::get_param(size_t index) { return effect_edit.get_render_parameter(index); }
+
+//=========================== OVERRIDDEN PRIVATE FUNCTIONS =========================
+
+//override our entry function --> call our default implementation
+//configuration of render resources
+void Effect_Cab_Sim_SD::impl_on_entry() {
+    //run the entry function in our edit menu implementation
+    effect_edit.configure_render_resources();
+}
+
+//override our exit function --> call our default implementation
+//release all the render resources
+void Effect_Cab_Sim_SD::impl_on_exit() {
+    //run the exit function in our edit menu implementation
+    effect_edit.release_render_resources();
+}
+
+void Effect_Cab_Sim_SD::draw() {
+    //call the render function of our edit menu implemenation
+    //pass it the global graphics handle
+    effect_edit.render(graphics_handle);
+}
@@ -0,0 +1,79 @@
+#pragma once
+
+/**
+ * Cabinet simulator that runs impulse responses loaded off the SD card at runtime
+ * Cabinet is chosen with a selection parameter; choices are whatever `Cab_IR_Library` found at boot
+ * Runs on the same FIR kernel as the built-in cab sim
+ * If no impulse responses were found, audio is passed straight through
+ *
+ * Switching cabinets never copies a kernel in the audio update:
+ *      \--> the audio update just notes which cabinet is selected
+ *      \--> a scheduler task in the main loop stages that cabinet's kernel into the FIR and publishes it
+*/
+
+#include <string>
+
+#include <effect_interface.h> //implements interface specified here
+#include <effect_cab_sim.h> //for the shared cab icon
+#include <effect_edit/default_effect_edit_impl.h> //effect menu implementation
+#include <effect_param_sel.h>   //              ""
+#include <effect_dsp/fir_direct_q15.h> //FIR kernel that actually runs the convolution
+#include <cab_ir_library.h> //impulse responses loaded off the SD card
+#include <scheduler.h> //to load kernels outside of the audio update
+
+class Effect_Cab_Sim_SD : public Effect_Interface {
+public:
+    //save the theme color and name the effect was registered with
+    Effect_Cab_Sim_SD(RGB_LED::COLOR _theme_color, App_String _name);
+
+    //start and stop loading kernels when we get added/removed from the effect chain
+    void connect() override;
+    void disconnect() override;
+
+    //provide implementations for the following functions:
+    void audio_update(const Audio_Block_t& block_in, Audio_Block_t& block_out) override;
+    App_String get_name() override;
+    const Effect_Icon_t& get_icon() override;
+    RGB_LED::COLOR get_theme_color() override;
+    Effect_Parameter* get_quick_edit_param() override;
+    Effect_Parameter* get_param(size_t index) override;
+
+    //icon is the built-in cab sim's
+    //public so the effect registry can point at it without an instance
+    static constexpr const Effect_Icon_t& icon = Effect_Cab_Sim::icon;
+
+private:
+    //define the implementations for the effect edit menu
+    //will use the `default_effect_edit_implementation` to handle editing and rendering our parameter menu
+    void draw() override;
+    void impl_on_entry() override;
+    void impl_on_exit() override;
+
+    //stage and publish the selected cabinet's kernel if it isn't the one loaded
+    //runs in the main loop context
+    void update_kernel();
+    static inline void update_kernel_cb(void* context) { reinterpret_cast<Effect_Cab_Sim_SD*>(context)->update_kernel(); }
+
+    //have a particular name and theme for our instance
+    const App_String name;
+    const RGB_LED::COLOR theme_color;
+
+    //parameter that selects which cabinet we're running
+    Effect_Parameter_Sel cab_select;
+
+    //cabinet the audio update last saw selected, and the one whose kernel was last published
+    volatile uint32_t selected_cab_index = 0;
+    uint32_t loaded_cab_index = -1; //bogus max value, forces a load on the first update
+
+    //check for a new selection every so often while connected
+    static constexpr uint32_t KERNEL_UPDATE_MS = 20;
+    Scheduler kernel_update_sched;
+
+    //the FIR filter that does the actual convolution
+    FIR_Direct_Q15 cab_fir;
+    static_assert(App_Constants::SD_CAB_MAX_TAPS <= FIR_Direct_Q15::MAX_TAPS, "SD cab impulse responses too long for FIR kernel!");
+
+    //have an instance of our `default_effect_edit_impl`
+    //to actually handle our edit menu
+    Default_Effect_Edit_Impl effect_edit;
+};
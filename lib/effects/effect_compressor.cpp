@@ -0,0 +1,97 @@
+#include <effect_compressor.h>
+
+//=========================== STATIC MEMBER VARIABLES =======================
+
+const Effect_Icon_t Effect_Compressor::icon = {
+    0xFC, 0xFF, 0xFF, 0x01, 0x06, 0x00, 0x00, 0x03, 0x03, 0x00, 0x00, 0x06,
+    0x01, 0x00, 0x00, 0x04, 0x01, 0x00, 0x00, 0x04, 0x11, 0x00, 0x00, 0x04,
+    0x11, 0x00, 0x00, 0x04, 0x11, 0x00, 0xC0, 0x05, 0x11, 0x00, 0x3C, 0x04,
+    0x11, 0xC0, 0x03, 0x04, 0x11, 0x20, 0x00, 0x04, 0x11, 0x10, 0x00, 0x04,
+    0x11, 0x08, 0x00, 0x04, 0x11, 0x04, 0x00, 0x04, 0x11, 0x02, 0x00, 0x04,
+    0x11, 0x01, 0x00, 0x04, 0x91, 0x00, 0x00, 0x04, 0x51, 0x00, 0x00, 0x04,
+    0x31, 0x00, 0x00, 0x04, 0xF9, 0xFF, 0xFF, 0x04, 0x11, 0x00, 0x00, 0x04,
+    0x11, 0x00, 0x00, 0x04, 0x01, 0x00, 0x00, 0x04, 0x01, 0x00, 0x00, 0x04,
+    0xF9, 0x8D, 0x7D, 0x04, 0xF9, 0xDD, 0xFD, 0x04, 0x19, 0xFC, 0xCD, 0x04,
+    0x19, 0xAC, 0xCD, 0x04, 0x19, 0xAC, 0xFD, 0x04, 0x19, 0x8C, 0x7D, 0x04,
+    0x19, 0x8C, 0x0D, 0x04, 0x19, 0x8C, 0x0D, 0x04, 0xF9, 0x8D, 0x0D, 0x04,
+    0xF9, 0x8D, 0x0D, 0x04, 0x01, 0x00, 0x00, 0x04, 0x01, 0x00, 0x00, 0x04,
+    0x01, 0x00, 0x00, 0x04, 0x01, 0x00, 0x00, 0x04, 0x03, 0x00, 0x00, 0x02,
+    0x06, 0x00, 0x00, 0x03, 0xFC, 0xFF, 0xFF, 0x00
+};
+
+//=========================== OVERRIDDEN PUBLIC FUNCTIONS =========================
+
+//save the name and effect theme color during initialization
+Effect_Compressor::Effect_Compressor(RGB_LED::COLOR _theme_color, App_String _name):
+    name(_name),
+    theme_color(_theme_color),
+    threshold(App_Strings::LABEL_THRESHOLD, -40, 0, 1, -18, 0, App_Strings::UNITS_DB.c_str()),
+    ratio(App_Strings::LABEL_RATIO, 1, 20, 0.5, 4, 1, App_Strings::UNITS_RATIO.c_str()),
+    knee(App_Strings::LABEL_KNEE, 0, 12, 1, 6, 0, App_Strings::UNITS_DB.c_str()),
+    attack(App_Strings::LABEL_ATTACK, 0.1, 50, 0.1, 5, 1, App_Strings::UNITS_MS.c_str()),
+    release(App_Strings::LABEL_RELEASE, 10, 1000, 10, 100, 0, App_Strings::UNITS_MS.c_str()),
+    effect_edit(to_return_page, leds, encs) //initialize our edit page implementation
+{
+    //set the header text and theme color for the effects edit menu
+    effect_edit.set_display_text(App_Strings::EDIT_COMPRESSOR);
+    effect_edit.set_LED_color(theme_color);
+
+    //set the parameters to edit/render in the edit menu
+    effect_edit.set_render_parmeter(&threshold, 0);
+    effect_edit.set_render_parmeter(&ratio, 1);
+    effect_edit.set_render_parmeter(&knee, 2);
+    effect_edit.set_render_parmeter(&attack, 3);
+    effect_edit.set_render_parmeter(&release, 4);
+}
+
+//################# CORE OF THE EFFECT ###################
+
+void Effect_Compressor::audio_update(const Audio_Block_t& block_in, Audio_Block_t& block_out) {
+    //synchronize our parameters for reading/rendering
+    threshold.synchronize();
+    ratio.synchronize();
+    knee.synchronize();
+    attack.synchronize();
+    release.synchronize();
+
+    //reconfigure the compressor if anything has changed
+    //only does floating point math when a parameter actually moves
+    std::array<float, 5> params = {threshold.get(), ratio.get(), knee.get(), attack.get(), release.get()};
+    if(params != computed_params) {
+        computed_params = params;
+        dynamics.set_compressor(threshold.get(), ratio.get(), knee.get(), attack.get(), release.get());
+    }
+
+    //and run the compressor + limiter
+    dynamics.process(block_in, block_out);
+}
+
+//################# end CORE OF THE EFFECT ###################
+
+App_String Effect_Compressor::get_name() { return name; }
+const Effect_Icon_t& Effect_Compressor::get_icon() { return icon; }
+RGB_LED::COLOR Effect_Compressor::get_theme_color() { return theme_color; }
+Effect_Parameter* Effect_Compressor::get_quick_edit_param() { return effect_edit.get_quick_edit_param(); }
+Effect_Parameter* Effect_Compressor::get_param(size_t index) { return effect_edit.get_render_parameter(index); }
+
+//=========================== OVERRIDDEN PRIVATE FUNCTIONS =========================
+
+//override our entry function --> call our default implementation
+//configuration of render resources
+void Effect_Compressor::impl_on_entry() {
+    //run the entry function in our edit menu implementation
+    effect_edit.configure_render_resources();
+}
+
+//override our exit function --> call our default implementation
+//release all the render resources
+void Effect_Compressor::impl_on_exit() {
+    //run the exit function in our edit menu implementation
+    effect_edit.release_render_resources();
+}
+
+void Effect_Compressor::draw() {
+    //call the render function of our edit menu implemenation
+    //pass it the global graphics handle
+    effect_edit.render(graphics_handle);
+}
@@ -0,0 +1,68 @@
+#pragma once
+
+/**
+ * Compressor + brickwall limiter
+ *  - threshold, ratio, knee, attack, and release on their own encoders
+ *
+ * All the processing lives in `Dynamics_Processor`:
+ *      \--> compressor gain computer runs on log2 tables, no libm calls in the audio update
+ *      \--> limiter after the compressor is always on, with a short lookahead it guarantees the output never clips
+ *      \--> put this last in the chain to run hotter effects before it without hard clipping at the output
+ *
+ * Latency is `COMP_LOOKAHEAD + LIMIT_LOOKAHEAD - 1` samples (~1.3ms)
+*/
+
+#include <array>
+#include <string>
+
+#include <effect_interface.h> //implements interface specified here
+#include <effect_edit/default_effect_edit_impl.h> //effect menu implementation
+#include <effect_param_num_lin.h>   //              ""
+#include <effect_dsp/dynamics_processor.h> //does all the actual work
+
+class Effect_Compressor : public Effect_Interface {
+public:
+    //save the theme color and name the effect was registered with
+    Effect_Compressor(RGB_LED::COLOR _theme_color, App_String _name);
+
+    //provide implementations for the following functions:
+    void audio_update(const Audio_Block_t& block_in, Audio_Block_t& block_out) override;
+    App_String get_name() override;
+    const Effect_Icon_t& get_icon() override;
+    RGB_LED::COLOR get_theme_color() override;
+    Effect_Parameter* get_quick_edit_param() override;
+    Effect_Parameter* get_param(size_t index) override;
+
+    //icon for the effect, constant for all instances
+    //public so the effect registry can point at it without an instance
+    static const Effect_Icon_t icon;
+
+private:
+    //define the implementations for the effect edit menu
+    //will use the `default_effect_edit_implementation` to handle editing and rendering our parameter menu
+    void draw() override;
+    void impl_on_entry() override;
+    void impl_on_exit() override;
+
+    //have a particular name and theme for our instance
+    const App_String name;
+    const RGB_LED::COLOR theme_color;
+
+    //parameters of the effect
+    Effect_Parameter_Num_Lin threshold;     //dBFS
+    Effect_Parameter_Num_Lin ratio;         //x:1
+    Effect_Parameter_Num_Lin knee;          //dB
+    Effect_Parameter_Num_Lin attack;        //ms
+    Effect_Parameter_Num_Lin release;       //ms
+
+    //parameter values the processor was last configured with
+    //start with bogus values to force a computation
+    std::array<float, 5> computed_params = {-1000, -1000, -1000, -1000, -1000};
+
+    //compressor and limiter
+    Dynamics_Processor dynamics;
+
+    //have an instance of our `default_effect_edit_impl`
+    //to actually handle our edit menu
+    Default_Effect_Edit_Impl effect_edit;
+};
@@ -0,0 +1,143 @@
+#include <effect_delay.h>
+
+#include <string.h> //memset
+
+//=========================== STATIC MEMBER VARIABLES =======================
+
+const Effect_Icon_t Effect_Delay::icon = {
+    0xFC, 0xFF, 0xFF, 0x01, 0x06, 0x00, 0x00, 0x03, 0x03, 0x00, 0x00, 0x06,
+    0x01, 0x00, 0x00, 0x04, 0x01, 0x00, 0x00, 0x04, 0x11, 0x00, 0x00, 0x04,
+    0x11, 0x00, 0x00, 0x04, 0x11, 0x00, 0x00, 0x04, 0x11, 0x00, 0x00, 0x04,
+    0x11, 0x00, 0x00, 0x04, 0x51, 0x00, 0x00, 0x04, 0x51, 0x00, 0x00, 0x04,
+    0x51, 0x00, 0x00, 0x04, 0x51, 0x04, 0x00, 0x04, 0x51, 0x04, 0x00, 0x04,
+    0x51, 0x44, 0x00, 0x04, 0x51, 0x44, 0x04, 0x04, 0x51, 0x44, 0x44, 0x04,
+    0x51, 0x44, 0x44, 0x04, 0xF9, 0xFF, 0xFF, 0x04, 0x11, 0x00, 0x00, 0x04,
+    0x11, 0x00, 0x00, 0x04, 0x01, 0x00, 0x00, 0x04, 0x01, 0x00, 0x00, 0x04,
+    0xF9, 0x18, 0x98, 0x05, 0xF9, 0x19, 0x98, 0x05, 0x99, 0x1B, 0x98, 0x05,
+    0x19, 0x1B, 0xF0, 0x04, 0x19, 0x1B, 0x60, 0x04, 0x19, 0x1B, 0x60, 0x04,
+    0x19, 0x1B, 0x60, 0x04, 0x99, 0x1B, 0x60, 0x04, 0xF9, 0xF9, 0x63, 0x04,
+    0xF9, 0xF8, 0x63, 0x04, 0x01, 0x00, 0x00, 0x04, 0x01, 0x00, 0x00, 0x04,
+    0x01, 0x00, 0x00, 0x04, 0x01, 0x00, 0x00, 0x04, 0x03, 0x00, 0x00, 0x02,
+    0x06, 0x00, 0x00, 0x03, 0xFC, 0xFF, 0xFF, 0x00
+};
+
+//=========================== OVERRIDDEN PUBLIC FUNCTIONS =========================
+
+//save the name and effect theme color during initialization
+Effect_Delay::Effect_Delay(RGB_LED::COLOR _theme_color, App_String _name):
+    name(_name),
+    theme_color(_theme_color),
+    delay_time(App_Strings::LABEL_TIME, MIN_DELAY_MS, max_delay_ms(), 5, 350, 0, App_Strings::UNITS_MS.c_str()),
+    feedback(App_Strings::LABEL_FEEDBACK, 0, 95, 1, 35, 0, App_Strings::UNITS_PERCENT.c_str()),
+    mix(App_Strings::LABEL_MIX, 0, 100, 1, 30, 0, App_Strings::UNITS_PERCENT.c_str()),
+    effect_edit(to_return_page, leds, encs) //initialize our edit page implementation
+{
+    //set the header text and theme color for the effects edit menu
+    effect_edit.set_display_text(App_Strings::EDIT_DELAY);
+    effect_edit.set_LED_color(theme_color);
+
+    //set the parameters to edit/render in the edit menu
+    effect_edit.set_render_parmeter(&delay_time, 1);
+    effect_edit.set_render_parmeter(&feedback, 2);
+    effect_edit.set_render_parmeter(&mix, 3);
+
+    //pressing the time encoder taps the tempo instead of leaving the edit page
+    effect_edit.set_press_action(1, Context_Callback_Function<void>(reinterpret_cast<void*>(this), tap_cb));
+}
+
+//make sure we don't leak the delay line if we get destroyed while still connected
+Effect_Delay::~Effect_Delay() {
+    disconnect();
+}
+
+//allocate and clear the delay line
+//runs with the audio update paused, so it's fine to take a moment zeroing the buffer
+void Effect_Delay::connect() {
+    if(delay_buffer != nullptr) return;
+
+    //room for the longest delay we support
+    size_t max_delay_samples = (size_t)max_delay_ms() * App_Constants::AUDIO_SAMPLE_RATE_HZ / 1000;
+    size_t len = Block_Delay_Line::buffer_length_for(max_delay_samples);
+
+    //put the buffer in PSRAM if it's fitted, otherwise internal RAM
+    delay_buffer_in_psram = (external_psram_size > 0);
+    if(delay_buffer_in_psram) delay_buffer = (int16_t*)extmem_malloc(len * sizeof(int16_t));
+    else delay_buffer = (int16_t*)malloc(len * sizeof(int16_t));
+    if(delay_buffer == nullptr) return; //couldn't get the memory, just pass audio through
+
+    //start off right at the configured delay time rather than gliding up from zero
+    memset(delay_buffer, 0, len * sizeof(int16_t));
+    delay_time.synchronize();
+    delay_line.attach(delay_buffer, len, delay_time.get() * App_Constants::AUDIO_SAMPLE_RATE_HZ / 1000.0f);
+}
+
+//free up the delay line
+void Effect_Delay::disconnect() {
+    if(delay_buffer == nullptr) return;
+    delay_line.detach();
+    if(delay_buffer_in_psram) extmem_free(delay_buffer);
+    else free(delay_buffer);
+    delay_buffer = nullptr;
+}
+
+//################# CORE OF THE EFFECT ###################
+
+void Effect_Delay::audio_update(const Audio_Block_t& block_in, Audio_Block_t& block_out) {
+    //synchronize our parameters for reading/rendering
+    delay_time.synchronize();
+    feedback.synchronize();
+    mix.synchronize();
+
+    //convert to samples and Q15, then let the delay line do the rest (passes audio through if we don't have a buffer)
+    delay_line.process(block_in, block_out, delay_time.get() * App_Constants::AUDIO_SAMPLE_RATE_HZ / 1000.0f,
+                        (int32_t)(feedback.get() * 327.67f), (int32_t)(mix.get() * 327.67f));
+}
+
+//################# end CORE OF THE EFFECT ###################
+
+//tap tempo --> set the delay time to the interval between two presses
+//if the presses are too far apart to be a valid delay time, treat this press as the first tap of a new pair
+void Effect_Delay::tap() {
+    uint32_t now = millis();
+    uint32_t interval = now - last_tap_ms;
+    last_tap_ms = now;
+
+    if(tap_pending && interval >= MIN_DELAY_MS && interval <= max_delay_ms()) {
+        delay_time.set((float)interval);
+        tap_pending = false;
+    }
+    else tap_pending = true;
+}
+
+//longest delay we support --> depends on whether we have PSRAM to put the delay line in
+uint32_t Effect_Delay::max_delay_ms() {
+    return (external_psram_size > 0) ? App_Constants::DELAY_MAX_TIME_PSRAM_MS : App_Constants::DELAY_MAX_TIME_RAM_MS;
+}
+
+App_String Effect_Delay::get_name() { return name; }
+const Effect_Icon_t& Effect_Delay::get_icon() { return icon; }
+RGB_LED::COLOR Effect_Delay::get_theme_color() { return theme_color; }
+Effect_Parameter* Effect_Delay::get_quick_edit_param() { return effect_edit.get_quick_edit_param(); }
+Effect_Parameter* Effect_Delay::get_param(size_t index) { return effect_edit.get_render_parameter(index); }
+
+//=========================== OVERRIDDEN PRIVATE FUNCTIONS =========================
+
+//override our entry function --> call our default implementation
+//configuration of render resources
+void Effect_Delay::impl_on_entry() {
+    //run the entry function in our edit menu implementation
+    effect_edit.configure_render_resources();
+}
+
+//override our exit function --> call our default implementation
+//release all the render resources
+void Effect_Delay::impl_on_exit() {
+    //run the exit function in our edit menu implementation
+    effect_edit.release_render_resources();
+}
+
+void Effect_Delay::draw() {
+    //call the render function of our edit menu implemenation
+    //pass it the global graphics handle
+    effect_edit.render(graphics_handle);
+}
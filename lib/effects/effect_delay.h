@@ -0,0 +1,85 @@
+#pragma once
+
+/**
+ * Long digital delay/echo
+ *  - delay time, feedback, and wet/dry mix on their own encoders
+ *  - pressing the time encoder taps in the delay time (interval between two presses)
+ *
+ * Delay line lives in PSRAM when it's fitted (falls back to a shorter buffer in internal RAM otherwise)
+ *      \--> buffer is only allocated while the effect is in the signal chain (i.e. between `connect()` and `disconnect()`)
+ *      \--> the DSP itself lives in `Block_Delay_Line`, which only touches the buffer a block at a time and glides the delay time
+*/
+
+#include <array>
+#include <string>
+
+#include <effect_interface.h> //implements interface specified here
+#include <effect_edit/default_effect_edit_impl.h> //effect menu implementation
+#include <effect_param_num_lin.h>   //              ""
+#include <effect_dsp/block_delay_line.h> //the delay line itself
+
+class Effect_Delay : public Effect_Interface {
+public:
+    //save the theme color and name the effect was registered with
+    Effect_Delay(RGB_LED::COLOR _theme_color, App_String _name);
+
+    //release the delay line if we still own one
+    ~Effect_Delay();
+
+    //allocate the delay line when we get added to the effect chain, free it when we're removed
+    void connect() override;
+    void disconnect() override;
+
+    //provide implementations for the following functions:
+    void audio_update(const Audio_Block_t& block_in, Audio_Block_t& block_out) override;
+    App_String get_name() override;
+    const Effect_Icon_t& get_icon() override;
+    RGB_LED::COLOR get_theme_color() override;
+    Effect_Parameter* get_quick_edit_param() override;
+    Effect_Parameter* get_param(size_t index) override;
+
+    //icon for the effect, constant for all instances
+    //public so the effect registry can point at it without an instance
+    static const Effect_Icon_t icon;
+
+private:
+    //define the implementations for the effect edit menu
+    //will use the `default_effect_edit_implementation` to handle editing and rendering our parameter menu
+    void draw() override;
+    void impl_on_entry() override;
+    void impl_on_exit() override;
+
+    //tap tempo --> runs when the time encoder is pressed
+    void tap();
+    static inline void tap_cb(void* context) { reinterpret_cast<Effect_Delay*>(context)->tap(); }
+
+    //longest delay we support given whether or not PSRAM is fitted
+    static uint32_t max_delay_ms();
+
+    //have a particular name and theme for our instance
+    const App_String name;
+    const RGB_LED::COLOR theme_color;
+
+    //keep the read span well clear of the block we're about to write
+    static constexpr float MIN_DELAY_MS = 20;
+
+    //parameters of the effect
+    Effect_Parameter_Num_Lin delay_time;    //ms
+    Effect_Parameter_Num_Lin feedback;      //percent
+    Effect_Parameter_Num_Lin mix;           //percent wet
+
+    //buffer for the delay line, and where it came from (so it goes back to the right place)
+    int16_t* delay_buffer = nullptr;
+    bool delay_buffer_in_psram = false;
+
+    //runs the delay on that buffer
+    Block_Delay_Line delay_line;
+
+    //when the time encoder was last pressed
+    uint32_t last_tap_ms = 0;
+    bool tap_pending = false;
+
+    //have an instance of our `default_effect_edit_impl`
+    //to actually handle our edit menu
+    Default_Effect_Edit_Impl effect_edit;
+};
@@ -0,0 +1,168 @@
+#include <effect_dsp/biquad_cascade.h>
+
+#include <math.h> //for coefficient design
+#include <limits> //for int32_t limits
+#include <dspinst.h> //for saturating instructions
+
+//start off with every section as a passthrough
+Biquad_Cascade::Biquad_Cascade(size_t _num_sections):
+    num_sections(min(max(_num_sections, (size_t)1), MAX_SECTIONS))
+{
+    for(auto& set : coeff_sets) set.fill(design_passthrough());
+}
+
+void Biquad_Cascade::reset() {
+    state_x1.fill(0);
+    state_x2.fill(0);
+}
+
+//################# COEFFICIENT DOUBLE BUFFERING ###################
+
+//the set that the audio update *isn't* using
+Biquad_Cascade::Coeff_Set_t& Biquad_Cascade::get_staging_coeffs() {
+    return coeff_sets[active_set ^ 1];
+}
+
+//flip the active set; audio update will pick the new one up at the start of its next block
+//audio update runs at a higher priority than anything calling this, so it'll never be caught mid-block with the old set
+void Biquad_Cascade::publish_coeffs() {
+    active_set ^= 1;
+}
+
+//################# CORE OF THE FILTER ###################
+
+void Biquad_Cascade::process(const Audio_Block_t& block_in, Audio_Block_t& block_out) {
+    //latch the active coefficient set for the entire block
+    const Coeff_Set_t& coeffs = coeff_sets[active_set];
+
+    //dispatch to the version of the loop specialized for our section count
+    switch(num_sections) {
+        case 1: process_sections<1>(coeffs, block_in, block_out); break;
+        case 2: process_sections<2>(coeffs, block_in, block_out); break;
+        case 3: process_sections<3>(coeffs, block_in, block_out); break;
+        default: process_sections<4>(coeffs, block_in, block_out); break;
+    }
+}
+
+template<size_t N>
+void Biquad_Cascade::process_sections(const Coeff_Set_t& coeffs, const Audio_Block_t& block_in, Audio_Block_t& block_out) {
+    static_assert(N <= MAX_SECTIONS, "Too many biquad sections!");
+
+    //pull the state into locals; with `N` fixed and the section loop unrolled, these get kept in registers
+    int32_t x1[N + 1], x2[N + 1];
+    for(size_t k = 0; k <= N; k++) {
+        x1[k] = state_x1[k];
+        x2[k] = state_x2[k];
+    }
+
+    for(size_t i = 0; i < block_in.size(); i++) {
+        //scale the sample up to give us some extra resolution and headroom between sections
+        int32_t sig = (int32_t)block_in[i] << SIGNAL_SHIFT;
+
+        //run the sample through every section
+        //output history of section k is the input history of section k+1
+        #pragma GCC unroll 4
+        for(size_t k = 0; k < N; k++) {
+            const Section_Coeffs& c = coeffs[k];
+            int64_t acc = (int64_t)1 << (COEFF_FRAC_BITS - 1); //rounding
+            acc += (int64_t)c.b0 * sig;
+            acc += (int64_t)c.b1 * x1[k];
+            acc += (int64_t)c.b2 * x2[k];
+            acc += (int64_t)c.neg_a1 * x1[k + 1];
+            acc += (int64_t)c.neg_a2 * x2[k + 1];
+
+            //shift the input history of this section
+            x2[k] = x1[k];
+            x1[k] = sig;
+
+            //section output, clamped rather than rolling over
+            acc >>= COEFF_FRAC_BITS;
+            if(acc > std::numeric_limits<int32_t>::max()) acc = std::numeric_limits<int32_t>::max();
+            if(acc < std::numeric_limits<int32_t>::min()) acc = std::numeric_limits<int32_t>::min();
+            sig = (int32_t)acc;
+        }
+
+        //shift the output history of the cascade
+        x2[N] = x1[N];
+        x1[N] = sig;
+
+        //drop back down to 16 bits, saturating
+        block_out[i] = (int16_t)signed_saturate_rshift(sig, 16, SIGNAL_SHIFT);
+    }
+
+    //save the state for the next block
+    for(size_t k = 0; k <= N; k++) {
+        state_x1[k] = x1[k];
+        state_x2[k] = x2[k];
+    }
+}
+
+//################# end CORE OF THE FILTER ###################
+
+//################# COEFFICIENT DESIGN ###################
+
+Biquad_Cascade::Section_Coeffs Biquad_Cascade::to_fixed(float b0, float b1, float b2, float a0, float a1, float a2) {
+    //normalize by a0, negate the feedback terms
+    const float scale = (float)(1UL << COEFF_FRAC_BITS) / a0;
+    return {
+        (int32_t)lroundf(b0 * scale),
+        (int32_t)lroundf(b1 * scale),
+        (int32_t)lroundf(b2 * scale),
+        (int32_t)lroundf(-a1 * scale),
+        (int32_t)lroundf(-a2 * scale)
+    };
+}
+
+Biquad_Cascade::Section_Coeffs Biquad_Cascade::design_passthrough() {
+    return {(int32_t)(1UL << COEFF_FRAC_BITS), 0, 0, 0, 0};
+}
+
+Biquad_Cascade::Section_Coeffs Biquad_Cascade::design_peak(float f_center, float q, float gain_db) {
+    const float A = powf(10.0f, gain_db / 40.0f);
+    const float w0 = TWO_PI * f_center / (float)App_Constants::AUDIO_SAMPLE_RATE_HZ;
+    const float cos_w0 = cosf(w0);
+    const float alpha = sinf(w0) / (2.0f * q);
+
+    return to_fixed(1.0f + alpha * A,   -2.0f * cos_w0,     1.0f - alpha * A,
+                    1.0f + alpha / A,   -2.0f * cos_w0,     1.0f - alpha / A);
+}
+
+//shelves use a slope of 1 --> Q of 1/sqrt(2)
+Biquad_Cascade::Section_Coeffs Biquad_Cascade::design_low_shelf(float f_corner, float gain_db) {
+    const float A = powf(10.0f, gain_db / 40.0f);
+    const float w0 = TWO_PI * f_corner / (float)App_Constants::AUDIO_SAMPLE_RATE_HZ;
+    const float cos_w0 = cosf(w0);
+    const float two_sqrtA_alpha = 2.0f * sqrtf(A) * sinf(w0) / (2.0f * M_SQRT1_2);
+
+    return to_fixed(A * ((A + 1) - (A - 1) * cos_w0 + two_sqrtA_alpha),
+                    2.0f * A * ((A - 1) - (A + 1) * cos_w0),
+                    A * ((A + 1) - (A - 1) * cos_w0 - two_sqrtA_alpha),
+                    (A + 1) + (A - 1) * cos_w0 + two_sqrtA_alpha,
+                    -2.0f * ((A - 1) + (A + 1) * cos_w0),
+                    (A + 1) + (A - 1) * cos_w0 - two_sqrtA_alpha);
+}
+
+Biquad_Cascade::Section_Coeffs Biquad_Cascade::design_high_shelf(float f_corner, float gain_db) {
+    const float A = powf(10.0f, gain_db / 40.0f);
+    const float w0 = TWO_PI * f_corner / (float)App_Constants::AUDIO_SAMPLE_RATE_HZ;
+    const float cos_w0 = cosf(w0);
+    const float two_sqrtA_alpha = 2.0f * sqrtf(A) * sinf(w0) / (2.0f * M_SQRT1_2);
+
+    return to_fixed(A * ((A + 1) + (A - 1) * cos_w0 + two_sqrtA_alpha),
+                    -2.0f * A * ((A - 1) + (A + 1) * cos_w0),
+                    A * ((A + 1) + (A - 1) * cos_w0 - two_sqrtA_alpha),
+                    (A + 1) - (A - 1) * cos_w0 + two_sqrtA_alpha,
+                    2.0f * ((A - 1) - (A + 1) * cos_w0),
+                    (A + 1) - (A - 1) * cos_w0 - two_sqrtA_alpha);
+}
+
+Biquad_Cascade::Section_Coeffs Biquad_Cascade::design_lowpass(float f_corner, float q) {
+    const float w0 = TWO_PI * f_corner / (float)App_Constants::AUDIO_SAMPLE_RATE_HZ;
+    const float cos_w0 = cosf(w0);
+    const float alpha = sinf(w0) / (2.0f * q);
+
+    return to_fixed((1.0f - cos_w0) / 2.0f, 1.0f - cos_w0,  (1.0f - cos_w0) / 2.0f,
+                    1.0f + alpha,           -2.0f * cos_w0, 1.0f - alpha);
+}
+
+//################# end COEFFICIENT DESIGN ###################
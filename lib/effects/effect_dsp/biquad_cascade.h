@@ -0,0 +1,93 @@
+#pragma once
+
+/*
+ * Fixed-point cascade of biquad filter sections, direct form I
+ *
+ * Runs all the sections in a single pass over the block:
+ *      \--> each sample goes through every section before we move onto the next sample
+ *      \--> sections share their delay lines (the output history of one section is the input history of the next)
+ *      \--> processing loop is specialized on the section count, so the filter state lives in registers for the whole block
+ *
+ * Numerical formats:
+ *      \--> coefficients are Q4.28 (shelves with a decent amount of boost can have coefficients past +/-2)
+ *      \--> signal between sections is int32_t, with the 16-bit samples shifted up by `SIGNAL_SHIFT` (i.e. extra resolution + headroom)
+ *      \--> 64-bit accumulators, output is saturated back to int16_t
+ *
+ * Coefficients are double-buffered:
+ *      \--> compute a new set into `get_staging_coeffs()` from outside the audio ISR, then call `publish_coeffs()`
+ *      \--> the audio update latches which set is active at the start of each block, so it never sees a half-written set
+ */
+
+#include <array>
+#include <Arduino.h>
+
+#include <config.h> //for audio block size and sample rate
+
+class Biquad_Cascade {
+public:
+    //state lives in registers, so keep the number of sections small; cascade multiple instances if more are needed
+    static constexpr size_t MAX_SECTIONS = 4;
+
+    //coefficients of a single section
+    //`a1` and `a2` are stored negated, so the difference equation is all multiply-accumulates
+    //  y[n] = b0*x[n] + b1*x[n-1] + b2*x[n-2] + neg_a1*y[n-1] + neg_a2*y[n-2]
+    struct Section_Coeffs {
+        int32_t b0;
+        int32_t b1;
+        int32_t b2;
+        int32_t neg_a1;
+        int32_t neg_a2;
+    };
+    typedef std::array<Section_Coeffs, MAX_SECTIONS> Coeff_Set_t;
+
+    //fractional bits of the coefficients
+    static constexpr uint32_t COEFF_FRAC_BITS = 28;
+
+    //how many extra bits of resolution the signal carries between sections
+    static constexpr uint32_t SIGNAL_SHIFT = 12;
+
+    //initialize the cascade with a particular number of sections (capped at `MAX_SECTIONS`)
+    //all sections start off as passthroughs
+    Biquad_Cascade(size_t _num_sections);
+
+    //run the cascade over a block of samples
+    //call this from the audio update
+    void process(const Audio_Block_t& block_in, Audio_Block_t& block_out);
+
+    //zero out the filter state
+    void reset();
+
+    //get the coefficient set that isn't being used by the audio update
+    //write new coefficients here, then call `publish_coeffs()` to swap them in
+    Coeff_Set_t& get_staging_coeffs();
+    void publish_coeffs();
+
+    //coefficient design helpers (RBJ audio EQ cookbook)
+    //frequencies in Hz, gains in dB
+    static Section_Coeffs design_passthrough();
+    static Section_Coeffs design_peak(float f_center, float q, float gain_db);
+    static Section_Coeffs design_low_shelf(float f_corner, float gain_db);
+    static Section_Coeffs design_high_shelf(float f_corner, float gain_db);
+    static Section_Coeffs design_lowpass(float f_corner, float q);
+
+private:
+    //run the filter with a fixed number of sections; lets the compiler unroll the section loop and keep state in registers
+    template<size_t N>
+    void process_sections(const Coeff_Set_t& coeffs, const Audio_Block_t& block_in, Audio_Block_t& block_out);
+
+    //normalize and convert floating point coefficients to our fixed point format
+    static Section_Coeffs to_fixed(float b0, float b1, float b2, float a0, float a1, float a2);
+
+    //how many sections we're running
+    const size_t num_sections;
+
+    //double-buffered coefficient sets, along with which one the audio update is using
+    std::array<Coeff_Set_t, 2> coeff_sets;
+    volatile uint32_t active_set = 0;
+
+    //delay lines shared between sections
+    //`state_x1[k]`/`state_x2[k]` are the last two inputs to section k (equivalently the last two outputs of section k-1)
+    //`state_x1[num_sections]`/`state_x2[num_sections]` are the last two outputs of the cascade
+    std::array<int32_t, MAX_SECTIONS + 1> state_x1 = {0};
+    std::array<int32_t, MAX_SECTIONS + 1> state_x2 = {0};
+};
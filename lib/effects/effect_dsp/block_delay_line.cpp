@@ -0,0 +1,105 @@
+#include <effect_dsp/block_delay_line.h>
+
+#include <dspinst.h> //for saturating instructions
+
+//=========================== STATIC MEMBER VARIABLES =======================
+
+Block_Delay_Line::Memory Block_Delay_Line::direct_memory;
+
+//=========================== PUBLIC FUNCTIONS =========================
+
+size_t Block_Delay_Line::buffer_length_for(size_t max_delay_samples) {
+    const size_t BLOCK_SIZE = App_Constants::PROCESSING_BLOCK_SIZE;
+    return ((max_delay_samples + BLOCK_SIZE + 2 + BLOCK_SIZE - 1) / BLOCK_SIZE) * BLOCK_SIZE;
+}
+
+Block_Delay_Line::Block_Delay_Line(Memory* _memory):
+    memory(_memory != nullptr ? _memory : &direct_memory)
+{}
+
+void Block_Delay_Line::attach(int16_t* _buffer, size_t len, float delay_samples) {
+    buffer = _buffer;
+    buffer_len = len;
+    write_pos = 0;
+    current_delay = (int32_t)delay_samples << DELAY_FRAC_BITS;
+}
+
+void Block_Delay_Line::detach() {
+    buffer = nullptr;
+    buffer_len = 0;
+}
+
+//################# CORE OF THE DELAY ###################
+
+void Block_Delay_Line::process(const Audio_Block_t& block_in, Audio_Block_t& block_out, float target_delay_samples, int32_t feedback_q15, int32_t wet_q15) {
+    //no delay line --> just pass the audio through
+    if(buffer == nullptr) {
+        block_out = block_in;
+        return;
+    }
+
+    const int32_t target_delay = (int32_t)target_delay_samples << DELAY_FRAC_BITS;
+    const int32_t dry_q15 = 32767 - wet_q15;
+
+    //glide the delay time towards the target, capping how far it can move in a single block
+    //always move by at least a little bit so we actually land on the target
+    const int32_t MAX_SLEW = MAX_SLEW_SAMPLES << DELAY_FRAC_BITS;
+    int32_t delay_step = (target_delay - current_delay) >> SMOOTHING_SHIFT;
+    if(delay_step == 0) delay_step = target_delay - current_delay;
+    delay_step = constrain(delay_step, -MAX_SLEW, MAX_SLEW);
+    const int32_t delay_start = current_delay;
+    const int32_t delay_end = current_delay + delay_step;
+    current_delay = delay_end;
+
+    /*
+     * Copy the span of history this block reads from into internal RAM
+     *      \--> sample `i` of the output reads from (write_pos + i - delay_i), where delay_i sweeps from `delay_start` to `delay_end`
+     *      \--> oldest sample we need is one before the longest delay, newest is one after the shortest delay
+     *      \--> span may wrap around the end of the delay line, in which case we do it in two copies
+     */
+    const size_t BLOCK_SIZE = block_in.size();
+    const int32_t longest_delay = max(delay_start, delay_end) >> DELAY_FRAC_BITS;
+    const int32_t shortest_delay = min(delay_start, delay_end) >> DELAY_FRAC_BITS;
+    const size_t span_len = BLOCK_SIZE + (longest_delay - shortest_delay) + 2;
+
+    int32_t span_start = (int32_t)write_pos - longest_delay - 1;
+    if(span_start < 0) span_start += buffer_len;
+
+    size_t first_copy = min(span_len, buffer_len - (size_t)span_start);
+    memory->read(buffer + span_start, history_span.data(), first_copy);
+    if(first_copy < span_len)
+        memory->read(buffer, history_span.data() + first_copy, span_len - first_copy);
+
+    //compute the delayed samples and mix them with the input
+    //build up the block to write back into the delay line while we're at it
+    Audio_Block_t to_write;
+    for(size_t i = 0; i < BLOCK_SIZE; i++) {
+        //delay for this sample, linearly interpolated across the block
+        int32_t delay_i = delay_start + (int32_t)((delay_step * (int32_t)(i + 1)) / (int32_t)BLOCK_SIZE);
+
+        //position of the sample to read relative to the start of the span
+        //`span_start` was computed with one sample of slack, so this is always positive
+        int32_t read_pos = (((int32_t)i + longest_delay + 1) << DELAY_FRAC_BITS) - delay_i;
+        int32_t idx = read_pos >> DELAY_FRAC_BITS;
+        int32_t frac = read_pos & ((1 << DELAY_FRAC_BITS) - 1);
+
+        //linear interpolation between the two neighboring samples
+        int32_t s0 = history_span[idx];
+        int32_t s1 = history_span[idx + 1];
+        int32_t wet = s0 + (((s1 - s0) * frac) >> DELAY_FRAC_BITS);
+
+        //mix wet and dry signals
+        int32_t dry = block_in[i];
+        block_out[i] = (int16_t)signed_saturate_rshift(dry * dry_q15 + wet * wet_q15, 16, 15);
+
+        //feed the delayed signal back into the line along with the input
+        to_write[i] = (int16_t)signed_saturate_rshift(dry * 32768 + wet * feedback_q15, 16, 15);
+    }
+
+    //write the block into the delay line in one go and advance
+    memory->write(buffer + write_pos, to_write.data(), BLOCK_SIZE);
+    write_pos += BLOCK_SIZE;
+    if(write_pos >= buffer_len) write_pos = 0;
+}
+
+//################# end CORE OF THE DELAY ###################
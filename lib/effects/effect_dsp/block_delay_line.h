@@ -0,0 +1,75 @@
+#pragma once
+
+/*
+ * Long feedback delay line that's only ever touched a block at a time, the engine behind the delay effect
+ *
+ * Samples live in a buffer handed over by the owner (PSRAM when it's fitted, see `Effect_Delay`)
+ *      \--> PSRAM is slow for scattered accesses, so every audio block does exactly one read and one write of the buffer:
+ *          \--> the span of history the output block needs is copied into internal RAM first, then interpolated out of there
+ *          \--> the block fed back into the line is built up in internal RAM and written with a single contiguous copy
+ *               (buffer length is a multiple of the block size, so this never wraps)
+ *      \--> both copies go through a `Memory`; the default is a plain `memcpy()`, the host benchmark swaps in a slow-memory model
+ *
+ * Delay time glides towards its target rather than jumping (avoids zipper noise/clicks when turning the knob or tapping)
+ *      \--> delay time is tracked in samples with `DELAY_FRAC_BITS` fractional bits, linearly interpolated between samples
+ *      \--> slew is capped at `MAX_SLEW_SAMPLES` per block, which also bounds the size of the history span we copy out
+ */
+
+#include <array>
+#include <string.h> //memcpy
+#include <Arduino.h>
+
+#include <config.h> //for audio block type
+
+class Block_Delay_Line {
+public:
+    //how the delay line gets at its buffer; only ever called with whole spans, never a sample at a time
+    class Memory {
+    public:
+        virtual ~Memory() {}
+        virtual void read(const int16_t* src, int16_t* dst, size_t len) { memcpy(dst, src, len * sizeof(int16_t)); }
+        virtual void write(int16_t* dst, const int16_t* src, size_t len) { memcpy(dst, src, len * sizeof(int16_t)); }
+    };
+
+    //delay time precision, along with how fast the delay time can change
+    static constexpr uint32_t DELAY_FRAC_BITS = 8;
+    static constexpr int32_t MAX_SLEW_SAMPLES = 32; //per block
+    static constexpr uint32_t SMOOTHING_SHIFT = 3;  //move 1/8th of the way to the target each block
+
+    //buffer length (in samples) needed for delays up to `max_delay_samples`
+    //room for the block we're writing and a little interpolation slack, rounded up to a whole number of blocks
+    static size_t buffer_length_for(size_t max_delay_samples);
+
+    //start off without a buffer; `process()` just passes audio through until one is attached
+    //`_memory` has to outlive the delay line; nullptr uses plain memory copies
+    Block_Delay_Line(Memory* _memory = nullptr);
+
+    //hand over a zeroed buffer of `len` samples (a multiple of the block size, see `buffer_length_for()`)
+    //and start the delay time at `delay_samples` rather than gliding up from zero
+    void attach(int16_t* _buffer, size_t len, float delay_samples);
+
+    //stop using the buffer; caller still owns it
+    void detach();
+
+    inline bool is_attached() { return buffer != nullptr; }
+
+    //run a block through the delay
+    //delay time in samples (floating point conversion happens here, once a block), gains in Q15
+    void process(const Audio_Block_t& block_in, Audio_Block_t& block_out, float target_delay_samples, int32_t feedback_q15, int32_t wet_q15);
+
+private:
+    //plain memory copies, used when nobody supplies a `Memory`
+    static Memory direct_memory;
+    Memory* memory;
+
+    //delay line, along with its length (in samples) and where the next block gets written
+    int16_t* buffer = nullptr;
+    size_t buffer_len = 0;
+    size_t write_pos = 0;
+
+    //current delay time in samples (fixed point with `DELAY_FRAC_BITS`)
+    int32_t current_delay = 0;
+
+    //scratch space in internal RAM for the history span the output block reads from
+    std::array<int16_t, App_Constants::PROCESSING_BLOCK_SIZE + MAX_SLEW_SAMPLES + 4> history_span;
+};
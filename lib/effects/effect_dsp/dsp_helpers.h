@@ -0,0 +1,96 @@
+#pragma once
+
+/*
+ * A couple extra DSP instruction wrappers that aren't provided by Teensy's `dspinst.h`
+ * Mostly the dual 16x16 multiply-accumulates with 64-bit accumulators (SMLALD/SMLALDX)
+ *      \--> lets us MAC two Q15 coefficients against two Q15 samples in a single cycle without worrying about accumulator overflow
+ * Along with some small fixed-point building blocks shared between effects and the level visualizer:
+ *      \--> exponential decay in Q1.31 (peak detectors, envelope followers, gain ramps)
+ *      \--> block peak detection, two samples at a time
+ *
+ * Fall back to plain C implementations when we aren't compiling for a DSP-extension core
+ */
+
+#include <math.h> //for computing decay coefficients
+#include <limits> //for fixed-point limits
+#include <Arduino.h>
+#include <dspinst.h> //for the rest of the DSP instructions
+
+#include <config.h> //for audio block type
+
+//computes sum += a[15:0]*b[15:0] + a[31:16]*b[31:16] with a 64-bit accumulator
+static inline int64_t dual_multiply_accumulate_16x16_64(int64_t sum, uint32_t a, uint32_t b) __attribute__((always_inline, unused));
+static inline int64_t dual_multiply_accumulate_16x16_64(int64_t sum, uint32_t a, uint32_t b)
+{
+#if defined (__ARM_ARCH_7EM__)
+	asm volatile("smlald %Q0, %R0, %1, %2" : "+r" (sum) : "r" (a), "r" (b));
+	return sum;
+#else
+	return sum + ((int16_t)(a & 0xFFFF) * (int16_t)(b & 0xFFFF)) + ((int16_t)(a >> 16) * (int16_t)(b >> 16));
+#endif
+}
+
+//computes sum += a[15:0]*b[31:16] + a[31:16]*b[15:0] with a 64-bit accumulator
+//i.e. the halfwords of `b` are exchanged before the multiply
+static inline int64_t dual_multiply_accumulate_exchange_16x16_64(int64_t sum, uint32_t a, uint32_t b) __attribute__((always_inline, unused));
+static inline int64_t dual_multiply_accumulate_exchange_16x16_64(int64_t sum, uint32_t a, uint32_t b)
+{
+#if defined (__ARM_ARCH_7EM__)
+	asm volatile("smlaldx %Q0, %R0, %1, %2" : "+r" (sum) : "r" (a), "r" (b));
+	return sum;
+#else
+	return sum + ((int16_t)(a & 0xFFFF) * (int16_t)(b >> 16)) + ((int16_t)(a >> 16) * (int16_t)(b & 0xFFFF));
+#endif
+}
+
+//takes a 64-bit Q15 accumulator (i.e. sum of Q15 x Q15 products), shifts it back to Q15 and saturates to int16_t
+static inline int16_t saturate_q15_from_64(int64_t sum) __attribute__((always_inline, unused));
+static inline int16_t saturate_q15_from_64(int64_t sum)
+{
+	int64_t shifted = sum >> 15;
+	if(shifted > 32767) return 32767;
+	if(shifted < -32768) return -32768;
+	return (int16_t)shifted;
+}
+
+//compute a per-step exponential decay coefficient in Q1.31 format
+//after `time_constant_sec` worth of steps (at `steps_per_sec`), a value multiplied by this every step will have decayed to 1/e
+//runs in floating point, so compute these outside the sample loop
+static inline int32_t compute_decay_q31(double time_constant_sec, double steps_per_sec) __attribute__((unused));
+static inline int32_t compute_decay_q31(double time_constant_sec, double steps_per_sec)
+{
+	double tau_steps = time_constant_sec * steps_per_sec;
+	double decay_per_step = (tau_steps > 0) ? exp((double)-1.0 / tau_steps) : 0;
+	return (int32_t)min((double)std::numeric_limits<int32_t>::max(), (double)(std::numeric_limits<int32_t>::max() + 1.0) * decay_per_step);
+}
+
+//decay a value towards zero by a single step with a coefficient from `compute_decay_q31()`
+//32-bit multiply + 32-bit shift, then an additional doubling since the coefficient only has 31 fractional bits
+static inline int32_t apply_decay_q31(int32_t value, int32_t decay) __attribute__((always_inline, unused));
+static inline int32_t apply_decay_q31(int32_t value, int32_t decay)
+{
+	return multiply_32x32_rshift32(value, decay) * 2;
+}
+
+//find the largest sample magnitude in a block
+//on DSP-extension cores, track the per-halfword max and min of sample pairs with SSUB16 + SEL (no branches)
+static inline int32_t block_peak_q15(const Audio_Block_t& block) __attribute__((unused));
+static inline int32_t block_peak_q15(const Audio_Block_t& block)
+{
+#if defined (__ARM_ARCH_7EM__)
+	const uint32_t* pairs = reinterpret_cast<const uint32_t*>(block.data());
+	uint32_t pair_max = pairs[0], pair_min = pairs[0];
+	for(size_t i = 1; i < block.size() / 2; i++) {
+		uint32_t x = pairs[i], diff;
+		asm volatile("ssub16 %0, %2, %3\n\tsel %1, %2, %3" : "=&r" (diff), "=r" (pair_max) : "r" (x), "r" (pair_max));
+		asm volatile("ssub16 %0, %2, %3\n\tsel %1, %3, %2" : "=&r" (diff), "=r" (pair_min) : "r" (x), "r" (pair_min));
+	}
+	int32_t hi = max((int32_t)(int16_t)(pair_max & 0xFFFF), (int32_t)(int16_t)(pair_max >> 16));
+	int32_t lo = min((int32_t)(int16_t)(pair_min & 0xFFFF), (int32_t)(int16_t)(pair_min >> 16));
+	return max(hi, -lo);
+#else
+	int32_t peak = 0;
+	for(const auto& sample : block) peak = max(peak, abs((int32_t)sample));
+	return peak;
+#endif
+}
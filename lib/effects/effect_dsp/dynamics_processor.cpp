@@ -0,0 +1,114 @@
+#include <effect_dsp/dynamics_processor.h>
+
+#include <effect_dsp/fixed_log2.h> //for the gain computer
+#include <effect_dsp/dsp_helpers.h> //for exponential decay
+#include <dspinst.h> //for saturating instructions
+
+//start off with the compressor as a passthrough and the limiter fully open
+Dynamics_Processor::Dynamics_Processor():
+    limit_ceiling((int32_t)(32767.0f * powf(10.0f, LIMIT_CEILING_DBFS / 20.0f))),
+    limit_ceiling_log2(Fixed_Log2::log2_q16(limit_ceiling)),
+    limit_release_decay(compute_decay_q31(LIMIT_RELEASE_MS / 1000.0, App_Constants::AUDIO_SAMPLE_RATE_HZ)),
+    limit_env(Fixed_Log2::ONE_Q16),
+    limit_env_sum(Fixed_Log2::ONE_Q16 * LIMIT_LOOKAHEAD)
+{
+    static_assert((LIMIT_LOOKAHEAD & (LIMIT_LOOKAHEAD - 1)) == 0, "Limiter lookahead must be a power of two!");
+    limit_env_history.fill(Fixed_Log2::ONE_Q16);
+    set_compressor(0, 1, 0, 1, 100);
+}
+
+//convert everything into fixed point
+void Dynamics_Processor::set_compressor(float threshold_db, float ratio, float knee_db, float attack_ms, float release_ms) {
+    threshold = Fixed_Log2::db_to_log2_q16(threshold_db);
+    knee_width = Fixed_Log2::db_to_log2_q16(knee_db);
+
+    float slope_f = 1.0f / max(ratio, 1.0f) - 1.0f;
+    slope = (int32_t)(slope_f * Fixed_Log2::ONE_Q16);
+    knee_scale = (knee_width > 0) ? (int32_t)(slope_f / (2.0f * knee_width / Fixed_Log2::ONE_Q16) * Fixed_Log2::ONE_Q16) : 0;
+
+    //makeup gain --> give back half of the reduction a full scale input would see
+    makeup = -compute_gain(0) / 2;
+
+    attack_decay = compute_decay_q31(attack_ms / 1000.0, App_Constants::AUDIO_SAMPLE_RATE_HZ);
+    release_decay = compute_decay_q31(release_ms / 1000.0, App_Constants::AUDIO_SAMPLE_RATE_HZ);
+}
+
+float Dynamics_Processor::get_gain_reduction_db() { return Fixed_Log2::log2_q16_to_db(comp_env); }
+
+//################# CORE OF THE PROCESSOR ###################
+
+void Dynamics_Processor::process(const Audio_Block_t& block_in, Audio_Block_t& block_out) {
+    for(size_t i = 0; i < block_in.size(); i++) {
+        //========== COMPRESSOR ==========
+        //detect on the undelayed input --> level in log2 units relative to full scale
+        int32_t sample = block_in[i];
+        int32_t level = Fixed_Log2::log2_q16(abs(sample)) - (15 << 16);
+
+        //run the static curve, then smooth the gain; attack when the gain is going down, release when it's coming back up
+        int32_t target = compute_gain(level);
+        int32_t decay = (target < comp_env) ? attack_decay : release_decay;
+        comp_env = target + apply_decay_q31(comp_env - target, decay);
+        int32_t comp_gain = Fixed_Log2::exp2_q16(comp_env + makeup);
+
+        //apply the gain to the delayed audio; keep all 32 bits so the limiter can see anything that would've clipped
+        int32_t delayed = comp_delay[comp_delay_pos];
+        comp_delay[comp_delay_pos] = (int16_t)sample;
+        if(++comp_delay_pos >= COMP_LOOKAHEAD) comp_delay_pos = 0;
+        int32_t compressed = (int32_t)(((int64_t)delayed * comp_gain) >> 16);
+
+        //========== LIMITER ==========
+        //gain this sample needs to sit at the ceiling; only bother with the log math when it's actually over
+        uint32_t magnitude = abs(compressed);
+        int32_t needed = Fixed_Log2::ONE_Q16;
+        if(magnitude > (uint32_t)limit_ceiling)
+            needed = Fixed_Log2::exp2_q16(limit_ceiling_log2 - Fixed_Log2::log2_q16(magnitude));
+
+        //sliding minimum over the lookahead window
+        //  \--> drop the oldest entry if it's fallen out of the window
+        //  \--> drop entries from the back that will never be the minimum again, then push this sample
+        if(min_queue_size > 0 && (sample_index - min_queue_index[min_queue_head]) >= LIMIT_LOOKAHEAD) {
+            min_queue_head = (min_queue_head + 1) & (LIMIT_LOOKAHEAD - 1);
+            min_queue_size--;
+        }
+        while(min_queue_size > 0 && min_queue_gain[(min_queue_head + min_queue_size - 1) & (LIMIT_LOOKAHEAD - 1)] >= needed)
+            min_queue_size--;
+        size_t tail = (min_queue_head + min_queue_size) & (LIMIT_LOOKAHEAD - 1);
+        min_queue_index[tail] = sample_index;
+        min_queue_gain[tail] = needed;
+        min_queue_size++;
+        sample_index++;
+        int32_t held = min_queue_gain[min_queue_head];
+
+        //follow the held gain down instantly, release back up exponentially
+        if(held < limit_env) limit_env = held;
+        else limit_env = held + apply_decay_q31(limit_env - held, limit_release_decay);
+
+        //moving average over the window; rounds down so it never lets through more than the window allows
+        size_t history_pos = sample_index & (LIMIT_LOOKAHEAD - 1);
+        limit_env_sum += limit_env - limit_env_history[history_pos];
+        limit_env_history[history_pos] = limit_env;
+        int32_t limit_gain = limit_env_sum / (int32_t)LIMIT_LOOKAHEAD;
+
+        //apply to the compressor output from one less than the window ago
+        int32_t limit_delayed = limit_delay[limit_pos];
+        limit_delay[limit_pos] = compressed;
+        if(++limit_pos >= limit_delay.size()) limit_pos = 0;
+        block_out[i] = (int16_t)signed_saturate_rshift((int32_t)(((int64_t)limit_delayed * limit_gain) >> 16), 16, 0);
+    }
+}
+
+//static curve of the compressor, all in log2 units
+//  \--> below the knee: no gain change
+//  \--> inside the knee: quadratic blend, slope * (over + W/2)^2 / 2W
+//  \--> above the knee: slope * over
+int32_t Dynamics_Processor::compute_gain(int32_t level) const {
+    int32_t over = level - threshold;
+    if(2 * over <= -knee_width) return 0;
+    if(2 * over < knee_width) {
+        int64_t t = over + knee_width / 2;
+        return (int32_t)((((t * t) >> 16) * knee_scale) >> 16);
+    }
+    return (int32_t)(((int64_t)slope * over) >> 16);
+}
+
+//################# end CORE OF THE PROCESSOR ###################
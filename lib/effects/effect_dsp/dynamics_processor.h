@@ -0,0 +1,90 @@
+#pragma once
+
+/*
+ * Lookahead compressor followed by a brickwall limiter
+ *
+ * Compressor stage:
+ *      \--> gain computer runs in the log domain (Q16.16 log2 units via `Fixed_Log2`), no libm calls in the audio update
+ *      \--> threshold + ratio with a quadratic soft knee, automatic makeup gain of half the reduction at full scale
+ *      \--> gain reduction is smoothed with separate attack/release time constants (Q1.31 exponential decay)
+ *      \--> audio is delayed by `COMP_LOOKAHEAD` samples, so the gain starts moving slightly before a transient arrives
+ *
+ * Limiter stage (always on, fixed ceiling):
+ *      \--> runs on the 32-bit compressor output, so it can pull back signals that would've clipped
+ *      \--> required gain for each sample is min-held over the lookahead window, released exponentially,
+ *           then averaged over the same window
+ *      \--> with the audio delayed by one less than the window, every sample sees a gain at or below the one it needs
+ *           i.e. the output never exceeds the ceiling
+ *
+ * Parameters are set from floating point values (outside the sample loop); everything per-sample is fixed point
+ */
+
+#include <array>
+#include <Arduino.h>
+
+#include <config.h> //for audio block type and sample rate
+
+class Dynamics_Processor {
+public:
+    //lookahead (in samples) of each stage; total latency is `COMP_LOOKAHEAD + LIMIT_LOOKAHEAD - 1`
+    static constexpr size_t COMP_LOOKAHEAD = 32;
+    static constexpr size_t LIMIT_LOOKAHEAD = 32;
+
+    //limiter ceiling and release; ceiling leaves a little margin for table interpolation error
+    static constexpr float LIMIT_CEILING_DBFS = -0.3f;
+    static constexpr float LIMIT_RELEASE_MS = 50.0f;
+
+    //start off with the compressor doing nothing
+    Dynamics_Processor();
+
+    //set up the compressor stage
+    //threshold and knee width in dB, attack and release time constants in ms
+    void set_compressor(float threshold_db, float ratio, float knee_db, float attack_ms, float release_ms);
+
+    //run a block through the compressor and limiter
+    void process(const Audio_Block_t& block_in, Audio_Block_t& block_out);
+
+    //current gain reduction of the compressor stage in dB (for metering)
+    float get_gain_reduction_db();
+
+private:
+    //static curve of the compressor, in Q16.16 log2 units
+    //takes the input level, returns the gain (<= 0)
+    int32_t compute_gain(int32_t level) const;
+
+    //compressor coefficients (Q16.16 log2 units unless otherwise noted)
+    int32_t threshold = 0;
+    int32_t knee_width = 0;
+    int32_t slope = 0;          //1/ratio - 1, Q16.16
+    int32_t knee_scale = 0;     //slope / (2 * knee_width), Q16.16
+    int32_t makeup = 0;
+    int32_t attack_decay = 0;   //Q1.31
+    int32_t release_decay = 0;  //Q1.31
+
+    //compressor state
+    int32_t comp_env = 0;   //smoothed gain, Q16.16 log2 units
+    std::array<int16_t, COMP_LOOKAHEAD> comp_delay = {0};
+    size_t comp_delay_pos = 0;
+
+    //limiter coefficients
+    const int32_t limit_ceiling;        //Q15 magnitude
+    const int32_t limit_ceiling_log2;   //Q16.16 log2 units
+    const int32_t limit_release_decay;  //Q1.31
+
+    //limiter state
+    //  \--> monotonic queue of (sample index, required gain) for the sliding minimum
+    //  \--> released gain, and a running sum over the lookahead window for the moving average
+    //  \--> delay line for the compressor output
+    std::array<uint32_t, LIMIT_LOOKAHEAD> min_queue_index = {0};
+    std::array<int32_t, LIMIT_LOOKAHEAD> min_queue_gain = {0};
+    size_t min_queue_head = 0;
+    size_t min_queue_size = 0;
+    uint32_t sample_index = 0;
+
+    int32_t limit_env;
+    std::array<int32_t, LIMIT_LOOKAHEAD> limit_env_history;
+    int32_t limit_env_sum;
+
+    std::array<int32_t, LIMIT_LOOKAHEAD - 1> limit_delay = {0};
+    size_t limit_pos = 0;
+};
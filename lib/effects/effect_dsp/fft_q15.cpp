@@ -0,0 +1,126 @@
+#include <effect_dsp/fft_q15.h>
+
+#include <math.h> //for sinf, cosf (only when computing tables)
+#include <dspinst.h> //for saturating shifts
+
+//============================ STATIC MEMBER DEFINITIONS ========================
+
+std::array<int16_t, FFT_Q15::MAX_SIZE * 3 / 2> FFT_Q15::twiddles = {0};
+bool FFT_Q15::twiddles_computed = false;
+
+//================================================ PUBLIC FUNCTIONS ============================================
+
+//work out how many radix-4 stages we need, and how far to step through the twiddle table
+FFT_Q15::FFT_Q15(size_t _size):
+    size(_size)
+{
+    num_stages = 0;
+    for(size_t n = size; n > 1; n >>= 2) num_stages++;
+    twiddle_stride = MAX_SIZE / size;
+
+    if(!twiddles_computed) compute_twiddles();
+}
+
+void FFT_Q15::transform(int16_t* data) {
+    //every stage runs `size/4` butterflies, spanning `quarter` complex samples
+    //go twiddle-by-twiddle so each set of twiddles gets loaded once per stage
+    size_t quarter = size >> 2;
+    size_t stride = twiddle_stride;
+    for(size_t stage = 0; stage < num_stages; stage++) {
+        for(size_t k = 0; k < quarter; k++) {
+            //W^k, W^2k, W^3k (stored as cos, sin; W = cos - j*sin)
+            int32_t c1 = twiddles[2 * k * stride],      s1 = twiddles[2 * k * stride + 1];
+            int32_t c2 = twiddles[4 * k * stride],      s2 = twiddles[4 * k * stride + 1];
+            int32_t c3 = twiddles[6 * k * stride],      s3 = twiddles[6 * k * stride + 1];
+
+            for(size_t base = k; base < size; base += quarter << 2) {
+                int16_t* x0 = data + 2 * base;
+                int16_t* x1 = x0 + 2 * quarter;
+                int16_t* x2 = x1 + 2 * quarter;
+                int16_t* x3 = x2 + 2 * quarter;
+
+                //sums and differences of opposite inputs
+                int32_t t0r = x0[0] + x2[0], t0i = x0[1] + x2[1];
+                int32_t t1r = x0[0] - x2[0], t1i = x0[1] - x2[1];
+                int32_t t2r = x1[0] + x3[0], t2i = x1[1] + x3[1];
+                int32_t t3r = x1[0] - x3[0], t3i = x1[1] - x3[1];
+
+                //4-point DFT, scaled by 1/4 (can't overflow: every output is at most the average of the input magnitudes)
+                int32_t y0r = (t0r + t2r) >> 2, y0i = (t0i + t2i) >> 2;
+                int32_t y1r = (t1r + t3i) >> 2, y1i = (t1i - t3r) >> 2;
+                int32_t y2r = (t0r - t2r) >> 2, y2i = (t0i - t2i) >> 2;
+                int32_t y3r = (t1r - t3i) >> 2, y3i = (t1i + t3r) >> 2;
+
+                x0[0] = y0r;
+                x0[1] = y0i;
+
+                //first twiddle of every stage is 1, skip the multiply (and the rounding error from 32767/32768)
+                if(k == 0) {
+                    x1[0] = y1r; x1[1] = y1i;
+                    x2[0] = y2r; x2[1] = y2i;
+                    x3[0] = y3r; x3[1] = y3i;
+                    continue;
+                }
+
+                //(yr + j*yi) * (c - j*s) = (yr*c + yi*s) + j*(yi*c - yr*s)
+                x1[0] = signed_saturate_rshift(y1r * c1 + y1i * s1, 16, 15);
+                x1[1] = signed_saturate_rshift(y1i * c1 - y1r * s1, 16, 15);
+                x2[0] = signed_saturate_rshift(y2r * c2 + y2i * s2, 16, 15);
+                x2[1] = signed_saturate_rshift(y2i * c2 - y2r * s2, 16, 15);
+                x3[0] = signed_saturate_rshift(y3r * c3 + y3i * s3, 16, 15);
+                x3[1] = signed_saturate_rshift(y3i * c3 - y3r * s3, 16, 15);
+            }
+        }
+
+        //next stage works on sub-transforms a quarter as long
+        quarter >>= 2;
+        stride <<= 2;
+    }
+
+    digit_reverse(data);
+}
+
+//power fits in 32 bits: at most 2 * (2^15)^2
+void FFT_Q15::magnitude_squared(const int16_t* data, uint32_t* power, size_t bins) {
+    for(size_t i = 0; i < bins; i++) {
+        int32_t re = data[2 * i];
+        int32_t im = data[2 * i + 1];
+        power[i] = (uint32_t)(re * re) + (uint32_t)(im * im);
+    }
+}
+
+//0.5 * (1 - cos(2*pi*n/length)), periodic form so it sums cleanly across overlapping frames
+void FFT_Q15::make_hann_window(int16_t* window, size_t length) {
+    for(size_t n = 0; n < length; n++)
+        window[n] = (int16_t)lroundf(16383.5f * (1.0f - cosf(2.0f * (float)M_PI * n / length)));
+}
+
+//====================================== PRIVATE FUNCTIONS ====================================
+
+//decimation in frequency leaves the output with its base-4 digits reversed
+void FFT_Q15::digit_reverse(int16_t* data) {
+    for(size_t i = 0; i < size; i++) {
+        size_t j = 0;
+        size_t n = i;
+        for(size_t d = 0; d < num_stages; d++) {
+            j = (j << 2) | (n & 0x3);
+            n >>= 2;
+        }
+
+        //only swap each pair once
+        if(j > i) {
+            std::swap(data[2 * i], data[2 * j]);
+            std::swap(data[2 * i + 1], data[2 * j + 1]);
+        }
+    }
+}
+
+//only done once, the first time an instance is constructed
+void FFT_Q15::compute_twiddles() {
+    for(size_t k = 0; k < twiddles.size() / 2; k++) {
+        float theta = 2.0f * (float)M_PI * k / MAX_SIZE;
+        twiddles[2 * k] = (int16_t)lroundf(32767.0f * cosf(theta));
+        twiddles[2 * k + 1] = (int16_t)lroundf(32767.0f * sinf(theta));
+    }
+    twiddles_computed = true;
+}
@@ -0,0 +1,52 @@
+#pragma once
+
+/*
+ * Fixed-point complex FFT, radix-4 decimation in frequency
+ *
+ * Data format:
+ *      \--> interleaved complex Q15 (real, imaginary, real, imaginary, ...), transformed in place
+ *      \--> every stage scales by 1/4 so nothing can overflow, i.e. the output is the DFT scaled by 1/size
+ *      \--> output comes back in natural order (the digit reversal is done at the end of `transform()`)
+ *
+ * Twiddle factors come out of a single table sized for `MAX_SIZE`; smaller transforms just stride through it
+ *      \--> table is shared between all instances and computed once, the first time any instance is constructed
+ *
+ * Sizes have to be powers of 4 (16, 64, 256, 1024)
+ * No floating point in `transform()`, so it's fine to call from the audio update if a transform is ever needed there
+ */
+
+#include <array>
+#include <Arduino.h>
+
+class FFT_Q15 {
+public:
+    //largest transform the twiddle table supports
+    static constexpr size_t MAX_SIZE = 1024;
+
+    //`_size` needs to be a power of 4, no bigger than `MAX_SIZE`
+    FFT_Q15(size_t _size);
+
+    //forward transform, in place on `2 * size` interleaved samples
+    void transform(int16_t* data);
+
+    //squared magnitude of every bin in a transformed buffer, `bins` of them starting from DC
+    static void magnitude_squared(const int16_t* data, uint32_t* power, size_t bins);
+
+    //fill a Q15 Hann window of length `length`
+    static void make_hann_window(int16_t* window, size_t length);
+
+    inline size_t get_size() { return size; }
+
+private:
+    const size_t size;
+    size_t num_stages;
+    size_t twiddle_stride; //step through the shared table for a transform smaller than `MAX_SIZE`
+
+    //reorder the output from digit-reversed into natural order
+    void digit_reverse(int16_t* data);
+
+    //cos(2*pi*k/MAX_SIZE), sin(2*pi*k/MAX_SIZE) pairs; the largest index the butterflies need is 3/4 around the circle
+    static std::array<int16_t, MAX_SIZE * 3 / 2> twiddles;
+    static bool twiddles_computed;
+    static void compute_twiddles();
+};
@@ -0,0 +1,112 @@
+#include <effect_dsp/fir_direct_q15.h>
+
+#include <string.h> //memcpy, memmove, memset
+#include <limits> //for int16_t limits
+#include <effect_dsp/dsp_helpers.h> //for the dual MAC instructions
+
+//start with a passthrough kernel
+FIR_Direct_Q15::FIR_Direct_Q15() {
+    const int16_t passthrough = std::numeric_limits<int16_t>::max();
+    set_kernel(App_Span<const int16_t>(&passthrough, 1));
+}
+
+void FIR_Direct_Q15::set_kernel(App_Span<const int16_t> taps) {
+    load(kernels[active_kernel], taps);
+    num_taps = kernels[active_kernel].num_taps;
+
+    //old samples won't line up with the new kernel length anymore
+    reset();
+}
+
+void FIR_Direct_Q15::stage_kernel(App_Span<const int16_t> taps) {
+    load(kernels[active_kernel ^ 1], taps);
+}
+
+//flip the active kernel; audio update will pick the new one up at the start of its next block
+//audio update runs at a higher priority than anything calling this, so it'll never be caught mid-block with the old kernel
+void FIR_Direct_Q15::publish_kernel() {
+    active_kernel ^= 1;
+}
+
+void FIR_Direct_Q15::load(Kernel& kernel, App_Span<const int16_t> taps) {
+    //truncate the kernel if necessary, then round up to an even number of taps
+    size_t len = min(taps.size(), MAX_TAPS);
+    kernel.num_taps = (len + 1) & ~((size_t)1);
+    if(kernel.num_taps == 0) kernel.num_taps = 2;
+
+    //store the taps time-reversed; zero-pad at the front (i.e. the oldest position) if we have an odd count
+    kernel.taps.fill(0);
+    for(size_t i = 0; i < len; i++)
+        kernel.taps[kernel.num_taps - 1 - i] = taps[i];
+}
+
+void FIR_Direct_Q15::reset() {
+    history.fill(0);
+}
+
+size_t FIR_Direct_Q15::get_num_taps() { return num_taps; }
+
+//################# CORE OF THE FILTER ###################
+
+void FIR_Direct_Q15::process(const Audio_Block_t& block_in, Audio_Block_t& block_out) {
+    //latch the active kernel for the entire block
+    const Kernel& kernel = kernels[active_kernel];
+
+    //a kernel of a different length got published --> realign the history so the newest samples stay just before the block
+    //shorter: drop the oldest samples; longer: shift up and zero what we never kept
+    if(kernel.num_taps != num_taps) {
+        if(kernel.num_taps < num_taps)
+            memmove(history.data(), history.data() + (num_taps - kernel.num_taps), (kernel.num_taps - 1) * sizeof(int16_t));
+        else {
+            memmove(history.data() + (kernel.num_taps - num_taps), history.data(), (num_taps - 1) * sizeof(int16_t));
+            memset(history.data(), 0, (kernel.num_taps - num_taps) * sizeof(int16_t));
+        }
+        num_taps = kernel.num_taps;
+    }
+
+    //drop the new block right after the (num_taps - 1) old samples
+    int16_t* const block_start = history.data() + num_taps - 1;
+    memcpy(block_start, block_in.data(), sizeof(block_in));
+
+    //grab our taps as packed pairs
+    const uint32_t* const taps_packed = (const uint32_t*)kernel.taps.data();
+    const size_t num_tap_pairs = num_taps >> 1;
+
+    //compute 4 outputs per pass
+    //output `n` is the dot product of the reversed taps with history[n : n + num_taps]
+    for(size_t n = 0; n < block_out.size(); n += 4) {
+        //history window starts at an even index, so we can pull samples out in aligned pairs
+        const uint32_t* samples = (const uint32_t*)(history.data() + n);
+
+        int64_t acc0 = 0, acc1 = 0, acc2 = 0, acc3 = 0;
+        uint32_t x0 = samples[0]; //history[n+j],   history[n+j+1]
+        uint32_t x2 = samples[1]; //history[n+j+2], history[n+j+3]
+
+        for(size_t j = 0; j < num_tap_pairs; j++) {
+            const uint32_t taps = taps_packed[j]; //kernel.taps[2j] in the bottom, kernel.taps[2j+1] in the top
+            const uint32_t x4 = samples[j + 2]; //history[n+j+4], history[n+j+5]
+
+            //even outputs line up with our sample words directly
+            //odd outputs need the sample pair straddling two words --> pack and use the exchange variant of the MAC
+            acc0 = dual_multiply_accumulate_16x16_64(acc0, taps, x0);
+            acc1 = dual_multiply_accumulate_exchange_16x16_64(acc1, taps, pack_16t_16b(x0, x2));
+            acc2 = dual_multiply_accumulate_16x16_64(acc2, taps, x2);
+            acc3 = dual_multiply_accumulate_exchange_16x16_64(acc3, taps, pack_16t_16b(x2, x4));
+
+            //slide the window forward by a pair of samples
+            x0 = x2;
+            x2 = x4;
+        }
+
+        //taps are Q15 --> shift back down and saturate rather than roll over
+        block_out[n]     = saturate_q15_from_64(acc0);
+        block_out[n + 1] = saturate_q15_from_64(acc1);
+        block_out[n + 2] = saturate_q15_from_64(acc2);
+        block_out[n + 3] = saturate_q15_from_64(acc3);
+    }
+
+    //move the most recent (num_taps - 1) samples to the front of the history for the next block
+    memmove(history.data(), history.data() + block_out.size(), (num_taps - 1) * sizeof(int16_t));
+}
+
+//################# end CORE OF THE FILTER ###################
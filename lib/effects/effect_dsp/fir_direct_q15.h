@@ -0,0 +1,81 @@
+#pragma once
+
+/*
+ * Block-based direct-form FIR filter with Q15 taps, meant for short-ish kernels (up to a few hundred taps, e.g. cabinet IRs)
+ *
+ * Rather than a circular sample buffer (which needs a wraparound check per tap), we keep a contiguous "linearized" history:
+ *      \--> [ (num_taps - 1) previous samples | current block of samples | some slack ]
+ *      \--> every output of the block can be computed with a straight run through memory
+ *      \--> after the block has been processed, the last (num_taps - 1) samples get moved to the front of the buffer
+ *
+ * Taps are stored time-reversed and packed in pairs; this lets us use the dual 16x16 MAC instructions (SMLALD/SMLALDX)
+ *      \--> inner loop is unrolled to compute 4 outputs at once
+ *      \--> every history word loaded is reused across 4 outputs (and the exchange variant of the instruction handles odd outputs)
+ *      \--> 64-bit accumulators, so no intermediate headroom/scaling shenanigans needed; output is saturated to int16_t
+ *
+ * Tap count is configured at runtime (up to `MAX_TAPS`); odd tap counts are zero-padded to the next even length
+ *
+ * Kernels can be swapped while the filter is running, same idea as the coefficients in `Biquad_Cascade`:
+ *      \--> write a new kernel with `stage_kernel()` from outside the audio ISR, then call `publish_kernel()`
+ *      \--> the audio update latches which kernel is active at the start of each block, so it never sees a half-written one
+ *      \--> sample history carries over; if the length changed it just gets realigned (about as much work as the end of a normal block)
+ */
+
+#include <array>
+#include <Arduino.h>
+
+#include <config.h> //for audio block size
+#include <utils.h> //for App_Span
+
+class FIR_Direct_Q15 {
+public:
+    //maximum number of taps supported by the kernel; sets the size of the internal buffers
+    static constexpr size_t MAX_TAPS = 512;
+
+    //default constructor --> initializes to a passthrough kernel
+    FIR_Direct_Q15();
+
+    //load a set of Q15 taps, ordered from h[0] (the "newest" sample) onwards
+    //also clears the sample history; only pass up to `MAX_TAPS` taps --> anything past this will get truncated
+    //only call this while the filter isn't running (e.g. from a constructor); use `stage_kernel()` otherwise
+    void set_kernel(App_Span<const int16_t> taps);
+
+    //write a kernel into the set the audio update isn't using (same format and truncation as `set_kernel()`)
+    //then call `publish_kernel()` to swap it in; both from outside the audio ISR
+    void stage_kernel(App_Span<const int16_t> taps);
+    void publish_kernel();
+
+    //zero out the sample history
+    void reset();
+
+    //run the filter over a block of samples
+    void process(const Audio_Block_t& block_in, Audio_Block_t& block_out);
+
+    //how many taps are we running right now (after even padding)
+    size_t get_num_taps();
+
+private:
+    //taps in reversed order, i.e. `taps[0]` multiplies the oldest sample in the window
+    //aligned so we can grab them in pairs as 32-bit words
+    struct Kernel {
+        size_t num_taps = 2; //always even
+        alignas(4) std::array<int16_t, MAX_TAPS> taps = {0};
+    };
+
+    //reverse and pad `taps` into `kernel`
+    static void load(Kernel& kernel, App_Span<const int16_t> taps);
+
+    //double-buffered kernels, along with which one the audio update is using
+    std::array<Kernel, 2> kernels;
+    volatile uint32_t active_kernel = 0;
+
+    //number of taps the sample history is currently laid out for (always even)
+    size_t num_taps = 2;
+
+    //linearized sample history; see notes at the top of the file
+    //extra 2 samples of slack since the unrolled loop reads one word past the end of the window
+    alignas(4) std::array<int16_t, MAX_TAPS + App_Constants::PROCESSING_BLOCK_SIZE + 2> history = {0};
+
+    //need the block size to be a multiple of 4 since we're computing 4 outputs per pass
+    static_assert(App_Constants::PROCESSING_BLOCK_SIZE % 4 == 0, "Block size must be a multiple of 4 for the unrolled FIR kernel!");
+};
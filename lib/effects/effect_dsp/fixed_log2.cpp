@@ -0,0 +1,30 @@
+#include <effect_dsp/fixed_log2.h>
+
+//=========================== LOOKUP TABLES =======================
+//entry `i` corresponds to a mantissa/fraction of i/64
+
+//log2(1 + i/64), Q16
+const Fixed_Log2::Table_t Fixed_Log2::LOG2_TABLE = {
+	0, 1466, 2909, 4331, 5732, 7112, 8473, 9814,
+	11136, 12440, 13727, 14996, 16248, 17484, 18704, 19909,
+	21098, 22272, 23433, 24579, 25711, 26830, 27936, 29029,
+	30109, 31178, 32234, 33279, 34312, 35334, 36346, 37346,
+	38336, 39316, 40286, 41246, 42196, 43137, 44068, 44990,
+	45904, 46809, 47705, 48593, 49472, 50344, 51207, 52063,
+	52911, 53751, 54584, 55410, 56229, 57040, 57845, 58643,
+	59434, 60219, 60997, 61769, 62534, 63294, 64047, 64794,
+	65536
+};
+
+//2^(i/64), Q30
+const Fixed_Log2::Table_t Fixed_Log2::EXP2_TABLE = {
+	1073741824, 1085434105, 1097253708, 1109202017, 1121280435, 1133490379, 1145833280, 1158310586,
+	1170923761, 1183674285, 1196563653, 1209593377, 1222764985, 1236080023, 1249540052, 1263146651,
+	1276901416, 1290805961, 1304861916, 1319070931, 1333434672, 1347954823, 1362633089, 1377471191,
+	1392470868, 1407633882, 1422962010, 1438457050, 1454120821, 1469955158, 1485961920, 1502142985,
+	1518500249, 1535035633, 1551751075, 1568648537, 1585729999, 1602997467, 1620452965, 1638098541,
+	1655936264, 1673968228, 1692196547, 1710623359, 1729250826, 1748081133, 1767116488, 1786359125,
+	1805811301, 1825475297, 1845353419, 1865448001, 1885761398, 1906295993, 1927054195, 1948038440,
+	1969251187, 1990694927, 2012372173, 2034285470, 2056437386, 2078830521, 2101467501, 2124350982,
+	2147483648
+};
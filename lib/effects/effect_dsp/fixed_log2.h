@@ -0,0 +1,80 @@
+#pragma once
+
+/*
+ * Table-based fixed-point log2/exp2, for gain computers that run in the audio update
+ *
+ * Both functions work in Q16.16 "log2 units" (one unit is ~6.02dB)
+ *      \--> `log2_q16()` normalizes its input with a count-leading-zeros, then interpolates the mantissa from a 65-entry table
+ *      \--> `exp2_q16()` interpolates 2^(fraction) from a 65-entry table, then shifts by the integer part
+ *      \--> linear interpolation over 64 segments keeps the error well under 0.01dB
+ *
+ * `exp2_q16()` can read high by up to ~0.001dB between table entries (interpolating a convex curve); limiters should leave a little margin
+ * Intention is to use this class statically, i.e. don't instantiate it
+ */
+
+#include <array>
+#include <limits>
+#include <Arduino.h>
+
+class Fixed_Log2 {
+public:
+    //prevent all flavors of making an instance of one of these
+    Fixed_Log2() = delete;
+    Fixed_Log2(const Fixed_Log2& other) = delete;
+    void operator=(const Fixed_Log2& other) = delete;
+
+    //table format
+    static constexpr size_t TABLE_INDEX_BITS = 6;
+    typedef std::array<uint32_t, (1 << TABLE_INDEX_BITS) + 1> Table_t;
+
+    //one in Q16.16
+    static constexpr int32_t ONE_Q16 = 1 << 16;
+
+    //log2 of an unsigned integer, in Q16.16
+    //input of zero is treated as one (i.e. returns zero)
+    static inline int32_t log2_q16(uint32_t x) {
+        if(x == 0) return 0;
+
+        //normalize so the leading one sits at bit 31; integer part of the log is where it started
+        int32_t msb = 31 - __builtin_clz(x);
+        uint32_t norm = x << (31 - msb);
+
+        //next bits after the leading one index the table, the ones after that interpolate
+        uint32_t index = (norm >> (31 - TABLE_INDEX_BITS)) & ((1 << TABLE_INDEX_BITS) - 1);
+        uint32_t frac = (norm >> (15 - TABLE_INDEX_BITS)) & 0xFFFF;
+        uint32_t y0 = LOG2_TABLE[index];
+        uint32_t y1 = LOG2_TABLE[index + 1];
+        return (msb << 16) + (int32_t)(y0 + (((y1 - y0) * frac) >> 16));
+    }
+
+    //2^x for x in Q16.16, result in Q16.16
+    //results that would overflow are clamped, results that underflow come out as zero
+    static inline int32_t exp2_q16(int32_t x) {
+        int32_t int_part = x >> 16; //floor
+        if(int_part >= 15) return std::numeric_limits<int32_t>::max();
+        if(int_part < -17) return 0;
+
+        //fraction indexes and interpolates the table (Q30 mantissa in [1, 2])
+        uint32_t frac = x & 0xFFFF;
+        uint32_t index = frac >> (16 - TABLE_INDEX_BITS);
+        uint32_t sub_frac = frac & ((1 << (16 - TABLE_INDEX_BITS)) - 1);
+        uint32_t y0 = EXP2_TABLE[index];
+        uint32_t y1 = EXP2_TABLE[index + 1];
+        uint32_t mantissa = y0 + (uint32_t)(((uint64_t)(y1 - y0) * sub_frac) >> (16 - TABLE_INDEX_BITS));
+
+        //mantissa is Q30, shift into Q16 by the integer part
+        int32_t shift = 14 - int_part;
+        return (int32_t)(mantissa >> shift);
+    }
+
+    //conversions between dB and log2 units (floating point, do these outside the sample loop)
+    static inline int32_t db_to_log2_q16(float db) { return (int32_t)(db / 6.0205999f * ONE_Q16); }
+    static inline float log2_q16_to_db(int32_t x) { return (float)x * 6.0205999f / ONE_Q16; }
+
+private:
+    //log2(1 + i/64) in Q16
+    static const Table_t LOG2_TABLE;
+
+    //2^(i/64) in Q30
+    static const Table_t EXP2_TABLE;
+};
@@ -0,0 +1,156 @@
+#include <effect_dsp/mod_delay.h>
+
+#include <dspinst.h> //for saturating instructions
+
+//=========================== LOOKUP TABLES =======================
+
+//sin(2 * pi * i / 256), Q15
+const Mod_Delay::LFO_Table_t Mod_Delay::LFO_TABLE = {
+	0, 804, 1608, 2410, 3212, 4011, 4808, 5602, 6393, 7179, 7962, 8739, 9512, 10278, 11039, 11793,
+	12539, 13279, 14010, 14732, 15446, 16151, 16846, 17530, 18204, 18868, 19519, 20159, 20787, 21403, 22005, 22594,
+	23170, 23731, 24279, 24811, 25329, 25832, 26319, 26790, 27245, 27683, 28105, 28510, 28898, 29268, 29621, 29956,
+	30273, 30571, 30852, 31113, 31356, 31580, 31785, 31971, 32137, 32285, 32412, 32521, 32609, 32678, 32728, 32757,
+	32767, 32757, 32728, 32678, 32609, 32521, 32412, 32285, 32137, 31971, 31785, 31580, 31356, 31113, 30852, 30571,
+	30273, 29956, 29621, 29268, 28898, 28510, 28105, 27683, 27245, 26790, 26319, 25832, 25329, 24811, 24279, 23731,
+	23170, 22594, 22005, 21403, 20787, 20159, 19519, 18868, 18204, 17530, 16846, 16151, 15446, 14732, 14010, 13279,
+	12539, 11793, 11039, 10278, 9512, 8739, 7962, 7179, 6393, 5602, 4808, 4011, 3212, 2410, 1608, 804,
+	0, -804, -1608, -2410, -3212, -4011, -4808, -5602, -6393, -7179, -7962, -8739, -9512, -10278, -11039, -11793,
+	-12539, -13279, -14010, -14732, -15446, -16151, -16846, -17530, -18204, -18868, -19519, -20159, -20787, -21403, -22005, -22594,
+	-23170, -23731, -24279, -24811, -25329, -25832, -26319, -26790, -27245, -27683, -28105, -28510, -28898, -29268, -29621, -29956,
+	-30273, -30571, -30852, -31113, -31356, -31580, -31785, -31971, -32137, -32285, -32412, -32521, -32609, -32678, -32728, -32757,
+	-32767, -32757, -32728, -32678, -32609, -32521, -32412, -32285, -32137, -31971, -31785, -31580, -31356, -31113, -30852, -30571,
+	-30273, -29956, -29621, -29268, -28898, -28510, -28105, -27683, -27245, -26790, -26319, -25832, -25329, -24811, -24279, -23731,
+	-23170, -22594, -22005, -21403, -20787, -20159, -19519, -18868, -18204, -17530, -16846, -16151, -15446, -14732, -14010, -13279,
+	-12539, -11793, -11039, -10278, -9512, -8739, -7962, -7179, -6393, -5602, -4808, -4011, -3212, -2410, -1608, -804,
+	0
+};
+
+//first-order allpass coefficient (1 - d) / (1 + d) for a fractional delay of d = 0.5 + i/64, Q15
+const Mod_Delay::Allpass_Table_t Mod_Delay::ALLPASS_TABLE = {
+	10923, 10472, 10031, 9599, 9175, 8760, 8353, 7953,
+	7562, 7178, 6801, 6431, 6068, 5712, 5362, 5019,
+	4681, 4350, 4024, 3704, 3390, 3081, 2777, 2478,
+	2185, 1896, 1612, 1332, 1057, 786, 520, 258,
+	0, -254, -504, -750, -993, -1232, -1467, -1699,
+	-1928, -2153, -2374, -2593, -2809, -3021, -3231, -3437,
+	-3641, -3842, -4040, -4235, -4428, -4618, -4806, -4991,
+	-5174, -5354, -5532, -5708, -5881, -6053, -6222, -6389,
+	-6554
+};
+
+//=========================== PUBLIC FUNCTIONS =======================
+
+//nothing to do beyond the default member values
+Mod_Delay::Mod_Delay() {
+    static_assert((BUFFER_LENGTH & (BUFFER_LENGTH - 1)) == 0, "Modulated delay buffer length must be a power of two!");
+}
+
+void Mod_Delay::set_interpolation(Interpolation _interpolation) {
+    //reset the allpass so we don't start from a stale output
+    interpolation = _interpolation;
+    allpass_state = 0;
+}
+
+//LFO only advances once per block
+void Mod_Delay::set_rate(float rate_hz) {
+    double cycles_per_block = (double)rate_hz * App_Constants::PROCESSING_BLOCK_SIZE / App_Constants::AUDIO_SAMPLE_RATE_HZ;
+    lfo_increment = (uint32_t)(cycles_per_block * 4294967296.0);
+}
+
+//convert to Q16.16 samples, and keep the whole sweep inside the delay line
+//  \--> shortest delay has to be at least 1.5 samples for the allpass (needs one full sample of integer delay)
+//  \--> longest delay leaves a little room for the interpolator to read one sample past it
+void Mod_Delay::set_delay(float center_ms, float depth_ms) {
+    constexpr int32_t MIN_DELAY = 2 << 16;
+    constexpr int32_t MAX_DELAY = (BUFFER_LENGTH - 4) << 16;
+    const float SAMPLES_PER_MS_Q16 = App_Constants::AUDIO_SAMPLE_RATE_HZ / 1000.0f * 65536.0f;
+
+    int32_t center = constrain((int32_t)(center_ms * SAMPLES_PER_MS_Q16), MIN_DELAY, MAX_DELAY);
+    int32_t depth = constrain((int32_t)(depth_ms * SAMPLES_PER_MS_Q16), (int32_t)0, min(center - MIN_DELAY, MAX_DELAY - center));
+
+    //first time through, start the sweep right at the center
+    if(current_delay == 0) current_delay = center;
+    center_delay = center;
+    depth_delay = depth;
+}
+
+void Mod_Delay::set_feedback(float feedback) {
+    feedback_q15 = (int32_t)(constrain(feedback, -1.0f, 1.0f) * 32767.0f);
+}
+
+void Mod_Delay::set_mix(float mix) {
+    wet_q15 = (int32_t)(constrain(mix, 0.0f, 1.0f) * 32767.0f);
+    dry_q15 = 32767 - wet_q15;
+}
+
+void Mod_Delay::reset() {
+    buffer.fill(0);
+    write_pos = 0;
+    allpass_state = 0;
+}
+
+//################# CORE OF THE ENGINE ###################
+
+void Mod_Delay::process(const Audio_Block_t& block_in, Audio_Block_t& block_out) {
+    constexpr size_t MASK = BUFFER_LENGTH - 1;
+
+    //run the LFO once for the block, and ramp the delay there over the course of the block
+    //dividing by a compile-time constant, so this turns into a shift/multiply
+    lfo_phase += lfo_increment;
+    int32_t target_delay = center_delay + (int32_t)(((int64_t)depth_delay * lfo_at(lfo_phase)) >> 15);
+    int32_t delay_step = (target_delay - current_delay) / (int32_t)App_Constants::PROCESSING_BLOCK_SIZE;
+    int32_t delay = current_delay;
+
+    for(size_t i = 0; i < block_in.size(); i++) {
+        delay += delay_step;
+
+        //read the delayed sample, interpolating between the two samples that straddle the delay
+        int32_t wet;
+        if(interpolation == LINEAR) {
+            size_t whole = delay >> 16;
+            int32_t frac = (delay & 0xFFFF) >> 1; //Q15 so the product fits in 32 bits
+            int32_t s0 = buffer[(write_pos - whole) & MASK];
+            int32_t s1 = buffer[(write_pos - whole - 1) & MASK];
+            wet = s0 + (((s1 - s0) * frac) >> 15);
+        }
+        else {
+            //split off half a sample, the allpass covers a fractional delay between 0.5 and 1.5 samples
+            int32_t offset_delay = delay - (1 << 15);
+            size_t whole = offset_delay >> 16;
+            uint32_t frac = offset_delay & 0xFFFF;
+
+            //interpolate the coefficient out of the table
+            uint32_t index = frac >> (16 - ALLPASS_TABLE_BITS);
+            int32_t sub_frac = frac & ((1 << (16 - ALLPASS_TABLE_BITS)) - 1);
+            int32_t c0 = ALLPASS_TABLE[index];
+            int32_t c1 = ALLPASS_TABLE[index + 1];
+            int32_t coeff = c0 + (((c1 - c0) * sub_frac) >> (16 - ALLPASS_TABLE_BITS));
+
+            //y[n] = c * (x[n - N] - y[n - 1]) + x[n - N - 1]
+            int32_t s0 = buffer[(write_pos - whole) & MASK];
+            int32_t s1 = buffer[(write_pos - whole - 1) & MASK];
+            wet = signed_saturate_rshift(s1 + ((coeff * (s0 - allpass_state)) >> 15), 16, 0);
+            allpass_state = wet;
+        }
+
+        //feed back into the line, mix with the dry signal
+        int32_t sample = block_in[i];
+        buffer[write_pos] = (int16_t)signed_saturate_rshift(sample * 32768 + wet * feedback_q15, 16, 15);
+        block_out[i] = (int16_t)signed_saturate_rshift(sample * dry_q15 + wet * wet_q15, 16, 15);
+        write_pos = (write_pos + 1) & MASK;
+    }
+
+    //start the next block exactly where this one was headed (no drift from the rounded step)
+    current_delay = target_delay;
+}
+
+//linearly interpolate the sine table; top bits of the phase index it, the next 16 bits interpolate
+int32_t Mod_Delay::lfo_at(uint32_t phase) {
+    uint32_t index = phase >> (32 - LFO_TABLE_BITS);
+    int32_t frac = (phase >> (16 - LFO_TABLE_BITS)) & 0xFFFF;
+    int32_t y0 = LFO_TABLE[index];
+    int32_t y1 = LFO_TABLE[index + 1];
+    return y0 + (((y1 - y0) * frac) >> 16);
+}
+
+//################# end CORE OF THE ENGINE ###################
@@ -0,0 +1,84 @@
+#pragma once
+
+/*
+ * Modulated delay line, the engine behind chorus/flanger/vibrato
+ *
+ * LFO is a 257-entry Q15 sine wavetable with a 32-bit phase accumulator
+ *      \--> only evaluated once per block (at the end of the block)
+ *      \--> delay (Q16.16 samples) is linearly ramped from last block's value to the new one, so each sample is just an add
+ *
+ * Fractional delay is read with either linear or first-order allpass interpolation
+ *      \--> linear: cheap and stable under fast modulation, but rolls off the top end a little at half-sample delays
+ *      \--> allpass: flat magnitude response (keeps flanger notches deep), coefficient comes from a 65-entry table
+ *      \--> no divisions anywhere in the sample loop
+ *
+ * Delay line is a power-of-two circular buffer of int16s that lives inside the instance (~4KB)
+ */
+
+#include <array>
+#include <Arduino.h>
+
+#include <config.h> //for audio block type and sample rate
+
+class Mod_Delay {
+public:
+    //how to read between samples
+    enum Interpolation {
+        LINEAR = 0,
+        ALLPASS,
+    };
+
+    //circular buffer length; longest usable delay is a couple samples short of this (~42ms)
+    static constexpr size_t BUFFER_LENGTH = 2048;
+
+    //table formats
+    static constexpr size_t LFO_TABLE_BITS = 8;
+    static constexpr size_t ALLPASS_TABLE_BITS = 6;
+    typedef std::array<int16_t, (1 << LFO_TABLE_BITS) + 1> LFO_Table_t;
+    typedef std::array<int16_t, (1 << ALLPASS_TABLE_BITS) + 1> Allpass_Table_t;
+
+    //start off silent, with no modulation
+    Mod_Delay();
+
+    //parameter setters; these all do their floating point math here, outside the sample loop
+    void set_interpolation(Interpolation _interpolation);
+    void set_rate(float rate_hz);
+    void set_delay(float center_ms, float depth_ms); //delay sweeps `center_ms +/- depth_ms`
+    void set_feedback(float feedback);  //-1 to 1
+    void set_mix(float mix);            //0 (all dry) to 1 (all wet)
+
+    //clear the delay line and interpolator state
+    void reset();
+
+    //run a block through the modulated delay
+    void process(const Audio_Block_t& block_in, Audio_Block_t& block_out);
+
+private:
+    //sine wavetable for the LFO, allpass coefficients for delays of 0.5 to 1.5 samples
+    static const LFO_Table_t LFO_TABLE;
+    static const Allpass_Table_t ALLPASS_TABLE;
+
+    //interpolated LFO output at the given phase, Q15
+    static int32_t lfo_at(uint32_t phase);
+
+    //LFO phase accumulator and how much it advances every block
+    uint32_t lfo_phase = 0;
+    uint32_t lfo_increment = 0;
+
+    //delay sweep in Q16.16 samples, delay where the last block left off
+    int32_t center_delay = 0;
+    int32_t depth_delay = 0;
+    int32_t current_delay = 0;
+
+    //gains in Q15
+    int32_t feedback_q15 = 0;
+    int32_t wet_q15 = 0;
+    int32_t dry_q15 = 32767;
+
+    Interpolation interpolation = LINEAR;
+    int32_t allpass_state = 0; //previous allpass output
+
+    //the delay line itself
+    std::array<int16_t, BUFFER_LENGTH> buffer = {0};
+    size_t write_pos = 0;
+};
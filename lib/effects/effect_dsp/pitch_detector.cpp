@@ -0,0 +1,69 @@
+#include <effect_dsp/pitch_detector.h>
+
+#include <math.h> //for sqrtf
+
+//convert the pitch range into a range of lags
+//leave room for one lag on either side of the search range for the parabolic interpolation
+Pitch_Detector::Pitch_Detector(float _sample_rate_hz, float min_hz, float max_hz):
+    sample_rate_hz(_sample_rate_hz),
+    min_lag(max((size_t)(_sample_rate_hz / max_hz), (size_t)2)),
+    max_lag(min((size_t)(_sample_rate_hz / min_hz) + 1, MAX_LAG - 1))
+{}
+
+float Pitch_Detector::detect(const Frame_t& frame) {
+    //pull the frame into floating point, removing any DC offset
+    //bail early if there isn't enough signal to bother with
+    float mean = 0;
+    for(int16_t s : frame) mean += s;
+    mean /= FRAME_SIZE;
+
+    float energy = 0;
+    for(size_t j = 0; j < FRAME_SIZE; j++) {
+        samples[j] = frame[j] - mean;
+        energy += samples[j] * samples[j];
+    }
+    if(sqrtf(energy / FRAME_SIZE) < SILENCE_RMS) {
+        clarity = 0;
+        return 0;
+    }
+
+    //difference function, normalized by its running mean
+    //integration window is the first half of the frame, so every lag up to `MAX_LAG` sees the same number of products
+    cmnd[0] = 1;
+    float running_sum = 0;
+    for(size_t tau = 1; tau <= max_lag + 1; tau++) {
+        float diff = 0;
+        for(size_t j = 0; j < MAX_LAG; j++) {
+            float delta = samples[j] - samples[j + tau];
+            diff += delta * delta;
+        }
+        raw_diff[tau] = diff;
+        running_sum += diff;
+        cmnd[tau] = (running_sum > 0) ? diff * tau / running_sum : 1;
+    }
+
+    //first dip under the threshold, then slide down to the bottom of it
+    size_t period = 0;
+    for(size_t tau = min_lag; tau <= max_lag; tau++) {
+        if(cmnd[tau] < THRESHOLD) {
+            while(tau + 1 <= max_lag && cmnd[tau + 1] < cmnd[tau]) tau++;
+            period = tau;
+            break;
+        }
+    }
+    if(period == 0) {
+        clarity = 0;
+        return 0;
+    }
+
+    //fit a parabola through the dip and its neighbors for a fractional period
+    //fit on the raw difference function; the normalization skews the shape of the dip a little
+    float a = raw_diff[period - 1];
+    float b = raw_diff[period];
+    float c = raw_diff[period + 1];
+    float denom = a - 2 * b + c;
+    float offset = (denom > 0) ? constrain(0.5f * (a - c) / denom, -0.5f, 0.5f) : 0;
+
+    clarity = 1 - cmnd[period];
+    return sample_rate_hz / (period + offset);
+}
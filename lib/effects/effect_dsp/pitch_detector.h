@@ -0,0 +1,53 @@
+#pragma once
+
+/*
+ * YIN pitch detector (de Cheveigné & Kawahara, 2002)
+ *
+ * Runs on a frame of `FRAME_SIZE` samples:
+ *      \--> squared difference function over lags up to half the frame, integrated over the other half
+ *      \--> cumulative mean normalized difference, take the first dip under `THRESHOLD` (then walk to the bottom of it)
+ *      \--> parabolic interpolation around the dip for a sub-sample period
+ *
+ * Cost is O(FRAME_SIZE^2 / 4) multiply-accumulates, so run this outside the audio update on a decimated signal
+ * Uses floating point (single precision, hardware FPU) since it never runs in interrupt context
+ */
+
+#include <array>
+#include <Arduino.h>
+
+class Pitch_Detector {
+public:
+    //analysis frame length; longest detectable period is half of this, less the two lags the search needs around the dip
+    //832 samples at the tuner's 12kHz gives a search up to lag 401 (29.9Hz), so a bass's low B (30.87Hz) is in range
+    static constexpr size_t FRAME_SIZE = 832;
+    static constexpr size_t MAX_LAG = FRAME_SIZE / 2;
+    typedef std::array<int16_t, FRAME_SIZE> Frame_t;
+
+    //dip in the normalized difference function has to go under this to count as a period
+    static constexpr float THRESHOLD = 0.15f;
+
+    //frames quieter than this (RMS, in Q15 counts) are treated as silence (about -50dBFS)
+    static constexpr float SILENCE_RMS = 100.0f;
+
+    //configure for the rate of the signal we'll be fed, and the range of pitches to look for
+    //maximum period is capped at `MAX_LAG`
+    Pitch_Detector(float _sample_rate_hz, float min_hz, float max_hz);
+
+    //run the detector on a frame, returns the fundamental frequency in Hz, or 0 if no pitch was found
+    float detect(const Frame_t& frame);
+
+    //how periodic the last detected frame was (0 to 1); only meaningful if the last `detect()` found a pitch
+    inline float get_clarity() { return clarity; }
+
+private:
+    const float sample_rate_hz;
+    const size_t min_lag;
+    const size_t max_lag;
+
+    //scratch space; frame with the DC removed, the difference function, and its normalized version
+    std::array<float, FRAME_SIZE> samples;
+    std::array<float, MAX_LAG + 1> raw_diff;
+    std::array<float, MAX_LAG + 1> cmnd;
+
+    float clarity = 0;
+};
@@ -0,0 +1,153 @@
+#include <effect_dsp/waveshaper.h>
+
+#include <app_strings.h> //for the curve names
+
+//=========================== TRANSFER CURVE TABLES =======================
+//entry `i` corresponds to an input of (i - 128)/128 full scale
+
+//piecewise diode approximation from
+//https://baltic-lab.com/2023/08/dsp-diode-clipping-algorithm-for-overdrive-and-distortion-effects/
+//  2x                  for |x| < 1/3
+//  -3x^2 + 4x - 1/3    for |x| < 2/3
+//  1                   otherwise
+const Waveshaper::Curve_Table_t Waveshaper::DIODE_TABLE = {
+	-32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767,
+	-32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767,
+	-32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767,
+	-32767, -32767, -32767, -32767, -32767, -32767, -32767, -32766, -32756, -32734, -32700, -32654,
+	-32596, -32526, -32444, -32350, -32244, -32126, -31996, -31854, -31700, -31534, -31356, -31166,
+	-30964, -30750, -30524, -30286, -30036, -29774, -29500, -29214, -28916, -28606, -28284, -27950,
+	-27604, -27247, -26877, -26495, -26101, -25695, -25277, -24847, -24405, -23951, -23485, -23007,
+	-22517, -22015, -21503, -20991, -20479, -19967, -19455, -18943, -18431, -17919, -17407, -16895,
+	-16384, -15872, -15360, -14848, -14336, -13824, -13312, -12800, -12288, -11776, -11264, -10752,
+	-10240, -9728, -9216, -8704, -8192, -7680, -7168, -6656, -6144, -5632, -5120, -4608,
+	-4096, -3584, -3072, -2560, -2048, -1536, -1024, -512, 0, 512, 1024, 1536,
+	2048, 2560, 3072, 3584, 4096, 4608, 5120, 5632, 6144, 6656, 7168, 7680,
+	8192, 8704, 9216, 9728, 10240, 10752, 11264, 11776, 12288, 12800, 13312, 13824,
+	14336, 14848, 15360, 15872, 16384, 16895, 17407, 17919, 18431, 18943, 19455, 19967,
+	20479, 20991, 21503, 22015, 22517, 23007, 23485, 23951, 24405, 24847, 25277, 25695,
+	26101, 26495, 26877, 27247, 27604, 27950, 28284, 28606, 28916, 29214, 29500, 29774,
+	30036, 30286, 30524, 30750, 30964, 31166, 31356, 31534, 31700, 31854, 31996, 32126,
+	32244, 32350, 32444, 32526, 32596, 32654, 32700, 32734, 32756, 32766, 32767, 32767,
+	32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+	32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+	32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+	32767, 32767, 32767, 32767, 32767
+};
+
+//asymmetric exponential saturation
+//  (1 - e^(-2x)) / (1 - e^(-2))        for x >= 0
+//  -(1 - e^(4x)) / (1 - e^(-4))        for x < 0
+const Waveshaper::Curve_Table_t Waveshaper::TUBE_TABLE = {
+	-32767, -32748, -32728, -32707, -32686, -32664, -32641, -32618, -32593, -32568, -32543, -32516,
+	-32489, -32461, -32431, -32401, -32370, -32338, -32305, -32271, -32236, -32200, -32163, -32124,
+	-32084, -32043, -32001, -31957, -31912, -31865, -31817, -31768, -31717, -31664, -31609, -31553,
+	-31495, -31435, -31374, -31310, -31245, -31177, -31107, -31035, -30960, -30884, -30804, -30723,
+	-30638, -30552, -30462, -30369, -30274, -30175, -30073, -29969, -29860, -29749, -29633, -29515,
+	-29392, -29265, -29135, -29000, -28861, -28718, -28570, -28417, -28260, -28097, -27929, -27757,
+	-27578, -27394, -27204, -27008, -26806, -26597, -26382, -26160, -25931, -25694, -25450, -25199,
+	-24939, -24671, -24395, -24110, -23815, -23512, -23199, -22875, -22542, -22198, -21843, -21477,
+	-21099, -20709, -20307, -19892, -19464, -19022, -18567, -18097, -17612, -17111, -16595, -16062,
+	-15512, -14945, -14360, -13756, -13133, -12491, -11828, -11144, -10438, -9710, -8958, -8183,
+	-7383, -6558, -5707, -4828, -3922, -2987, -2022, -1027, 0, 588, 1166, 1735,
+	2296, 2848, 3391, 3926, 4453, 4971, 5482, 5984, 6479, 6966, 7446, 7918,
+	8382, 8840, 9291, 9734, 10171, 10600, 11024, 11440, 11850, 12254, 12652, 13043,
+	13428, 13808, 14181, 14549, 14911, 15267, 15618, 15963, 16303, 16638, 16968, 17292,
+	17612, 17926, 18236, 18540, 18841, 19136, 19427, 19713, 19995, 20273, 20546, 20815,
+	21080, 21340, 21597, 21850, 22098, 22343, 22584, 22822, 23055, 23286, 23512, 23735,
+	23955, 24171, 24384, 24593, 24799, 25002, 25202, 25399, 25593, 25783, 25971, 26156,
+	26338, 26517, 26694, 26867, 27038, 27207, 27372, 27536, 27696, 27854, 28010, 28163,
+	28314, 28463, 28609, 28753, 28895, 29034, 29172, 29307, 29440, 29571, 29700, 29827,
+	29952, 30075, 30197, 30316, 30434, 30549, 30663, 30775, 30886, 30994, 31101, 31207,
+	31310, 31412, 31513, 31612, 31709, 31805, 31900, 31993, 32084, 32174, 32263, 32350,
+	32436, 32521, 32604, 32686, 32767
+};
+
+//2x, clipped to full scale
+const Waveshaper::Curve_Table_t Waveshaper::HARD_CLIP_TABLE = {
+	-32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767,
+	-32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767,
+	-32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767,
+	-32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767,
+	-32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767,
+	-32767, -32767, -32767, -32767, -32767, -32255, -31743, -31231, -30719, -30207, -29695, -29183,
+	-28671, -28159, -27647, -27135, -26623, -26111, -25599, -25087, -24575, -24063, -23551, -23039,
+	-22527, -22015, -21503, -20991, -20479, -19967, -19455, -18943, -18431, -17919, -17407, -16895,
+	-16384, -15872, -15360, -14848, -14336, -13824, -13312, -12800, -12288, -11776, -11264, -10752,
+	-10240, -9728, -9216, -8704, -8192, -7680, -7168, -6656, -6144, -5632, -5120, -4608,
+	-4096, -3584, -3072, -2560, -2048, -1536, -1024, -512, 0, 512, 1024, 1536,
+	2048, 2560, 3072, 3584, 4096, 4608, 5120, 5632, 6144, 6656, 7168, 7680,
+	8192, 8704, 9216, 9728, 10240, 10752, 11264, 11776, 12288, 12800, 13312, 13824,
+	14336, 14848, 15360, 15872, 16384, 16895, 17407, 17919, 18431, 18943, 19455, 19967,
+	20479, 20991, 21503, 22015, 22527, 23039, 23551, 24063, 24575, 25087, 25599, 26111,
+	26623, 27135, 27647, 28159, 28671, 29183, 29695, 30207, 30719, 31231, 31743, 32255,
+	32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+	32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+	32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+	32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+	32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+	32767, 32767, 32767, 32767, 32767
+};
+
+//3x, folded back into full scale as a triangle wave
+const Waveshaper::Curve_Table_t Waveshaper::FOLDBACK_TABLE = {
+	32767, 31999, 31231, 30463, 29695, 28927, 28159, 27391, 26623, 25855, 25087, 24319,
+	23551, 22783, 22015, 21247, 20479, 19711, 18943, 18175, 17407, 16639, 15872, 15104,
+	14336, 13568, 12800, 12032, 11264, 10496, 9728, 8960, 8192, 7424, 6656, 5888,
+	5120, 4352, 3584, 2816, 2048, 1280, 512, -256, -1024, -1792, -2560, -3328,
+	-4096, -4864, -5632, -6400, -7168, -7936, -8704, -9472, -10240, -11008, -11776, -12544,
+	-13312, -14080, -14848, -15616, -16384, -17151, -17919, -18687, -19455, -20223, -20991, -21759,
+	-22527, -23295, -24063, -24831, -25599, -26367, -27135, -27903, -28671, -29439, -30207, -30975,
+	-31743, -32511, -32255, -31487, -30719, -29951, -29183, -28415, -27647, -26879, -26111, -25343,
+	-24575, -23807, -23039, -22271, -21503, -20735, -19967, -19199, -18431, -17663, -16895, -16128,
+	-15360, -14592, -13824, -13056, -12288, -11520, -10752, -9984, -9216, -8448, -7680, -6912,
+	-6144, -5376, -4608, -3840, -3072, -2304, -1536, -768, 0, 768, 1536, 2304,
+	3072, 3840, 4608, 5376, 6144, 6912, 7680, 8448, 9216, 9984, 10752, 11520,
+	12288, 13056, 13824, 14592, 15360, 16128, 16895, 17663, 18431, 19199, 19967, 20735,
+	21503, 22271, 23039, 23807, 24575, 25343, 26111, 26879, 27647, 28415, 29183, 29951,
+	30719, 31487, 32255, 32511, 31743, 30975, 30207, 29439, 28671, 27903, 27135, 26367,
+	25599, 24831, 24063, 23295, 22527, 21759, 20991, 20223, 19455, 18687, 17919, 17151,
+	16384, 15616, 14848, 14080, 13312, 12544, 11776, 11008, 10240, 9472, 8704, 7936,
+	7168, 6400, 5632, 4864, 4096, 3328, 2560, 1792, 1024, 256, -512, -1280,
+	-2048, -2816, -3584, -4352, -5120, -5888, -6656, -7424, -8192, -8960, -9728, -10496,
+	-11264, -12032, -12800, -13568, -14336, -15104, -15872, -16639, -17407, -18175, -18943, -19711,
+	-20479, -21247, -22015, -22783, -23551, -24319, -25087, -25855, -26623, -27391, -28159, -28927,
+	-29695, -30463, -31231, -31999, -32767
+};
+
+//=========================== PUBLIC FUNCTIONS =======================
+
+Waveshaper::Waveshaper():
+    table(&DIODE_TABLE),
+    drive_q16(1 << 16)
+{}
+
+//just swap the table pointer
+void Waveshaper::set_curve(Curve curve) {
+    switch(curve) {
+        case DIODE: table = &DIODE_TABLE; break;
+        case TUBE: table = &TUBE_TABLE; break;
+        case HARD_CLIP: table = &HARD_CLIP_TABLE; break;
+        case FOLDBACK: table = &FOLDBACK_TABLE; break;
+        default: break;
+    }
+}
+
+//convert the gain to Q16.16
+//cap it such that the pre-gain multiply in `process()` can't overflow
+void Waveshaper::set_drive(float gain) {
+    static constexpr float MAX_DRIVE = 32767.0f / 256.0f;
+    gain = constrain(gain, 0.0f, MAX_DRIVE);
+    drive_q16 = (int32_t)(gain * 65536.0f);
+}
+
+//names are a function-local static since effects may call this during static initialization
+App_Span<App_String> Waveshaper::get_curve_names() {
+    static std::array<App_String, NUM_CURVES> curve_names = {
+        App_Strings::CURVE_DIODE,
+        App_Strings::CURVE_TUBE,
+        App_Strings::CURVE_HARD_CLIP,
+        App_Strings::CURVE_FOLDBACK
+    };
+    return App_Span<App_String>(curve_names);
+}
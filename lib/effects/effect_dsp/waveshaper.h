@@ -0,0 +1,80 @@
+#pragma once
+
+/*
+ * Lookup-table based waveshaper for distortion effects
+ *
+ * Transfer curves are stored as 257-entry Q15 tables spanning the full int16_t input range
+ *      \--> input is split into an index (top 8 bits) and a fraction (bottom 8 bits), output is linearly interpolated between entries
+ *      \--> this makes every sample a table lookup + multiply, no matter how complicated the curve is
+ *      \--> selecting a different curve just swaps the table pointer
+ *
+ * Pre-gain ("drive") is applied before the lookup, and the result is saturated to the table range
+ *      \--> anything driven past the table range sits at the end of the curve
+ *
+ * `process()` is inlined since it's meant to be called per-sample from oversampled loops
+ */
+
+#include <array>
+#include <string>
+#include <Arduino.h>
+#include <dspinst.h> //for saturating multiply
+
+#include <utils.h> //for App_Span, App_String
+
+class Waveshaper {
+public:
+    //transfer curves we support, in the same order as `get_curve_names()`
+    enum Curve {
+        DIODE = 0,  //symmetric soft clipping, like a pair of clipping diodes
+        TUBE,       //asymmetric soft clipping, compresses the negative half harder
+        HARD_CLIP,  //straight-line clipping
+        FOLDBACK,   //signal folds back on itself past full scale; wavefolder/fuzz-type sound
+        NUM_CURVES
+    };
+
+    //table format
+    static constexpr size_t TABLE_INDEX_BITS = 8;
+    typedef std::array<int16_t, (1 << TABLE_INDEX_BITS) + 1> Curve_Table_t;
+
+    //default to the diode curve with unity drive
+    Waveshaper();
+
+    //swap in a different transfer curve; out of range values are ignored
+    void set_curve(Curve curve);
+
+    //set the linear gain applied before the transfer curve
+    void set_drive(float gain);
+
+    //get names of all the curves (e.g. for a selection parameter)
+    static App_Span<App_String> get_curve_names();
+
+    //run a single sample through the waveshaper
+    //input is expected to be roughly in the int16_t range, output will be in the int16_t range
+    inline int32_t process(int32_t sample) {
+        //apply drive (Q16.16) and saturate to the table range
+        int32_t driven = signed_saturate_rshift(multiply_32x32_rshift32(sample << 8, drive_q16 << 8), 16, 0);
+
+        //split into table index and interpolation fraction
+        uint32_t offset = (uint32_t)(driven + 32768);
+        uint32_t index = offset >> (16 - TABLE_INDEX_BITS);
+        int32_t frac = offset & ((1 << (16 - TABLE_INDEX_BITS)) - 1);
+
+        //linearly interpolate between table entries
+        const int32_t y0 = (*table)[index];
+        const int32_t y1 = (*table)[index + 1];
+        return y0 + (((y1 - y0) * frac) >> (16 - TABLE_INDEX_BITS));
+    }
+
+private:
+    //currently selected transfer curve
+    const Curve_Table_t* table;
+
+    //pre-gain in Q16.16
+    int32_t drive_q16;
+
+    //transfer curves
+    static const Curve_Table_t DIODE_TABLE;
+    static const Curve_Table_t TUBE_TABLE;
+    static const Curve_Table_t HARD_CLIP_TABLE;
+    static const Curve_Table_t FOLDBACK_TABLE;
+};
@@ -91,7 +91,7 @@ void Default_Effect_Edit_Impl::render(U8G2& graphics_handle) {
     //############# end RENDERING #############
 
     //send the display buffer
-    graphics_handle.sendBuffer();
+    UI_Page::send_buffer();
 
 }
 
@@ -111,7 +111,7 @@ void Default_Effect_Edit_Impl::set_render_parmeter(Effect_Parameter* param, size
 }
 
 //simple setter methods for the render text
-void Default_Effect_Edit_Impl::set_display_text(const std::string _display_text) { display_text = _display_text; }
+void Default_Effect_Edit_Impl::set_display_text(App_String _display_text) { display_text = _display_text; }
 
 //set a new theme color
 //need to release all parameters and reconfigure them given the new theme color
@@ -121,9 +121,24 @@ void Default_Effect_Edit_Impl::set_LED_color(RGB_LED::COLOR _theme_color) {
         release_parameter(prc);
 }
 
+//override the press behavior of a particular encoder
+//release the parameter so the new callback gets attached next time we render
+void Default_Effect_Edit_Impl::set_press_action(size_t index, Context_Callback_Function<void> action) {
+    if(index >= params_and_resources.size()) return;
+    Param_Resource_Collection& prc = params_and_resources[index];
+    release_parameter(prc);
+    prc.press_action = action;
+    prc.has_press_action = true;
+}
+
 //quick function to get a quick edit parameter
 Effect_Parameter* Default_Effect_Edit_Impl::get_quick_edit_param() { return quick_edit; }
 
+Effect_Parameter* Default_Effect_Edit_Impl::get_render_parameter(size_t index) {
+    if(index >= params_and_resources.size()) return nullptr;
+    return params_and_resources[index].param;
+}
+
 //================================= PRIVATE (CALLBACK) FUNCTION DEFS ==============================
 
 void Default_Effect_Edit_Impl::configure_parameter(Param_Resource_Collection& prc) {
@@ -149,7 +164,9 @@ void Default_Effect_Edit_Impl::configure_parameter(Param_Resource_Collection& pr
 
     //attach on press to save quick-edit parameter and go back to the home page
     //attaching pointer to particular prc instance as context --> this is OKAY since statically allocated
-    prc.enc->attach_on_press(Context_Callback_Function<void>(prc, set_quick_edit_leave_cb));
+    //unless the effect asked for a custom press action on this encoder
+    if(prc.has_press_action) prc.enc->attach_on_press(prc.press_action);
+    else prc.enc->attach_on_press(Context_Callback_Function<void>(prc, set_quick_edit_leave_cb));
 }
 
 void Default_Effect_Edit_Impl::release_parameter(Param_Resource_Collection& prc) {
@@ -70,13 +70,20 @@ public:
     //call these functions to set some of the rendering details for the effect
     //NOTE: for `set_render_parameter()` can pass `nullptr` to get rid of param at that index
     void set_render_parmeter(Effect_Parameter* param, size_t index);
-    void set_display_text(const std::string _display_text);
+    void set_display_text(App_String _display_text);
     void set_LED_color(RGB_LED::COLOR _theme_color);
 
+    //override what pressing the encoder at `index` does (default is to save it as the quick-edit parameter and leave)
+    //useful for effects that want a button action, e.g. tap tempo; only takes effect for non-null parameters
+    void set_press_action(size_t index, Context_Callback_Function<void> action);
+
     //provide a function to retrieve the quick edit parameter
     //likely useful for `get_quick_edit_param()` function in the effect interface
     Effect_Parameter* get_quick_edit_param();
 
+    //parameter at a particular index (nullptr if there isn't one)
+    Effect_Parameter* get_render_parameter(size_t index);
+
 private: 
     //create a struct that allows us to access an effect page and the index of the particular effect channel
     //need this if we want to access a specific LED, encoder, or parameter specific to this effect instance
@@ -89,6 +96,8 @@ private:
         RGB_LED* led;
         Scheduler led_sched;
         bool configured = false;
+        Context_Callback_Function<void> press_action;
+        bool has_press_action = false;
 
         //and a function to make an array of these
         //takes pointer to the current instance
@@ -144,7 +153,7 @@ private:
 
     //store some text that we'll render as a header on the screen
     //could theoretically edit this on the fly
-    std::string display_text = "";
+    App_String display_text = "";
 
     //save a color that corresponds to the effect's color theme (this is the color we'll light our LEDs with)
     RGB_LED::COLOR theme_color;
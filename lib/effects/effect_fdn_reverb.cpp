@@ -0,0 +1,204 @@
+#include <effect_fdn_reverb.h>
+
+#include <string.h> //memcpy, memset
+#include <math.h> //for computing line gains
+#include <dspinst.h> //for saturating and packed 16-bit instructions
+
+//scale a Q30 product back down to Q15, rounding towards zero
+static inline int32_t q15_truncate(int32_t product) {
+    return (product + ((product >> 31) & 0x7FFF)) >> 15;
+}
+
+//=========================== STATIC MEMBER VARIABLES =======================
+
+const Effect_Icon_t Effect_FDN_Reverb::icon = {
+    0xFC, 0xFF, 0xFF, 0x01, 0x06, 0x00, 0x00, 0x03, 0x03, 0x00, 0x00, 0x06,
+    0x01, 0x00, 0x00, 0x04, 0x01, 0x00, 0x00, 0x04, 0x11, 0x00, 0x00, 0x04,
+    0x11, 0x00, 0x00, 0x04, 0x51, 0x00, 0x00, 0x04, 0x51, 0x00, 0x00, 0x04,
+    0x51, 0x01, 0x00, 0x04, 0x51, 0x05, 0x00, 0x04, 0x51, 0x15, 0x00, 0x04,
+    0x51, 0x55, 0x00, 0x04, 0x51, 0x55, 0x01, 0x04, 0x51, 0x55, 0x05, 0x04,
+    0x51, 0x55, 0x15, 0x04, 0x51, 0x55, 0x55, 0x04, 0x51, 0x55, 0x55, 0x05,
+    0x51, 0x55, 0x55, 0x05, 0xF9, 0xFF, 0xFF, 0x04, 0x11, 0x00, 0x00, 0x04,
+    0x11, 0x00, 0x00, 0x04, 0x01, 0x00, 0x00, 0x04, 0x01, 0x00, 0x00, 0x04,
+    0xF9, 0x18, 0xFB, 0x04, 0xF9, 0x19, 0xFB, 0x05, 0x99, 0x1B, 0x9B, 0x05,
+    0x19, 0x1B, 0x9B, 0x05, 0x99, 0x1B, 0xFB, 0x04, 0xF9, 0x19, 0xFB, 0x04,
+    0xF9, 0x18, 0x9B, 0x05, 0xD9, 0xB0, 0x99, 0x05, 0x99, 0xE1, 0xF8, 0x05,
+    0x19, 0x43, 0xF8, 0x04, 0x01, 0x00, 0x00, 0x04, 0x01, 0x00, 0x00, 0x04,
+    0x01, 0x00, 0x00, 0x04, 0x01, 0x00, 0x00, 0x04, 0x03, 0x00, 0x00, 0x02,
+    0x06, 0x00, 0x00, 0x03, 0xFC, 0xFF, 0xFF, 0x00
+};
+
+//=========================== OVERRIDDEN PUBLIC FUNCTIONS =========================
+
+//save the name and effect theme color during initialization
+Effect_FDN_Reverb::Effect_FDN_Reverb(RGB_LED::COLOR _theme_color, App_String _name):
+    name(_name),
+    theme_color(_theme_color),
+    size(App_Strings::LABEL_SIZE, 25, 100, 1, 70, 0, App_Strings::UNITS_PERCENT.c_str()),
+    decay(App_Strings::LABEL_DECAY, 0.2, 8, 0.1, 1.5, 1, App_Strings::UNITS_S.c_str()),
+    damping(App_Strings::LABEL_DAMPING, 0, 90, 1, 40, 0, App_Strings::UNITS_PERCENT.c_str()),
+    mix(App_Strings::LABEL_MIX, 0, 100, 1, 25, 0, App_Strings::UNITS_PERCENT.c_str()),
+    effect_edit(to_return_page, leds, encs) //initialize our edit page implementation
+{
+    //set the header text and theme color for the effects edit menu
+    effect_edit.set_display_text(App_Strings::EDIT_REVERB);
+    effect_edit.set_LED_color(theme_color);
+
+    //set the parameters to edit/render in the edit menu
+    effect_edit.set_render_parmeter(&size, 0);
+    effect_edit.set_render_parmeter(&decay, 1);
+    effect_edit.set_render_parmeter(&damping, 2);
+    effect_edit.set_render_parmeter(&mix, 3);
+}
+
+//make sure we don't leak the delay lines if we get destroyed while still connected
+Effect_FDN_Reverb::~Effect_FDN_Reverb() {
+    disconnect();
+}
+
+//allocate and clear the delay lines, reset the filter state
+void Effect_FDN_Reverb::connect() {
+    if(lines != nullptr) return;
+
+    lines = (int16_t*)malloc(NUM_LINES * LINE_CAPACITY * sizeof(int16_t));
+    if(lines == nullptr) return; //couldn't get the memory, just pass audio through
+
+    memset(lines, 0, NUM_LINES * LINE_CAPACITY * sizeof(int16_t));
+    damping_state.fill(0);
+    write_pos = 0;
+}
+
+//free up the delay lines
+void Effect_FDN_Reverb::disconnect() {
+    free(lines);
+    lines = nullptr;
+}
+
+//################# CORE OF THE EFFECT ###################
+
+void Effect_FDN_Reverb::audio_update(const Audio_Block_t& block_in, Audio_Block_t& block_out) {
+    //no delay lines --> just pass the audio through
+    if(lines == nullptr) {
+        block_out = block_in;
+        return;
+    }
+
+    //synchronize our parameters for reading/rendering
+    size.synchronize();
+    decay.synchronize();
+    damping.synchronize();
+    mix.synchronize();
+
+    //recompute coefficients if any of the parameters that affect them have changed
+    if(size.get() != prev_size || decay.get() != prev_decay || damping.get() != prev_damping)
+        update_coeffs();
+
+    const int32_t wet_q15 = (int32_t)(mix.get() * 327.67f);
+    const int32_t dry_q15 = 32767 - wet_q15;
+    const size_t BLOCK_SIZE = block_in.size();
+
+    //read a whole block out of every line
+    //lines are all longer than a block, so none of these samples depend on what we're about to write
+    for(size_t k = 0; k < NUM_LINES; k++) {
+        const int16_t* line = lines + k * LINE_CAPACITY;
+        size_t read_pos = (write_pos + LINE_CAPACITY - line_lengths[k]) & (LINE_CAPACITY - 1);
+        size_t first_copy = min(BLOCK_SIZE, LINE_CAPACITY - read_pos);
+        memcpy(line_out[k].data(), line + read_pos, first_copy * sizeof(int16_t));
+        if(first_copy < BLOCK_SIZE)
+            memcpy(line_out[k].data() + first_copy, line, (BLOCK_SIZE - first_copy) * sizeof(int16_t));
+    }
+
+    /*
+     * Run the line outputs through the Hadamard matrix, two samples at a time
+     *      \--> first butterfly stage uses saturating adds/subtracts, second stage uses halving adds/subtracts
+     *      \--> overall gain of 1/2 makes the 4x4 Hadamard matrix orthonormal, so the network is lossless before the line gains
+     */
+    for(size_t n = 0; n < BLOCK_SIZE; n += 2) {
+        uint32_t y0 = *reinterpret_cast<const uint32_t*>(&line_out[0][n]);
+        uint32_t y1 = *reinterpret_cast<const uint32_t*>(&line_out[1][n]);
+        uint32_t y2 = *reinterpret_cast<const uint32_t*>(&line_out[2][n]);
+        uint32_t y3 = *reinterpret_cast<const uint32_t*>(&line_out[3][n]);
+
+        uint32_t sum_01 = signed_add_16_and_16(y0, y1);
+        uint32_t diff_01 = signed_subtract_16_and_16(y0, y1);
+        uint32_t sum_23 = signed_add_16_and_16(y2, y3);
+        uint32_t diff_23 = signed_subtract_16_and_16(y2, y3);
+
+        *reinterpret_cast<uint32_t*>(&mixed[0][n]) = signed_halving_add_16_and_16(sum_01, sum_23);
+        *reinterpret_cast<uint32_t*>(&mixed[1][n]) = signed_halving_add_16_and_16(diff_01, diff_23);
+        *reinterpret_cast<uint32_t*>(&mixed[2][n]) = signed_halving_subtract_16_and_16(sum_01, sum_23);
+        *reinterpret_cast<uint32_t*>(&mixed[3][n]) = signed_halving_subtract_16_and_16(diff_01, diff_23);
+    }
+
+    //apply the decay gain and damping filter to each line, add in the input, and write the result straight into the line
+    //`write_pos` is always a multiple of the block size and the capacity is too, so this never wraps
+    for(size_t k = 0; k < NUM_LINES; k++) {
+        int16_t* line = lines + k * LINE_CAPACITY + write_pos;
+        const int32_t gain = line_gains_q15[k];
+        int32_t lp = damping_state[k];
+
+        //truncate the products towards zero; plain shifts (or rounding) let the tail get stuck in a low-level limit cycle
+        for(size_t n = 0; n < BLOCK_SIZE; n++) {
+            int32_t v = q15_truncate(mixed[k][n] * gain);
+            lp = v + q15_truncate((lp - v) * damping_q15);
+            line[n] = (int16_t)signed_saturate_rshift(lp * 32768 + block_in[n] * INPUT_GAIN_Q15, 16, 15);
+        }
+
+        damping_state[k] = lp;
+    }
+
+    //tap the wet signal off the second row of the mixing matrix (alternating signs decorrelate it from the input a bit)
+    //mix it in with the dry signal
+    for(size_t n = 0; n < BLOCK_SIZE; n++)
+        block_out[n] = (int16_t)signed_saturate_rshift(block_in[n] * dry_q15 + mixed[1][n] * wet_q15, 16, 15);
+
+    write_pos = (write_pos + BLOCK_SIZE) & (LINE_CAPACITY - 1);
+}
+
+//recompute line lengths, line gains, and the damping coefficient
+//only runs when a parameter changes, so it's okay to do a little bit of floating point math here
+void Effect_FDN_Reverb::update_coeffs() {
+    prev_size = size.get();
+    prev_decay = decay.get();
+    prev_damping = damping.get();
+
+    //scale the line lengths, each line needs to be at least a block long
+    //then pick each line's gain so it decays by 60dB over the decay time: g = 10^(-3 * length / (RT60 * fs))
+    for(size_t k = 0; k < NUM_LINES; k++) {
+        line_lengths[k] = max((uint32_t)(LINE_LENGTHS[k] * prev_size / 100.0f), (uint32_t)App_Constants::PROCESSING_BLOCK_SIZE);
+        float gain = powf(10.0f, -3.0f * line_lengths[k] / (prev_decay * App_Constants::AUDIO_SAMPLE_RATE_HZ));
+        line_gains_q15[k] = (int32_t)(gain * 32767.0f);
+    }
+
+    damping_q15 = (int32_t)(prev_damping * 327.67f);
+}
+
+//################# end CORE OF THE EFFECT ###################
+
+App_String Effect_FDN_Reverb::get_name() { return name; }
+const Effect_Icon_t& Effect_FDN_Reverb::get_icon() { return icon; }
+RGB_LED::COLOR Effect_FDN_Reverb::get_theme_color() { return theme_color; }
+Effect_Parameter* Effect_FDN_Reverb::get_quick_edit_param() { return effect_edit.get_quick_edit_param(); }
+Effect_Parameter* Effect_FDN_Reverb::get_param(size_t index) { return effect_edit.get_render_parameter(index); }
+
+//=========================== OVERRIDDEN PRIVATE FUNCTIONS =========================
+
+//override our entry function --> call our default implementation
+//configuration of render resources
+void Effect_FDN_Reverb::impl_on_entry() {
+    //run the entry function in our edit menu implementation
+    effect_edit.configure_render_resources();
+}
+
+//override our exit function --> call our default implementation
+//release all the render resources
+void Effect_FDN_Reverb::impl_on_exit() {
+    //run the exit function in our edit menu implementation
+    effect_edit.release_render_resources();
+}
+
+void Effect_FDN_Reverb::draw() {
+    //call the render function of our edit menu implemenation
+    //pass it the global graphics handle
+    effect_edit.render(graphics_handle);
+}
@@ -0,0 +1,103 @@
+#pragma once
+
+/**
+ * Feedback delay network reverb
+ *  - four delay lines, mixed through a (normalized) 4x4 Hadamard matrix on the way back into the lines
+ *  - each line has a gain setting its decay time and a one-pole lowpass for high-frequency damping
+ *  - size, decay time, damping, and wet/dry mix on their own encoders
+ *
+ * Everything is done a block at a time:
+ *      \--> every line is at least a block long, so a whole block of line outputs can be read before any of them are written
+ *      \--> the Hadamard mix runs on pairs of Q15 samples using the packed 16-bit add/subtract instructions
+ *      \--> the block fed back into each line is written with a single contiguous copy (line capacity is a multiple of the block size)
+ *
+ * Delay lines are allocated when the effect is added to the signal chain and freed when it's removed
+*/
+
+#include <array>
+#include <string>
+
+#include <effect_interface.h> //implements interface specified here
+#include <effect_edit/default_effect_edit_impl.h> //effect menu implementation
+#include <effect_param_num_lin.h>   //              ""
+
+class Effect_FDN_Reverb : public Effect_Interface {
+public:
+    //save the theme color and name the effect was registered with
+    Effect_FDN_Reverb(RGB_LED::COLOR _theme_color, App_String _name);
+
+    //release the delay lines if we still own them
+    ~Effect_FDN_Reverb();
+
+    //allocate the delay lines when we get added to the effect chain, free them when we're removed
+    void connect() override;
+    void disconnect() override;
+
+    //provide implementations for the following functions:
+    void audio_update(const Audio_Block_t& block_in, Audio_Block_t& block_out) override;
+    App_String get_name() override;
+    const Effect_Icon_t& get_icon() override;
+    RGB_LED::COLOR get_theme_color() override;
+    Effect_Parameter* get_quick_edit_param() override;
+    Effect_Parameter* get_param(size_t index) override;
+
+    //icon for the effect, constant for all instances
+    //public so the effect registry can point at it without an instance
+    static const Effect_Icon_t icon;
+
+private:
+    //define the implementations for the effect edit menu
+    //will use the `default_effect_edit_implementation` to handle editing and rendering our parameter menu
+    void draw() override;
+    void impl_on_entry() override;
+    void impl_on_exit() override;
+
+    //recompute line lengths, line gains, and the damping coefficient from the parameters
+    void update_coeffs();
+
+    //have a particular name and theme for our instance
+    const App_String name;
+    const RGB_LED::COLOR theme_color;
+
+    //network dimensions
+    //line lengths (in samples, at full size) are mutually prime so their echoes don't pile up on each other
+    //line capacity is a power of two (for cheap wrapping) and a multiple of the block size
+    static constexpr size_t NUM_LINES = 4;
+    static constexpr std::array<uint32_t, NUM_LINES> LINE_LENGTHS = {1553, 1907, 2311, 2767};
+    static constexpr size_t LINE_CAPACITY = 4096;
+    static_assert(LINE_CAPACITY % App_Constants::PROCESSING_BLOCK_SIZE == 0, "Line capacity must be a multiple of the block size!");
+
+    //how much of the input gets injected into each line (Q15)
+    static constexpr int32_t INPUT_GAIN_Q15 = 16384;
+
+    //parameters of the effect
+    Effect_Parameter_Num_Lin size;      //percent of the full line lengths
+    Effect_Parameter_Num_Lin decay;     //RT60, seconds
+    Effect_Parameter_Num_Lin damping;   //percent
+    Effect_Parameter_Num_Lin mix;       //percent wet
+
+    //parameter values the current coefficients were computed with
+    //start with bogus values to force a computation
+    float prev_size = -1;
+    float prev_decay = -1;
+    float prev_damping = -1;
+
+    //delay lines (one allocation holding all of them), along with the shared write position
+    int16_t* lines = nullptr;
+    size_t write_pos = 0;
+
+    //per-line coefficients and state
+    std::array<uint32_t, NUM_LINES> line_lengths = LINE_LENGTHS;
+    std::array<int32_t, NUM_LINES> line_gains_q15 = {0};
+    std::array<int32_t, NUM_LINES> damping_state = {0};
+    int32_t damping_q15 = 0;
+
+    //block-sized scratch space for the outputs of the lines and the mixing matrix
+    //aligned so we can operate on pairs of samples at a time
+    alignas(4) std::array<std::array<int16_t, App_Constants::PROCESSING_BLOCK_SIZE>, NUM_LINES> line_out;
+    alignas(4) std::array<std::array<int16_t, App_Constants::PROCESSING_BLOCK_SIZE>, NUM_LINES> mixed;
+
+    //have an instance of our `default_effect_edit_impl`
+    //to actually handle our edit menu
+    Default_Effect_Edit_Impl effect_edit;
+};
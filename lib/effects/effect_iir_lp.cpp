@@ -25,25 +25,20 @@ const Effect_Icon_t Effect_IIR_LP::icon = {
 //=========================== OVERRIDDEN PUBLIC FUNCTIONS =========================
 
 //save the name and effect theme color during initialization
-Effect_IIR_LP::Effect_IIR_LP():
-    name("IIR Low-pass"),
-    theme_color(RGB_LED::YELLOW),
-    f_cutoff("Cutoff", 500, 10000, 40, 1000),
+Effect_IIR_LP::Effect_IIR_LP(RGB_LED::COLOR _theme_color, App_String _name):
+    name(_name),
+    theme_color(_theme_color),
+    f_cutoff(App_Strings::LABEL_CUTOFF, 500, 10000, 40, 1000, 0, App_Strings::UNITS_HZ.c_str()),
     effect_edit(to_return_page, leds, encs) //initialize our edit page implementation
 {
     //set the header text and theme color for the effects edit menu
-    effect_edit.set_display_text("Edit Cutoff Freq");
+    effect_edit.set_display_text(App_Strings::EDIT_CUTOFF);
     effect_edit.set_LED_color(theme_color);
 
     //set the parameters to edit/render in the edit menu
     effect_edit.set_render_parmeter(&f_cutoff, 2);
 }
 
-//copy constructor that invokes the default constructor above
-Effect_IIR_LP::Effect_IIR_LP(const Effect_IIR_LP& other):
-    Effect_IIR_LP()
-{}
-
 //################# CORE OF THE EFFECT ###################
 
 void Effect_IIR_LP::audio_update(const Audio_Block_t& block_in, Audio_Block_t& block_out) {
@@ -97,16 +92,11 @@ void Effect_IIR_LP::audio_update(const Audio_Block_t& block_in, Audio_Block_t& b
 
 //################# end CORE OF THE EFFECT ###################
 
-//function we call to actually instantiate a new effect on the heap
-//return a unique pointer to automatically manage this heap memory
-std::unique_ptr<Effect_Interface> Effect_IIR_LP::clone() {
-    return std::make_unique<Effect_IIR_LP>(*new Effect_IIR_LP(*this));
-}
-
-std::string Effect_IIR_LP::get_name() { return name; }
-Effect_Icon_t Effect_IIR_LP::get_icon() { return icon; }
+App_String Effect_IIR_LP::get_name() { return name; }
+const Effect_Icon_t& Effect_IIR_LP::get_icon() { return icon; }
 RGB_LED::COLOR Effect_IIR_LP::get_theme_color() { return theme_color; }
 Effect_Parameter* Effect_IIR_LP::get_quick_edit_param() { return effect_edit.get_quick_edit_param(); }
+Effect_Parameter* Effect_IIR_LP::get_param(size_t index) { return effect_edit.get_render_parameter(index); }
 
 //=========================== OVERRIDDEN PRIVATE FUNCTIONS =========================
 
@@ -18,23 +18,20 @@
 
 class Effect_IIR_LP : public Effect_Interface {
 public:
-    //default constructor -- just call the base class constructor
-    Effect_IIR_LP();
-
-    //need to have a non-default copy constructor--> need to freshly instantiate the `effect_edit` param
-    //we'll invoke the default constructor using the theme color and name from the `other`
-    Effect_IIR_LP(const Effect_IIR_LP& other);
-    
-    //implement the clone function to produce instances of this effect that are copies of the original
-    //need to override base class so we produce copies of the derived class instead
-    std::unique_ptr<Effect_Interface> clone() override;
+    //save the theme color and name the effect was registered with
+    Effect_IIR_LP(RGB_LED::COLOR _theme_color, App_String _name);
 
     //provide implementations for the following functions:
     void audio_update(const Audio_Block_t& block_in, Audio_Block_t& block_out) override;
-    std::string get_name() override;
-    Effect_Icon_t get_icon() override;
+    App_String get_name() override;
+    const Effect_Icon_t& get_icon() override;
     RGB_LED::COLOR get_theme_color() override;
     Effect_Parameter* get_quick_edit_param() override; 
+    Effect_Parameter* get_param(size_t index) override;
+
+    //icon for the effect, constant for all instances
+    //public so the effect registry can point at it without an instance
+    static const Effect_Icon_t icon;
 
 private:
     //define the implementations for the effect edit menu
@@ -43,11 +40,8 @@ private:
     void impl_on_entry() override;
     void impl_on_exit() override;
     
-    //have an icon for the effect, will be constant for all instances
-    static const Effect_Icon_t icon;
-
     //have a particular name and theme for our instance
-    const std::string name; 
+    const App_String name; 
     const RGB_LED::COLOR theme_color;    
 
     //have a parameter that sets the cutoff frequency of the filter
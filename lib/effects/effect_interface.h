@@ -19,15 +19,19 @@
  *      - get the parameters (read into local variables as necessary); act on the parameter changes
  *      - run through the audio block and apply the effect
  *  
- *  - std::string get_name() 
+ *  - App_String get_name() 
  *      >>> return the name of the effect
  *      
  *  
- *  - Effect_Icon_t get_icon()
+ *  - Effect_Parameter* get_param(size_t index)
+ *      >>> return the parameter at the index (same order as the edit page), or nullptr
+ *  
+ *  - const Effect_Icon_t& get_icon()
  *      >>> return the graphic icon for the pedal to be rendered on the home screen
  *      - I can't enforce (in a reconfigurable way) that an icon member variable exists
  *              but this is the next best thing
- *      - return an icon as an XBM-style array for the effect home screen artwork
+ *      - return a reference to an XBM-style array for the effect home screen artwork
+ *      - icons are static and constant (i.e. live in flash), so the reference stays good for the life of the program
  * 
  * Each effect interface will also inherit from the effect edit screen 
  *  - point the `display_name` to a string containing the display name
@@ -39,13 +43,13 @@
 
 #include <array>
 #include <string>
-#include <memory> //unique_ptr
 #include <Arduino.h>
 
 #include <ui_page.h> //effect interface is an effect edit page
 #include <effect_param.h> //for quick edit parameters
 #include <rgb.h> //for colors
 #include <config.h> //for audio block size
+#include <app_strings.h> //for names
 
 //defining this icon type outside of the class
 typedef std::array<uint8_t, (App_Constants::EFFECT_ICON_WIDTH + 7)/8 * App_Constants::EFFECT_ICON_HEIGHT> Effect_Icon_t;
@@ -54,6 +58,11 @@ class Effect_Interface : public UI_Page {
 public:
     Effect_Interface(): to_return_page() {} //default constructor just initializes the page transition
 
+    //effects are only ever constructed fresh from the registry, never copied
+    //edit pages hold pointers to the instance's own parameters, so a copy would end up editing the original
+    Effect_Interface(const Effect_Interface& other) = delete;
+    void operator=(const Effect_Interface& other) = delete;
+
     //need to declare the base desctructor as virtual
     //this ensures that calls to `delete Effect_Interface*` get redirected to derived destructors
     //extra important since if we don't do this, `std::unique_prt<Effect_Interface>` will only call the base destructor
@@ -73,22 +82,16 @@ public:
     //implemented by children
     virtual void disconnect() {}
 
-    //heap-allocate a copy of an instance
-    //and return a `unique_ptr<Effect_Parameter> that dereferences to that heap location
-    //need to implement in derived classes since we need the derived copy constructor
-    //leveraging copy elision to make this function happen (since `std::unique_ptr` has deleted copy constructor)
-    //implemented by children; default implementation creates a base class instance
-    virtual std::unique_ptr<Effect_Interface> clone() { return std::make_unique<Effect_Interface>(*new Effect_Interface(*this)); }
-
     //CORE OF THE EFFECT: actually run the effect with audio data
     //don't modify the input buffer, but can modify the output buffer
     virtual void audio_update(const Audio_Block_t& block_in, Audio_Block_t& block_out) {}
 
     //all effects must be able to return their name (to select them from a menu)
-    virtual std::string get_name() { return "Default Name"; } //return some generic string as a name
+    virtual App_String get_name() { return App_Strings::EFFECT_DEFAULT; } //return some generic string as a name
 
     //all effects must be able to return an icon (of the specified dimensions) to render them on the home screen
-    virtual Effect_Icon_t get_icon() { return {0}; } //return an empty icon by default
+    //returned by reference so callers can hang onto it instead of copying the bitmap
+    virtual const Effect_Icon_t& get_icon() { return EMPTY_ICON; } //return an empty icon by default
 
     //all effects must be able to return a theme color for lighting LEDs on the home screen
     virtual RGB_LED::COLOR get_theme_color() { return RGB_LED::PURPLE; } //return purple by default
@@ -97,7 +100,14 @@ public:
     //nullptr is a valid option if no quick edit parameters are to be available
     virtual Effect_Parameter* get_quick_edit_param() { return nullptr; } //return nullptr by default
 
+    //effects with editable parameters should expose them by index (up to `NUM_EDIT_PARAMS`, same order as the edit page)
+    //lets things other than the edit page (e.g. remote control) get at them; nullptr means no parameter at that index
+    virtual Effect_Parameter* get_param(size_t index) { return nullptr; } //no parameters by default
+
 protected:
+    //default icon for effects that don't have one
+    static constexpr Effect_Icon_t EMPTY_ICON = {0};
+
     //override entry, exit, and draw functions from the `UI_Page()` class
     //these are called when the effect edit menu is invoked
     //allow overriding by children too
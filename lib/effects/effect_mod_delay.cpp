@@ -0,0 +1,108 @@
+#include <effect_mod_delay.h>
+
+//=========================== STATIC MEMBER VARIABLES - PRESETS =======================
+
+//center, max depth, default depth (ms), default rate (Hz), min/default feedback, default mix (%), interpolation
+const Effect_Mod_Delay::Preset Effect_Mod_Delay::CHORUS = {15, 8, 3, 0.8, 0, 0, 40, Mod_Delay::LINEAR};
+const Effect_Mod_Delay::Preset Effect_Mod_Delay::FLANGER = {2.5, 2.4, 2, 0.25, -90, 60, 50, Mod_Delay::ALLPASS};
+const Effect_Mod_Delay::Preset Effect_Mod_Delay::VIBRATO = {6, 5, 2, 5, 0, 0, 100, Mod_Delay::LINEAR};
+
+//=========================== STATIC MEMBER VARIABLES - ICON =======================
+
+const Effect_Icon_t Effect_Mod_Delay::icon = {
+    0xFC, 0xFF, 0xFF, 0x01, 0x06, 0x00, 0x00, 0x03, 0x03, 0x00, 0x00, 0x06,
+    0x01, 0x00, 0x00, 0x04, 0x01, 0x00, 0x00, 0x04, 0x11, 0x00, 0x00, 0x04,
+    0x11, 0x0E, 0x00, 0x04, 0x11, 0x1B, 0x00, 0x04, 0x91, 0x31, 0x00, 0x04,
+    0x91, 0x60, 0x00, 0x04, 0xD1, 0x40, 0x00, 0x04, 0x51, 0xC0, 0x00, 0x04,
+    0x71, 0x80, 0x00, 0x05, 0x11, 0x80, 0x01, 0x05, 0x11, 0x00, 0x81, 0x05,
+    0x11, 0x00, 0x83, 0x04, 0x11, 0x00, 0xC6, 0x04, 0x11, 0x00, 0x6C, 0x04,
+    0x11, 0x00, 0x38, 0x04, 0xF9, 0xFF, 0xFF, 0x04, 0x11, 0x00, 0x00, 0x04,
+    0x11, 0x00, 0x00, 0x04, 0x01, 0x00, 0x00, 0x04, 0x01, 0x00, 0x00, 0x04,
+    0x19, 0x63, 0x7C, 0x04, 0xB9, 0xF3, 0xFC, 0x04, 0xF9, 0x9B, 0xCD, 0x04,
+    0x59, 0x9B, 0xCD, 0x04, 0x59, 0x9B, 0xCD, 0x04, 0x19, 0x9B, 0xCD, 0x04,
+    0x19, 0x9B, 0xCD, 0x04, 0x19, 0x9B, 0xCD, 0x04, 0x19, 0xF3, 0xFC, 0x04,
+    0x19, 0x63, 0x7C, 0x04, 0x01, 0x00, 0x00, 0x04, 0x01, 0x00, 0x00, 0x04,
+    0x01, 0x00, 0x00, 0x04, 0x01, 0x00, 0x00, 0x04, 0x03, 0x00, 0x00, 0x02,
+    0x06, 0x00, 0x00, 0x03, 0xFC, 0xFF, 0xFF, 0x00
+};
+
+//=========================== OVERRIDDEN PUBLIC FUNCTIONS =========================
+
+//save the name, effect theme color, and preset; set up the parameter ranges from the preset
+Effect_Mod_Delay::Effect_Mod_Delay(RGB_LED::COLOR _theme_color, App_String _name, App_String _edit_text, const Preset& _preset):
+    name(_name),
+    edit_text(_edit_text),
+    theme_color(_theme_color),
+    preset(_preset),
+    rate(App_Strings::LABEL_RATE, 0.05, 10, 0.05, _preset.default_rate_hz, 2, App_Strings::UNITS_HZ.c_str()),
+    depth(App_Strings::LABEL_DEPTH, 0, _preset.max_depth_ms, 0.1, _preset.default_depth_ms, 1, App_Strings::UNITS_MS.c_str()),
+    feedback(App_Strings::LABEL_FEEDBACK, _preset.min_feedback, 90, 1, _preset.default_feedback, 0, App_Strings::UNITS_PERCENT.c_str()),
+    mix(App_Strings::LABEL_MIX, 0, 100, 1, _preset.default_mix, 0, App_Strings::UNITS_PERCENT.c_str()),
+    effect_edit(to_return_page, leds, encs) //initialize our edit page implementation
+{
+    //set the header text and theme color for the effects edit menu
+    effect_edit.set_display_text(edit_text);
+    effect_edit.set_LED_color(theme_color);
+
+    //set the parameters to edit/render in the edit menu
+    effect_edit.set_render_parmeter(&rate, 0);
+    effect_edit.set_render_parmeter(&depth, 1);
+    effect_edit.set_render_parmeter(&feedback, 2);
+    effect_edit.set_render_parmeter(&mix, 3);
+
+    //interpolation is fixed by the preset
+    mod_delay.set_interpolation(preset.interpolation);
+}
+
+//################# CORE OF THE EFFECT ###################
+
+void Effect_Mod_Delay::audio_update(const Audio_Block_t& block_in, Audio_Block_t& block_out) {
+    //synchronize our parameters for reading/rendering
+    rate.synchronize();
+    depth.synchronize();
+    feedback.synchronize();
+    mix.synchronize();
+
+    //reconfigure the engine if anything has changed
+    std::array<float, 4> params = {rate.get(), depth.get(), feedback.get(), mix.get()};
+    if(params != computed_params) {
+        computed_params = params;
+        mod_delay.set_rate(rate.get());
+        mod_delay.set_delay(preset.center_ms, depth.get());
+        mod_delay.set_feedback(feedback.get() / 100.0f);
+        mod_delay.set_mix(mix.get() / 100.0f);
+    }
+
+    //and run the modulated delay
+    mod_delay.process(block_in, block_out);
+}
+
+//################# end CORE OF THE EFFECT ###################
+
+App_String Effect_Mod_Delay::get_name() { return name; }
+const Effect_Icon_t& Effect_Mod_Delay::get_icon() { return icon; }
+RGB_LED::COLOR Effect_Mod_Delay::get_theme_color() { return theme_color; }
+Effect_Parameter* Effect_Mod_Delay::get_quick_edit_param() { return effect_edit.get_quick_edit_param(); }
+Effect_Parameter* Effect_Mod_Delay::get_param(size_t index) { return effect_edit.get_render_parameter(index); }
+
+//=========================== OVERRIDDEN PRIVATE FUNCTIONS =========================
+
+//override our entry function --> call our default implementation
+//configuration of render resources
+void Effect_Mod_Delay::impl_on_entry() {
+    //run the entry function in our edit menu implementation
+    effect_edit.configure_render_resources();
+}
+
+//override our exit function --> call our default implementation
+//release all the render resources
+void Effect_Mod_Delay::impl_on_exit() {
+    //run the exit function in our edit menu implementation
+    effect_edit.release_render_resources();
+}
+
+void Effect_Mod_Delay::draw() {
+    //call the render function of our edit menu implemenation
+    //pass it the global graphics handle
+    effect_edit.render(graphics_handle);
+}
@@ -0,0 +1,94 @@
+#pragma once
+
+/**
+ * Modulation effects (chorus/flanger/vibrato) built on a single modulated delay engine
+ *  - rate, depth, feedback, and mix on their own encoders
+ *  - each flavor is just a preset: center delay, depth range, defaults, and interpolation type
+ *
+ * Presets:
+ *      \--> chorus: ~15ms center delay, linear interpolation, mostly dry
+ *      \--> flanger: short ~2.5ms center delay with feedback, allpass interpolation to keep the notches deep
+ *      \--> vibrato: fully wet, no feedback, linear interpolation
+*/
+
+#include <array>
+#include <string>
+
+#include <effect_interface.h> //implements interface specified here
+#include <effect_edit/default_effect_edit_impl.h> //effect menu implementation
+#include <effect_param_num_lin.h>   //              ""
+#include <effect_dsp/mod_delay.h> //does all the actual work
+
+class Effect_Mod_Delay : public Effect_Interface {
+public:
+    //###################################################################################
+
+    //everything that makes one modulation effect different from another
+    struct Preset {
+        float center_ms;            //center of the delay sweep
+        float max_depth_ms;         //top end of the depth parameter
+        float default_depth_ms;
+        float default_rate_hz;
+        float min_feedback;         //percent; flangers get to go negative
+        float default_feedback;     //percent
+        float default_mix;          //percent
+        Mod_Delay::Interpolation interpolation;
+    };
+
+    //###################################################################################
+
+    //default constructor -- save the configuration of this flavor
+    //`_edit_text` is the header of the edit page
+    Effect_Mod_Delay(RGB_LED::COLOR _theme_color, App_String _name, App_String _edit_text, const Preset& _preset);
+
+    //provide implementations for the following functions:
+    void audio_update(const Audio_Block_t& block_in, Audio_Block_t& block_out) override;
+    App_String get_name() override;
+    const Effect_Icon_t& get_icon() override;
+    RGB_LED::COLOR get_theme_color() override;
+    Effect_Parameter* get_quick_edit_param() override;
+    Effect_Parameter* get_param(size_t index) override;
+
+    //################################################################################
+    //Add different flavors of modulation effects here
+
+    static const Preset CHORUS;
+    static const Preset FLANGER;
+    static const Preset VIBRATO;
+
+    //################################################################################
+
+    //icon for the effect, shared between all the flavors
+    //public so the effect registry can point at it without an instance
+    static const Effect_Icon_t icon;
+
+private:
+    //define the implementations for the effect edit menu
+    //will use the `default_effect_edit_implementation` to handle editing and rendering our parameter menu
+    void draw() override;
+    void impl_on_entry() override;
+    void impl_on_exit() override;
+
+    //have a particular name, theme, and preset for our instance
+    const App_String name;
+    const App_String edit_text;
+    const RGB_LED::COLOR theme_color;
+    const Preset& preset;
+
+    //parameters of the effect
+    Effect_Parameter_Num_Lin rate;      //Hz
+    Effect_Parameter_Num_Lin depth;     //ms
+    Effect_Parameter_Num_Lin feedback;  //percent
+    Effect_Parameter_Num_Lin mix;       //percent
+
+    //parameter values the engine was last configured with
+    //start with bogus values to force a computation
+    std::array<float, 4> computed_params = {-1000, -1000, -1000, -1000};
+
+    //the modulated delay line
+    Mod_Delay mod_delay;
+
+    //have an instance of our `default_effect_edit_impl`
+    //to actually handle our edit menu
+    Default_Effect_Edit_Impl effect_edit;
+};
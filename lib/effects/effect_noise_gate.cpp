@@ -0,0 +1,149 @@
+#include <effect_noise_gate.h>
+
+#include <math.h> //for dB conversions
+#include <dspinst.h> //for fixed-point multiplies
+#include <effect_dsp/dsp_helpers.h> //for block peak and exponential decay
+
+//=========================== STATIC MEMBER VARIABLES =======================
+
+const Effect_Icon_t Effect_Noise_Gate::icon = {
+    0xFC, 0xFF, 0xFF, 0x01, 0x06, 0x00, 0x00, 0x03, 0x03, 0x00, 0x00, 0x06,
+    0x01, 0x00, 0x00, 0x04, 0x01, 0x00, 0x00, 0x04, 0x11, 0x00, 0x00, 0x04,
+    0x11, 0x00, 0x00, 0x04, 0x11, 0x00, 0x00, 0x04, 0x11, 0xFC, 0x01, 0x04,
+    0x11, 0x02, 0x02, 0x04, 0x11, 0x02, 0x04, 0x04, 0x11, 0x01, 0x04, 0x04,
+    0x11, 0x01, 0x08, 0x04, 0x11, 0x01, 0x08, 0x04, 0x91, 0x00, 0x10, 0x04,
+    0x91, 0x00, 0x10, 0x04, 0x91, 0x00, 0x20, 0x04, 0x51, 0x00, 0x40, 0x04,
+    0x71, 0x00, 0xC0, 0x05, 0xF9, 0xFF, 0xFF, 0x04, 0x11, 0x00, 0x00, 0x04,
+    0x11, 0x00, 0x00, 0x04, 0x01, 0x00, 0x00, 0x04, 0x01, 0x00, 0x00, 0x04,
+    0x79, 0xE6, 0x7B, 0x04, 0x0D, 0x89, 0x08, 0x04, 0x0D, 0x89, 0x08, 0x04,
+    0x0D, 0x89, 0x08, 0x04, 0x6D, 0x8F, 0x38, 0x04, 0x4D, 0x89, 0x08, 0x04,
+    0x4D, 0x89, 0x08, 0x04, 0x4D, 0x89, 0x08, 0x04, 0x79, 0x89, 0x78, 0x04,
+    0x01, 0x00, 0x00, 0x04, 0x01, 0x00, 0x00, 0x04, 0x01, 0x00, 0x00, 0x04,
+    0x01, 0x00, 0x00, 0x04, 0x01, 0x00, 0x00, 0x04, 0x03, 0x00, 0x00, 0x02,
+    0x06, 0x00, 0x00, 0x03, 0xFC, 0xFF, 0xFF, 0x00
+};
+
+//=========================== OVERRIDDEN PUBLIC FUNCTIONS =========================
+
+//save the name and effect theme color during initialization
+Effect_Noise_Gate::Effect_Noise_Gate(RGB_LED::COLOR _theme_color, App_String _name):
+    name(_name),
+    theme_color(_theme_color),
+    threshold(App_Strings::LABEL_THRESHOLD, -80, -20, 1, -55, 0, App_Strings::UNITS_DB.c_str()),
+    hysteresis(App_Strings::LABEL_HYSTERESIS, 0, 20, 1, 6, 0, App_Strings::UNITS_DB.c_str()),
+    attack(App_Strings::LABEL_ATTACK, 0.5, 20, 0.5, 1, 1, App_Strings::UNITS_MS.c_str()),
+    hold(App_Strings::LABEL_HOLD, 0, 500, 10, 50, 0, App_Strings::UNITS_MS.c_str()),
+    release(App_Strings::LABEL_RELEASE, 5, 500, 5, 100, 0, App_Strings::UNITS_MS.c_str()),
+    effect_edit(to_return_page, leds, encs) //initialize our edit page implementation
+{
+    //set the header text and theme color for the effects edit menu
+    effect_edit.set_display_text(App_Strings::EDIT_NOISE_GATE);
+    effect_edit.set_LED_color(theme_color);
+
+    //set the parameters to edit/render in the edit menu
+    effect_edit.set_render_parmeter(&threshold, 0);
+    effect_edit.set_render_parmeter(&hysteresis, 1);
+    effect_edit.set_render_parmeter(&attack, 2);
+    effect_edit.set_render_parmeter(&hold, 3);
+    effect_edit.set_render_parmeter(&release, 4);
+}
+
+//################# CORE OF THE EFFECT ###################
+
+void Effect_Noise_Gate::audio_update(const Audio_Block_t& block_in, Audio_Block_t& block_out) {
+    //synchronize our parameters for reading/rendering
+    threshold.synchronize();
+    hysteresis.synchronize();
+    attack.synchronize();
+    hold.synchronize();
+    release.synchronize();
+
+    //recompute thresholds and coefficients if anything has changed
+    std::array<float, 5> params = {threshold.get(), hysteresis.get(), attack.get(), hold.get(), release.get()};
+    if(params != computed_params) update_coeffs();
+
+    //run the detector on the whole block
+    //open immediately if we've crossed the threshold, start counting down the hold time once we're under the hysteresis band
+    int32_t peak = block_peak_q15(block_in);
+    if(peak > open_threshold) {
+        gate_open = true;
+        hold_remaining = hold_blocks;
+    }
+    else if(gate_open && peak < close_threshold) {
+        if(hold_remaining > 0) hold_remaining--;
+        else gate_open = false;
+    }
+
+    //steady state --> nothing to compute, just copy or mute the block
+    if(gate_open && gain == GAIN_UNITY) {
+        block_out = block_in;
+        return;
+    }
+    if(!gate_open && gain == 0) {
+        block_out.fill(0);
+        return;
+    }
+
+    //transitioning --> ramp the gain a sample at a time
+    //opening ramps the distance to unity down exponentially, closing ramps the gain itself down exponentially
+    for(size_t i = 0; i < block_in.size(); i++) {
+        if(gate_open) {
+            int32_t remaining = apply_decay_q31(GAIN_UNITY - gain, attack_decay);
+            gain = (remaining < GAIN_SNAP) ? GAIN_UNITY : GAIN_UNITY - remaining;
+        }
+        else {
+            gain = apply_decay_q31(gain, release_decay);
+            if(gain < GAIN_SNAP) gain = 0;
+        }
+
+        //Q1.31 gain x Q15 sample --> top 32 bits of the 48-bit product are Q15 shifted up by 15
+        block_out[i] = (int16_t)(signed_multiply_32x16b(gain, block_in[i]) >> 15);
+    }
+}
+
+//recompute thresholds and ramp coefficients
+//only runs when a parameter changes, so it's okay to do a little bit of floating point math here
+void Effect_Noise_Gate::update_coeffs() {
+    computed_params = {threshold.get(), hysteresis.get(), attack.get(), hold.get(), release.get()};
+
+    //thresholds from dBFS into Q15 magnitudes
+    open_threshold = (int32_t)(32767.0f * powf(10.0f, threshold.get() / 20.0f));
+    close_threshold = (int32_t)(32767.0f * powf(10.0f, (threshold.get() - hysteresis.get()) / 20.0f));
+
+    //hold time in blocks (detector only runs once per block)
+    hold_blocks = (uint32_t)(hold.get() * App_Constants::AUDIO_SAMPLE_RATE_HZ / (1000.0f * App_Constants::PROCESSING_BLOCK_SIZE));
+
+    //attack and release are time constants of the per-sample ramps
+    attack_decay = compute_decay_q31(attack.get() / 1000.0, App_Constants::AUDIO_SAMPLE_RATE_HZ);
+    release_decay = compute_decay_q31(release.get() / 1000.0, App_Constants::AUDIO_SAMPLE_RATE_HZ);
+}
+
+//################# end CORE OF THE EFFECT ###################
+
+App_String Effect_Noise_Gate::get_name() { return name; }
+const Effect_Icon_t& Effect_Noise_Gate::get_icon() { return icon; }
+RGB_LED::COLOR Effect_Noise_Gate::get_theme_color() { return theme_color; }
+Effect_Parameter* Effect_Noise_Gate::get_quick_edit_param() { return effect_edit.get_quick_edit_param(); }
+Effect_Parameter* Effect_Noise_Gate::get_param(size_t index) { return effect_edit.get_render_parameter(index); }
+
+//=========================== OVERRIDDEN PRIVATE FUNCTIONS =========================
+
+//override our entry function --> call our default implementation
+//configuration of render resources
+void Effect_Noise_Gate::impl_on_entry() {
+    //run the entry function in our edit menu implementation
+    effect_edit.configure_render_resources();
+}
+
+//override our exit function --> call our default implementation
+//release all the render resources
+void Effect_Noise_Gate::impl_on_exit() {
+    //run the exit function in our edit menu implementation
+    effect_edit.release_render_resources();
+}
+
+void Effect_Noise_Gate::draw() {
+    //call the render function of our edit menu implemenation
+    //pass it the global graphics handle
+    effect_edit.render(graphics_handle);
+}
@@ -0,0 +1,86 @@
+#pragma once
+
+/**
+ * Noise gate
+ *  - threshold, hysteresis, attack, hold, and release on their own encoders
+ *
+ * Detection happens once per block rather than per sample:
+ *      \--> find the block peak (two samples at a time), compare it against the open/close thresholds
+ *      \--> gate opens as soon as a block crosses the threshold
+ *      \--> gate closes once blocks have stayed under (threshold - hysteresis) for the hold time
+ *
+ * Gain is only computed per sample while the gate is transitioning
+ *      \--> attack/release are exponential ramps using the same Q1.31 decay as the level visualizer
+ *      \--> once the ramp gets close enough to fully open/closed, gain snaps there and the block is just copied/zeroed
+*/
+
+#include <array>
+#include <string>
+#include <limits>
+
+#include <effect_interface.h> //implements interface specified here
+#include <effect_edit/default_effect_edit_impl.h> //effect menu implementation
+#include <effect_param_num_lin.h>   //              ""
+
+class Effect_Noise_Gate : public Effect_Interface {
+public:
+    //save the theme color and name the effect was registered with
+    Effect_Noise_Gate(RGB_LED::COLOR _theme_color, App_String _name);
+
+    //provide implementations for the following functions:
+    void audio_update(const Audio_Block_t& block_in, Audio_Block_t& block_out) override;
+    App_String get_name() override;
+    const Effect_Icon_t& get_icon() override;
+    RGB_LED::COLOR get_theme_color() override;
+    Effect_Parameter* get_quick_edit_param() override;
+    Effect_Parameter* get_param(size_t index) override;
+
+    //icon for the effect, constant for all instances
+    //public so the effect registry can point at it without an instance
+    static const Effect_Icon_t icon;
+
+private:
+    //define the implementations for the effect edit menu
+    //will use the `default_effect_edit_implementation` to handle editing and rendering our parameter menu
+    void draw() override;
+    void impl_on_entry() override;
+    void impl_on_exit() override;
+
+    //recompute the thresholds and ramp coefficients from the parameters
+    void update_coeffs();
+
+    //have a particular name and theme for our instance
+    const App_String name;
+    const RGB_LED::COLOR theme_color;
+
+    //gain is Q1.31; snap to fully open/closed once we're within this distance of it (about -80dB)
+    static constexpr int32_t GAIN_UNITY = std::numeric_limits<int32_t>::max();
+    static constexpr int32_t GAIN_SNAP = GAIN_UNITY / 10000;
+
+    //parameters of the effect
+    Effect_Parameter_Num_Lin threshold;     //dBFS
+    Effect_Parameter_Num_Lin hysteresis;    //dB
+    Effect_Parameter_Num_Lin attack;        //ms
+    Effect_Parameter_Num_Lin hold;          //ms
+    Effect_Parameter_Num_Lin release;       //ms
+
+    //parameter values the current coefficients were computed with
+    //start with bogus values to force a computation
+    std::array<float, 5> computed_params = {-1000, -1000, -1000, -1000, -1000};
+
+    //thresholds as Q15 magnitudes, hold time in blocks, ramp coefficients in Q1.31
+    int32_t open_threshold = 0;
+    int32_t close_threshold = 0;
+    uint32_t hold_blocks = 0;
+    int32_t attack_decay = 0;
+    int32_t release_decay = 0;
+
+    //gate state
+    bool gate_open = false;
+    uint32_t hold_remaining = 0;
+    int32_t gain = 0;
+
+    //have an instance of our `default_effect_edit_impl`
+    //to actually handle our edit menu
+    Default_Effect_Edit_Impl effect_edit;
+};
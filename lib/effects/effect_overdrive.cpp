@@ -1,7 +1,7 @@
 
 #include <effect_overdrive.h>
 
-#include <limits> //for int32_t limits
+#include <math.h> //for dB conversion
 
 //=========================== STATIC MEMBER VARIABLES =======================
 
@@ -26,45 +26,39 @@ const Effect_Icon_t Effect_Overdrive::icon = {
 //=========================== OVERRIDDEN PUBLIC FUNCTIONS =========================
 
 //save the name and effect theme color during initialization
-Effect_Overdrive::Effect_Overdrive():
-    name("Overdrive"),
-    theme_color(RGB_LED::RED),
-    gain("Gain", 0.01, 1, 100, 1),
+Effect_Overdrive::Effect_Overdrive(RGB_LED::COLOR _theme_color, App_String _name):
+    name(_name),
+    theme_color(_theme_color),
+    drive(App_Strings::LABEL_DRIVE, 0, 40, 0.5, 0, 1, App_Strings::UNITS_DB.c_str()), //0dB default matches the previous fixed-gain behavior
+    curve(App_Strings::LABEL_CURVE, Waveshaper::get_curve_names(), App_Strings::CURVE_DIODE),
     effect_edit(to_return_page, leds, encs) //initialize our edit page implementation
 {
     //set the header text and theme color for the effects edit menu
-    effect_edit.set_display_text("Edit Gain");
+    effect_edit.set_display_text(App_Strings::EDIT_OVERDRIVE);
     effect_edit.set_LED_color(theme_color);
 
     //set the parameters to edit/render in the edit menu
-    effect_edit.set_render_parmeter(&gain, 2);
+    effect_edit.set_render_parmeter(&drive, 1);
+    effect_edit.set_render_parmeter(&curve, 2);
 }
 
-//copy constructor that invokes the default constructor above
-Effect_Overdrive::Effect_Overdrive(const Effect_Overdrive& other):
-    Effect_Overdrive()
-{}
-
 //################# CORE OF THE EFFECT ###################
 
 void Effect_Overdrive::audio_update(const Audio_Block_t& block_in, Audio_Block_t& block_out) {
-    //synchronize our parameter for reading/rendering
-    gain.synchronize();
+    //synchronize our parameters for reading/rendering
+    drive.synchronize();
+    curve.synchronize();
+
+    //if the drive has been adjusted --> convert from dB to a linear gain for the waveshaper
+    if(drive.get() != prev_drive) {
+        shaper.set_drive(powf(10.0f, drive.get() / 20.0f));
+        prev_drive = drive.get();
+    }
 
-    //if volume frequency has been adjusted --> recompute the fixed-point value
-    if(gain.get() != prev_gain) {
-        /**
-         * Convert the floating point volume to a Q1.31 fixed point representation
-         * A gain of `1` should correspond to the maximum value of an int32_t
-         *      \--> can use std::numeric_limits<int32_t>::max()
-         * A gain of `0` should correspond to 0
-         * Should be a relatively simple one-line conversion
-         */        
-        gain_fp = (int32_t)(std::numeric_limits<int32_t>::max()) * gain.get();
-        
-        //update the previous volume value such that we only run this `if` statement
-        //if the volume knob was adjusted
-        prev_gain = gain.get();
+    //if the curve has been changed --> just swap the waveshaper's table
+    if(curve.get() != prev_curve) {
+        shaper.set_curve((Waveshaper::Curve)curve.get());
+        prev_curve = curve.get();
     }
 
     //actually run our effect, having computed our constants
@@ -113,7 +107,7 @@ void Effect_Overdrive::audio_update(const Audio_Block_t& block_in, Audio_Block_t
             //final rescaling of our sample value due to gain of our interpolating filter
             int32_t high_rate_sample_filt = interp_int_sample >> ((CIC_FILTER_ORDER-1)*RATE_INCREASE_LOG2);
             //############# RUN THE DISTORTION EFFECT #################
-            int32_t distorted_sample = diode_clip_od(high_rate_sample_filt, gain_fp);
+            int32_t distorted_sample = shaper.process(high_rate_sample_filt);
             //################ end DISTORTION EFFECT ##################
 
             /**
@@ -161,38 +155,14 @@ void Effect_Overdrive::audio_update(const Audio_Block_t& block_in, Audio_Block_t
 
 //################# end CORE OF THE EFFECT ###################
 
-//function we call to actually instantiate a new effect on the heap
-//return a unique pointer to automatically manage this heap memory
-std::unique_ptr<Effect_Interface> Effect_Overdrive::clone() {
-    return std::make_unique<Effect_Overdrive>(*new Effect_Overdrive(*this));
-}
-
-std::string Effect_Overdrive::get_name() { return name; }
-Effect_Icon_t Effect_Overdrive::get_icon() { return icon; }
+App_String Effect_Overdrive::get_name() { return name; }
+const Effect_Icon_t& Effect_Overdrive::get_icon() { return icon; }
 RGB_LED::COLOR Effect_Overdrive::get_theme_color() { return theme_color; }
 Effect_Parameter* Effect_Overdrive::get_quick_edit_param() { return effect_edit.get_quick_edit_param(); }
+Effect_Parameter* Effect_Overdrive::get_param(size_t index) { return effect_edit.get_render_parameter(index); }
 
 //=========================== PRIVATE + OVERRIDDEN FUNCTIONS =========================
 
-//diode overdrive approximation from 
-//not using gain just yet
-//https://baltic-lab.com/2023/08/dsp-diode-clipping-algorithm-for-overdrive-and-distortion-effects/
-int32_t Effect_Overdrive::diode_clip_od(int32_t sample, int32_t gain_q131) {
-    
-    //easy way to make this symmetric 
-    int32_t sample_sign = sample >= 0 ? 1 : -1;
-    sample = abs(sample);
-    
-    if(sample < 10922)
-        return sample_sign * sample * 2;
-    else if(sample < 21845) {
-        //-3x^2 + 4x - 1/3
-        return sample_sign * ((-10921) + 4*sample - 3 * sample * sample / 32768);
-    }
-    else
-        return sample_sign * 32767;
-}
-
 //override our entry function --> call our default implementation
 //configuration of render resources
 void Effect_Overdrive::impl_on_entry() {
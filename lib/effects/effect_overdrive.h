@@ -16,27 +16,26 @@
 #include <effect_interface.h> //implements interface specified here
 #include <effect_edit/default_effect_edit_impl.h> //effect menu implementation
 #include <effect_param_num_lin.h>   //linear control of distortion stage gain
+#include <effect_param_sel.h>   //selection of the distortion transfer curve
+#include <effect_dsp/waveshaper.h> //for the actual non-linear distortion
 #include <dspinst.h> //for DSP and SIMD instruction for speed and such
 
 class Effect_Overdrive : public Effect_Interface {
 public:
-    //default constructor -- just call the base class constructor
-    Effect_Overdrive();
-
-    //need to have a non-default copy constructor--> need to freshly instantiate the `effect_edit` param
-    //we'll invoke the default constructor using the theme color and name from the `other`
-    Effect_Overdrive(const Effect_Overdrive& other);
-    
-    //implement the clone function to produce instances of this effect that are copies of the original
-    //need to override base class so we produce copies of the derived class instead
-    std::unique_ptr<Effect_Interface> clone() override;
+    //save the theme color and name the effect was registered with
+    Effect_Overdrive(RGB_LED::COLOR _theme_color, App_String _name);
 
     //provide implementations for the following functions:
     void audio_update(const Audio_Block_t& block_in, Audio_Block_t& block_out) override;
-    std::string get_name() override;
-    Effect_Icon_t get_icon() override;
+    App_String get_name() override;
+    const Effect_Icon_t& get_icon() override;
     RGB_LED::COLOR get_theme_color() override;
     Effect_Parameter* get_quick_edit_param() override; 
+    Effect_Parameter* get_param(size_t index) override;
+
+    //icon for the effect, constant for all instances
+    //public so the effect registry can point at it without an instance
+    static const Effect_Icon_t icon;
 
 private:
     //define the implementations for the effect edit menu
@@ -45,20 +44,19 @@ private:
     void impl_on_entry() override;
     void impl_on_exit() override;
 
-    //funciton we'll be using to actually do the non-linear overdrive effect
-    int32_t diode_clip_od(int32_t sample, int32_t gain_q131);
-    
-    //have an icon for the effect, will be constant for all instances
-    static const Effect_Icon_t icon;
-
     //have a particular name and theme for our instance
-    const std::string name; 
+    const App_String name; 
     const RGB_LED::COLOR theme_color;    
 
-    //have a parameter that sets the desired volume
-    Effect_Parameter_Num_Lin gain;
-    float prev_gain = 0;
-    int32_t gain_fp = 0; //Q1.31 representation of our gain value
+    //have a parameter that sets how hard we drive the distortion stage (in dB)
+    //and one that selects the transfer curve of the distortion stage
+    Effect_Parameter_Num_Lin drive;
+    Effect_Parameter_Sel curve;
+    float prev_drive = -1; //bogus value to force a computation
+    uint32_t prev_curve = -1; //bogus max value
+
+    //the waveshaper that does the actual non-linear distortion at the high sample rate
+    Waveshaper shaper;
 
     //stuff relevant to the CIC filter
     static constexpr size_t RATE_INCREASE_LOG2 = 3; //increase sample rate by 8x if this number is 3
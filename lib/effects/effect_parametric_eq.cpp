@@ -0,0 +1,129 @@
+#include <effect_parametric_eq.h>
+
+//=========================== STATIC MEMBER VARIABLES =======================
+
+const Effect_Icon_t Effect_Parametric_EQ::icon = {
+    0xFC, 0xFF, 0xFF, 0x01, 0x06, 0x00, 0x00, 0x03, 0x03, 0x00, 0x00, 0x06, 
+    0x01, 0x00, 0x00, 0x04, 0x01, 0x00, 0x00, 0x04, 0x11, 0x00, 0x00, 0x04, 
+    0x11, 0x00, 0x00, 0x04, 0x11, 0x80, 0x03, 0x04, 0x11, 0x40, 0x04, 0x04, 
+    0x11, 0x40, 0x04, 0x04, 0xD1, 0x20, 0x88, 0x05, 0x11, 0x21, 0x48, 0x04, 
+    0x11, 0x12, 0x50, 0x04, 0x11, 0x0C, 0x20, 0x04, 0x11, 0x00, 0x00, 0x04, 
+    0x11, 0x00, 0x00, 0x04, 0x11, 0x00, 0x00, 0x04, 0x11, 0x00, 0x00, 0x04, 
+    0x11, 0x00, 0x00, 0x04, 0xF9, 0xFF, 0xFF, 0x04, 0x11, 0x00, 0x00, 0x04, 
+    0x11, 0x00, 0x00, 0x04, 0x01, 0x00, 0x00, 0x04, 0x01, 0x00, 0x00, 0x04, 
+    0xE1, 0x1F, 0x7F, 0x04, 0xE1, 0x9F, 0xFF, 0x04, 0xE1, 0x80, 0xE3, 0x04, 
+    0xE1, 0x80, 0xE3, 0x04, 0xE1, 0x8F, 0xE3, 0x04, 0xE1, 0x8F, 0xE3, 0x04, 
+    0xE1, 0x80, 0xE3, 0x04, 0xE1, 0x80, 0xEB, 0x04, 0xE1, 0x9F, 0xF3, 0x04, 
+    0xE1, 0x1F, 0xFF, 0x04, 0x01, 0x00, 0xC0, 0x05, 0x01, 0x00, 0x00, 0x04, 
+    0x01, 0x00, 0x00, 0x04, 0x01, 0x00, 0x00, 0x04, 0x03, 0x00, 0x00, 0x02, 
+    0x06, 0x00, 0x00, 0x03, 0xFC, 0xFF, 0xFF, 0x00
+
+};
+
+//=========================== OVERRIDDEN PUBLIC FUNCTIONS =========================
+
+//save the name and effect theme color during initialization
+Effect_Parametric_EQ::Effect_Parametric_EQ(RGB_LED::COLOR _theme_color, App_String _name):
+    name(_name),
+    theme_color(_theme_color),
+    low_gain(App_Strings::LABEL_LOW, -12, 12, 0.5, 0, 1, App_Strings::UNITS_DB.c_str()),
+    peak_1_gain(App_Strings::LABEL_LO_MID, -12, 12, 0.5, 0, 1, App_Strings::UNITS_DB.c_str()),
+    peak_2_gain(App_Strings::LABEL_HI_MID, -12, 12, 0.5, 0, 1, App_Strings::UNITS_DB.c_str()),
+    high_gain(App_Strings::LABEL_HIGH, -12, 12, 0.5, 0, 1, App_Strings::UNITS_DB.c_str()),
+    eq_filter(NUM_BANDS),
+    effect_edit(to_return_page, leds, encs) //initialize our edit page implementation
+{
+    //set the header text and theme color for the effects edit menu
+    effect_edit.set_display_text(App_Strings::EDIT_PARAMETRIC_EQ);
+    effect_edit.set_LED_color(theme_color);
+
+    //set the parameters to edit/render in the edit menu
+    //one band per channel encoder
+    effect_edit.set_render_parmeter(&low_gain, 0);
+    effect_edit.set_render_parmeter(&peak_1_gain, 1);
+    effect_edit.set_render_parmeter(&peak_2_gain, 2);
+    effect_edit.set_render_parmeter(&high_gain, 3);
+
+    //start off with coefficients matching our default gains
+    synced_gains = {low_gain.get(), peak_1_gain.get(), peak_2_gain.get(), high_gain.get()};
+    update_coeffs();
+}
+
+//start recomputing coefficients when we're added to the signal chain
+void Effect_Parametric_EQ::connect() {
+    coeff_update_sched.schedule_interval_ms(Context_Callback_Function<void>(reinterpret_cast<void*>(this), update_coeffs_cb), COEFF_UPDATE_MS);
+}
+
+//and stop when we're taken out of it
+void Effect_Parametric_EQ::disconnect() {
+    coeff_update_sched.deschedule();
+}
+
+//################# CORE OF THE EFFECT ###################
+
+//coefficients are computed outside of the audio update; just run the filter
+void Effect_Parametric_EQ::audio_update(const Audio_Block_t& block_in, Audio_Block_t& block_out) {
+    //synchronize our parameters for reading/rendering
+    //and leave their values for the main loop to design coefficients from
+    low_gain.synchronize();
+    peak_1_gain.synchronize();
+    peak_2_gain.synchronize();
+    high_gain.synchronize();
+    synced_gains[0] = low_gain.get();
+    synced_gains[1] = peak_1_gain.get();
+    synced_gains[2] = peak_2_gain.get();
+    synced_gains[3] = high_gain.get();
+
+    eq_filter.process(block_in, block_out);
+}
+
+//runs in the main loop context
+void Effect_Parametric_EQ::update_coeffs() {
+    //take a copy of the gains the audio update left us
+    //an audio update can land partway through this; we'll just pick up the rest of its gains on the next run
+    std::array<float, NUM_BANDS> gains;
+    for(size_t i = 0; i < NUM_BANDS; i++) gains[i] = synced_gains[i];
+
+    //only bother with the trig if something changed
+    if(gains == computed_gains) return;
+
+    //compute the new coefficients into the set the audio update isn't using, then swap them in
+    auto& coeffs = eq_filter.get_staging_coeffs();
+    coeffs[0] = Biquad_Cascade::design_low_shelf(LOW_SHELF_FREQ, gains[0]);
+    coeffs[1] = Biquad_Cascade::design_peak(PEAK_1_FREQ, PEAK_Q, gains[1]);
+    coeffs[2] = Biquad_Cascade::design_peak(PEAK_2_FREQ, PEAK_Q, gains[2]);
+    coeffs[3] = Biquad_Cascade::design_high_shelf(HIGH_SHELF_FREQ, gains[3]);
+    eq_filter.publish_coeffs();
+
+    computed_gains = gains;
+}
+
+//################# end CORE OF THE EFFECT ###################
+
+App_String Effect_Parametric_EQ::get_name() { return name; }
+const Effect_Icon_t& Effect_Parametric_EQ::get_icon() { return icon; }
+RGB_LED::COLOR Effect_Parametric_EQ::get_theme_color() { return theme_color; }
+Effect_Parameter* Effect_Parametric_EQ::get_quick_edit_param() { return effect_edit.get_quick_edit_param(); }
+Effect_Parameter* Effect_Parametric_EQ::get_param(size_t index) { return effect_edit.get_render_parameter(index); }
+
+//=========================== OVERRIDDEN PRIVATE FUNCTIONS =========================
+
+//override our entry function --> call our default implementation
+//configuration of render resources
+void Effect_Parametric_EQ::impl_on_entry() {
+    //run the entry function in our edit menu implementation
+    effect_edit.configure_render_resources();
+}
+
+//override our exit function --> call our default implementation
+//release all the render resources
+void Effect_Parametric_EQ::impl_on_exit() {
+    //run the exit function in our edit menu implementation 
+    effect_edit.release_render_resources();
+}
+
+void Effect_Parametric_EQ::draw() {
+    //call the render function of our edit menu implemenation
+    //pass it the global graphics handle
+    effect_edit.render(graphics_handle);
+}
@@ -0,0 +1,92 @@
+#pragma once
+
+/**
+ * Four-band parametric EQ
+ *  - low shelf, two peaking bands, and a high shelf
+ *  - gain of each band is mapped to its own encoder
+ * 
+ * Filtering is done with a biquad cascade (one section per band)
+ * Filter coefficients are recomputed in the main loop (via the scheduler) while the effect is connected
+ *      \--> the audio update synchronizes the band gains like every other effect, and leaves a copy of them for the main loop
+ *      \--> the main loop designs coefficients from that copy; the audio update never does any trig,
+ *           it just picks up whichever coefficient set was last published
+*/
+
+#include <array>
+#include <string>
+
+#include <effect_interface.h> //implements interface specified here
+#include <effect_edit/default_effect_edit_impl.h> //effect menu implementation
+#include <effect_param_num_lin.h>   //              ""
+#include <effect_dsp/biquad_cascade.h> //for the actual filtering
+#include <scheduler.h> //to recompute coefficients outside of the audio update
+
+class Effect_Parametric_EQ : public Effect_Interface {
+public:
+    //save the theme color and name the effect was registered with
+    Effect_Parametric_EQ(RGB_LED::COLOR _theme_color, App_String _name);
+
+    //start and stop recomputing filter coefficients when we get added/removed from the effect chain
+    void connect() override;
+    void disconnect() override;
+
+    //provide implementations for the following functions:
+    void audio_update(const Audio_Block_t& block_in, Audio_Block_t& block_out) override;
+    App_String get_name() override;
+    const Effect_Icon_t& get_icon() override;
+    RGB_LED::COLOR get_theme_color() override;
+    Effect_Parameter* get_quick_edit_param() override; 
+    Effect_Parameter* get_param(size_t index) override;
+
+    //icon for the effect, constant for all instances
+    //public so the effect registry can point at it without an instance
+    static const Effect_Icon_t icon;
+
+private:
+    //define the implementations for the effect edit menu
+    //will use the `default_effect_edit_implementation` to handle editing and rendering our parameter menu
+    void draw() override;
+    void impl_on_entry() override;
+    void impl_on_exit() override;
+
+    //recompute filter coefficients if any of the band gains the audio update left us have changed
+    //runs in the main loop context (and once from the constructor, before we're running)
+    void update_coeffs();
+    static inline void update_coeffs_cb(void* context) { reinterpret_cast<Effect_Parametric_EQ*>(context)->update_coeffs(); }
+    
+    //have a particular name and theme for our instance
+    const App_String name; 
+    const RGB_LED::COLOR theme_color;    
+
+    //fixed frequencies of each band, along with the Q of the peaking bands
+    static constexpr float LOW_SHELF_FREQ = 120;
+    static constexpr float PEAK_1_FREQ = 500;
+    static constexpr float PEAK_2_FREQ = 2000;
+    static constexpr float HIGH_SHELF_FREQ = 5000;
+    static constexpr float PEAK_Q = 0.9;
+    static constexpr size_t NUM_BANDS = 4;
+
+    //gain of each band in dB
+    Effect_Parameter_Num_Lin low_gain;
+    Effect_Parameter_Num_Lin peak_1_gain;
+    Effect_Parameter_Num_Lin peak_2_gain;
+    Effect_Parameter_Num_Lin high_gain;
+
+    //band gains as of the last audio update, for the main loop to design coefficients from
+    std::array<volatile float, NUM_BANDS> synced_gains;
+
+    //gains that the currently published coefficients were computed with
+    //start with a bogus value to force a computation
+    std::array<float, NUM_BANDS> computed_gains = {-1000, -1000, -1000, -1000};
+
+    //filter engine, one section per band
+    Biquad_Cascade eq_filter;
+
+    //periodically recompute coefficients while connected
+    static constexpr uint32_t COEFF_UPDATE_MS = 20;
+    Scheduler coeff_update_sched;
+
+    //have an instance of our `default_effect_edit_impl`
+    //to actually handle our edit menu 
+    Default_Effect_Edit_Impl effect_edit;
+};
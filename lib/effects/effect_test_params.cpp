@@ -23,16 +23,16 @@ const Effect_Icon_t Effect_Test_Param::icon = {
 //=========================== OVERRIDDEN PUBLIC FUNCTIONS =========================
 
 //save the name and effect theme color during initialization
-Effect_Test_Param::Effect_Test_Param(RGB_LED::COLOR _theme_color, std::string _name):
+Effect_Test_Param::Effect_Test_Param(RGB_LED::COLOR _theme_color, App_String _name):
     name(_name),
     theme_color(_theme_color),
-    lin_param("Lin", -10, 10, 0.5, 1),
-    log_param("Log", 10, 1000, 100, 100),
-    sel_param("Sel", choices, choices[1]),
+    lin_param(App_Strings::LABEL_LIN, -10, 10, 0.5, 1),
+    log_param(App_Strings::LABEL_LOG, 10, 1000, 100, 100),
+    sel_param(App_Strings::LABEL_SEL, choices, choices[1]),
     effect_edit(to_return_page, leds, encs) //initialize our edit page implementation
 {
     //set the header text and theme color for the effects edit menu
-    effect_edit.set_display_text("Edit Dummy Params");
+    effect_edit.set_display_text(App_Strings::EDIT_TEST_PARAMS);
     effect_edit.set_LED_color(theme_color);
 
     //set the parameters to edit/render in the edit menu
@@ -41,11 +41,6 @@ Effect_Test_Param::Effect_Test_Param(RGB_LED::COLOR _theme_color, std::string _n
     effect_edit.set_render_parmeter(&sel_param, 3);
 }
 
-//copy constructor invokes the parameterized constructor above
-Effect_Test_Param::Effect_Test_Param(const Effect_Test_Param& other):
-    Effect_Test_Param(other.theme_color, other.name)
-{}
-
 void Effect_Test_Param::audio_update(const Audio_Block_t& block_in, Audio_Block_t& block_out) {
     //just copy the input block to the output
     std::copy(block_in.begin(), block_in.end(), block_out.begin());
@@ -56,16 +51,11 @@ void Effect_Test_Param::audio_update(const Audio_Block_t& block_in, Audio_Block_
     sel_param.synchronize();
 }
 
-//function we call to actually instantiate a new effect on the heap
-//return a unique pointer to automatically manage this heap memory
-std::unique_ptr<Effect_Interface> Effect_Test_Param::clone() {
-    return std::make_unique<Effect_Test_Param>(*new Effect_Test_Param(*this));
-}
-
-std::string Effect_Test_Param::get_name() { return name; }
-Effect_Icon_t Effect_Test_Param::get_icon() { return icon; }
+App_String Effect_Test_Param::get_name() { return name; }
+const Effect_Icon_t& Effect_Test_Param::get_icon() { return icon; }
 RGB_LED::COLOR Effect_Test_Param::get_theme_color() { return theme_color; }
 Effect_Parameter* Effect_Test_Param::get_quick_edit_param() { return effect_edit.get_quick_edit_param(); }
+Effect_Parameter* Effect_Test_Param::get_param(size_t index) { return effect_edit.get_render_parameter(index); }
 
 //=========================== OVERRIDDEN PRIVATE FUNCTIONS =========================
 
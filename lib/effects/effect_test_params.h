@@ -21,22 +21,19 @@
 class Effect_Test_Param : public Effect_Interface {
 public:
     //default constructor -- just call the base class constructor
-    Effect_Test_Param(RGB_LED::COLOR _theme_color, std::string _name);
-
-    //need to have a non-default copy constructor--> need to freshly instantiate the `effect_edit` param
-    //we'll invoke the default constructor using the theme color and name from the `other`
-    Effect_Test_Param(const Effect_Test_Param& other);
-    
-    //implement the clone function to produce instances of this effect that are copies of the original
-    //need to override base class so we produce copies of the derived class instead
-    std::unique_ptr<Effect_Interface> clone() override;
+    Effect_Test_Param(RGB_LED::COLOR _theme_color, App_String _name);
 
     //provide implementations for the following functions:
     void audio_update(const Audio_Block_t& block_in, Audio_Block_t& block_out) override;
-    std::string get_name() override;
-    Effect_Icon_t get_icon() override;
+    App_String get_name() override;
+    const Effect_Icon_t& get_icon() override;
     RGB_LED::COLOR get_theme_color() override;
     Effect_Parameter* get_quick_edit_param() override; 
+    Effect_Parameter* get_param(size_t index) override;
+
+    //icon for the effect, constant for all instances
+    //public so the effect registry can point at it without an instance
+    static const Effect_Icon_t icon;
 
 private:
     //define the implementations for the effect edit menu
@@ -45,23 +42,20 @@ private:
     void impl_on_entry() override;
     void impl_on_exit() override;
     
-    //have an icon for the effect, will be constant for all instances
-    static const Effect_Icon_t icon;
-
     //have a particular name for our instance
-    const std::string name; 
+    const App_String name; 
 
     //also have a theme color that can be configured instance-by-instance
     const RGB_LED::COLOR theme_color;    
 
     //some random choices for the `sel_param`
     //declare this before `sel_param` to initialize this before the particular member!
-    std::array<std::string, 5> choices = {
-        "Type 1",
-        "Type 2",
-        "Type 3", 
-        "Type 4",
-        "Type 5"
+    std::array<App_String, 5> choices = {
+        App_Strings::TEST_TYPE_1,
+        App_Strings::TEST_TYPE_2,
+        App_Strings::TEST_TYPE_3, 
+        App_Strings::TEST_TYPE_4,
+        App_Strings::TEST_TYPE_5
     };
 
     //hold some parameters for testing
@@ -23,7 +23,7 @@ const Effect_Icon_t Effect_Test_Passthrough::icon = {
 //=========================== OVERRIDDEN PUBLIC FUNCTIONS =========================
 
 //save the name and effect theme color during initialization
-Effect_Test_Passthrough::Effect_Test_Passthrough(RGB_LED::COLOR _theme_color, std::string _name):
+Effect_Test_Passthrough::Effect_Test_Passthrough(RGB_LED::COLOR _theme_color, App_String _name):
     name(_name),
     theme_color(_theme_color)
 {}
@@ -33,14 +33,8 @@ void Effect_Test_Passthrough::audio_update(const Audio_Block_t& block_in, Audio_
     std::copy(block_in.begin(), block_in.end(), block_out.begin());
 }
 
-//function we call to actually instantiate a new effect on the heap
-//return a unique pointer 
-std::unique_ptr<Effect_Interface> Effect_Test_Passthrough::clone() {
-    return std::make_unique<Effect_Test_Passthrough>(*new Effect_Test_Passthrough(*this));
-}
-
-std::string Effect_Test_Passthrough::get_name() { return name; }
-Effect_Icon_t Effect_Test_Passthrough::get_icon() { return icon; }
+App_String Effect_Test_Passthrough::get_name() { return name; }
+const Effect_Icon_t& Effect_Test_Passthrough::get_icon() { return icon; }
 RGB_LED::COLOR Effect_Test_Passthrough::get_theme_color() { return theme_color; }
 
 //=========================== OVERRIDDEN PRIVATE FUNCTIONS =========================
@@ -54,9 +48,9 @@ void Effect_Test_Passthrough::impl_on_entry() {
 
 void Effect_Test_Passthrough::draw() {
     //display a message on the screen
-    static const std::array<std::string, 2> no_param_msg = {
-        "This Effect Has No",
-        "Editable Parameters"
+    static const std::array<App_String, 2> no_param_msg = {
+        App_Strings::NO_PARAMS_LINE_1,
+        App_Strings::NO_PARAMS_LINE_2
     };
 
     //compute the coordinates of the text such that it's center aligned
@@ -73,6 +67,6 @@ void Effect_Test_Passthrough::draw() {
     graphics_handle.clearBuffer();
     for(size_t i = 0; i < no_param_msg.size(); i++) 
         graphics_handle.drawStr(x_coords[i], y_coords[i], no_param_msg[i].c_str());
-    graphics_handle.sendBuffer();
+    UI_Page::send_buffer();
 }
 
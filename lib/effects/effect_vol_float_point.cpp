@@ -25,25 +25,20 @@ const Effect_Icon_t Effect_Vol_Float_Point::icon = {
 //=========================== OVERRIDDEN PUBLIC FUNCTIONS =========================
 
 //save the name and effect theme color during initialization
-Effect_Vol_Float_Point::Effect_Vol_Float_Point():
-    name("Float Pt. Vol"),
-    theme_color(RGB_LED::CYAN),
-    volume("Volume", 0.01, 1, 100, 1),
+Effect_Vol_Float_Point::Effect_Vol_Float_Point(RGB_LED::COLOR _theme_color, App_String _name):
+    name(_name),
+    theme_color(_theme_color),
+    volume(App_Strings::LABEL_VOLUME, 0.01, 1, 100, 1),
     effect_edit(to_return_page, leds, encs) //initialize our edit page implementation
 {
     //set the header text and theme color for the effects edit menu
-    effect_edit.set_display_text("Edit Volume");
+    effect_edit.set_display_text(App_Strings::EDIT_VOLUME);
     effect_edit.set_LED_color(theme_color);
 
     //set the parameters to edit/render in the edit menu
     effect_edit.set_render_parmeter(&volume, 2);
 }
 
-//copy constructor that invokes the default constructor above
-Effect_Vol_Float_Point::Effect_Vol_Float_Point(const Effect_Vol_Float_Point& other):
-    Effect_Vol_Float_Point()
-{}
-
 //################# CORE OF THE EFFECT ###################
 
 void Effect_Vol_Float_Point::audio_update(const Audio_Block_t& block_in, Audio_Block_t& block_out) {
@@ -76,16 +71,11 @@ void Effect_Vol_Float_Point::audio_update(const Audio_Block_t& block_in, Audio_B
 
 //################# end CORE OF THE EFFECT ###################
 
-//function we call to actually instantiate a new effect on the heap
-//return a unique pointer to automatically manage this heap memory
-std::unique_ptr<Effect_Interface> Effect_Vol_Float_Point::clone() {
-    return std::make_unique<Effect_Vol_Float_Point>(*new Effect_Vol_Float_Point(*this));
-}
-
-std::string Effect_Vol_Float_Point::get_name() { return name; }
-Effect_Icon_t Effect_Vol_Float_Point::get_icon() { return icon; }
+App_String Effect_Vol_Float_Point::get_name() { return name; }
+const Effect_Icon_t& Effect_Vol_Float_Point::get_icon() { return icon; }
 RGB_LED::COLOR Effect_Vol_Float_Point::get_theme_color() { return theme_color; }
 Effect_Parameter* Effect_Vol_Float_Point::get_quick_edit_param() { return effect_edit.get_quick_edit_param(); }
+Effect_Parameter* Effect_Vol_Float_Point::get_param(size_t index) { return effect_edit.get_render_parameter(index); }
 
 //=========================== OVERRIDDEN PRIVATE FUNCTIONS =========================
 
@@ -96,9 +96,10 @@ void Rotary_Encoder::attach_on_press(Context_Callback_Function<void> _on_press)
 void Rotary_Encoder::attach_on_release(Context_Callback_Function<void> _on_release) { on_release = _on_release; }
 
 //update --> call necessary callback functions from this context
-void Rotary_Encoder::update() {
+bool Rotary_Encoder::update() {
     //execute callbacks and clear flags as necessary
     //clear flags first if callback functions take a while for whatever reason
+    bool activity = flag_press || flag_release || flag_change;
     if(flag_press) {
         flag_press = false;
         on_press();
@@ -113,12 +114,16 @@ void Rotary_Encoder::update() {
         flag_change = false;
         on_change();
     }
+
+    return activity;
 }
 
 //convenience function that automatically calls `update_all()` on all instances
-void Rotary_Encoder::update_all() {
+bool Rotary_Encoder::update_all() {
+    bool activity = false;
     for(Rotary_Encoder* enc : ALL_ENCODERS)
-        if(enc != nullptr) enc->update();
+        if(enc != nullptr) activity |= enc->update();
+    return activity;
 }
 
 //=============================== PRIVATE MEMBER FUNCTIONS ==============================
@@ -137,9 +137,10 @@ public:
      * Update function --> executes callback functions as necessary when this function is called 
      * `update()` just calls the update on a single encoder instance
      * `update_all()` calls updates on all encoder instances (and is a static method)
+     * Both return whether anything happened (turn, press or release), whether or not a callback was attached
      */
-    void update();
-    static void update_all();
+    bool update();
+    static bool update_all();
 
 private:
     //save the pins of the encoder
@@ -0,0 +1,35 @@
+#include <cab_blob.h>
+
+#include <string.h> //memcmp, memcpy
+
+static constexpr char MAGIC[4] = {'F', 'X', 'C', 'B'};
+
+//helpers to move little-endian values in and out of byte buffers
+static inline uint16_t read_le16(const uint8_t* p) { return (uint16_t)p[0] | ((uint16_t)p[1] << 8); }
+static inline uint32_t read_le32(const uint8_t* p) { return (uint32_t)p[0] | ((uint32_t)p[1] << 8) | ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24); }
+static inline void write_le16(uint8_t* p, uint16_t v) { p[0] = v & 0xFF; p[1] = v >> 8; }
+static inline void write_le32(uint8_t* p, uint32_t v) { p[0] = v & 0xFF; p[1] = (v >> 8) & 0xFF; p[2] = (v >> 16) & 0xFF; p[3] = v >> 24; }
+
+bool Cab_Blob::parse_header(const uint8_t* buf, Info& info) {
+    if(memcmp(buf, MAGIC, sizeof(MAGIC)) != 0) return false;
+    if(read_le16(buf + 4) != VERSION) return false;
+
+    info.headroom_shift = read_le16(buf + 6);
+    info.sample_rate = read_le32(buf + 8);
+    info.num_taps = read_le32(buf + 12);
+    return true;
+}
+
+void Cab_Blob::write_header(uint8_t* buf, const Info& info) {
+    memcpy(buf, MAGIC, sizeof(MAGIC));
+    write_le16(buf + 4, VERSION);
+    write_le16(buf + 6, info.headroom_shift);
+    write_le32(buf + 8, info.sample_rate);
+    write_le32(buf + 12, info.num_taps);
+}
+
+bool Cab_Blob::is_compatible(const Info& info, uint32_t sample_rate, uint32_t max_taps, uint32_t headroom_shift) {
+    if(info.sample_rate != sample_rate) return false;
+    if(info.headroom_shift != headroom_shift) return false;
+    return info.num_taps != 0 && info.num_taps <= max_taps;
+}
@@ -0,0 +1,56 @@
+#pragma once
+
+/*
+ * Binary format for preprocessed cabinet kernels
+ * Produced offline by `tools/ir_compiler`; lets the firmware load a cab without doing any resampling/normalization at boot
+ *
+ * Layout (all little-endian):
+ *      \--> 4 bytes    magic "FXCB"
+ *      \--> 2 bytes    format version
+ *      \--> 2 bytes    headroom shift the kernel was normalized with
+ *      \--> 4 bytes    sample rate the kernel was resampled to
+ *      \--> 4 bytes    number of taps
+ *      \--> num_taps x 2 bytes     Q15 taps, h[0] first
+ *
+ * Like the WAV reader, nothing in here is Arduino-specific so the host tool can share it
+ * Intention is to use this class statically, i.e. don't instantiate it
+ */
+
+#include <stdint.h>
+#include <stddef.h>
+
+class Cab_Blob {
+public:
+    //prevent all flavors of making an instance of one of these
+    Cab_Blob() = delete;
+    Cab_Blob(const Cab_Blob& other) = delete;
+    void operator=(const Cab_Blob& other) = delete;
+
+    //how big the header at the start of the file is
+    static constexpr size_t HEADER_BYTES = 16;
+
+    //file extension we use for these blobs
+    static constexpr const char* FILE_EXTENSION = ".cab";
+
+    //information stored in the header
+    struct Info {
+        uint16_t headroom_shift;
+        uint32_t sample_rate;
+        uint32_t num_taps;
+    };
+
+    //parse the `HEADER_BYTES` at `buf` into `info`
+    //returns false if the magic or version don't match
+    static bool parse_header(const uint8_t* buf, Info& info);
+
+    //write a header describing `info` into the `HEADER_BYTES` at `buf`
+    static void write_header(uint8_t* buf, const Info& info);
+
+    //whether a blob described by `info` can be run as-is by a loader expecting these settings
+    //  \--> sample rate and headroom shift have to match exactly (otherwise it'd play at the wrong pitch/gain)
+    //  \--> needs at least one tap, and no more than `max_taps`
+    static bool is_compatible(const Info& info, uint32_t sample_rate, uint32_t max_taps, uint32_t headroom_shift);
+
+private:
+    static constexpr uint16_t VERSION = 1;
+};
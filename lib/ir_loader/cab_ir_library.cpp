@@ -0,0 +1,144 @@
+#include <cab_ir_library.h>
+
+#include <memory> //for unique_ptr scratch buffers
+#include <string.h> //memcpy
+#include <SD.h> //for reading impulse responses off the SD card
+
+#include <wav_reader.h>
+#include <ir_process.h>
+#include <cab_blob.h>
+#include <app_strings.h> //for the placeholder name
+
+//======================== STATIC VARIABLE DEFINITION =====================
+
+std::array<std::array<char, Cab_IR_Library::MAX_NAME_CHARS + 1>, App_Constants::MAX_SD_CABS> Cab_IR_Library::name_text = {};
+std::array<App_String, App_Constants::MAX_SD_CABS> Cab_IR_Library::names = {};
+std::array<Cab_IR_Library::Cab_Kernel, App_Constants::MAX_SD_CABS> Cab_IR_Library::kernels = {};
+size_t Cab_IR_Library::num_cabs = 0;
+
+//lets the WAV reader pull bytes directly out of an SD card file
+class SD_Wav_Source : public Wav_Source {
+public:
+    SD_Wav_Source(File& _file): file(_file) {}
+    size_t read(uint8_t* buf, size_t len) override {
+        int got = file.read(buf, len);
+        return got > 0 ? (size_t)got : 0;
+    }
+private:
+    File& file;
+};
+
+//================================= PUBLIC MEMBER FUNCTIONS =============================
+
+void Cab_IR_Library::init(uint32_t headroom_shift) {
+    num_cabs = 0;
+
+    //mount the card and open up our cab directory; bail if either isn't there
+    if(!SD.begin(BUILTIN_SDCARD)) return;
+    File dir = SD.open(App_Constants::SD_CAB_DIRECTORY);
+    if(!dir) return;
+    if(!dir.isDirectory()) {
+        dir.close();
+        return;
+    }
+
+    //go through every file in the directory, trying to load anything that looks like a WAV file or a preprocessed cab
+    while(num_cabs < App_Constants::MAX_SD_CABS) {
+        File entry = dir.openNextFile();
+        if(!entry) break;
+
+        //check the file extension (case insensitive)
+        std::string file_name = entry.name();
+        bool has_ext = !entry.isDirectory() && file_name.size() > 4;
+        bool is_wav = has_ext && strcasecmp(file_name.c_str() + file_name.size() - 4, ".wav") == 0;
+        bool is_blob = has_ext && strcasecmp(file_name.c_str() + file_name.size() - 4, Cab_Blob::FILE_EXTENSION) == 0;
+
+        //load the file; name the cab after the file (sans extension)
+        bool loaded = false;
+        if(is_wav) loaded = load_ir(entry, headroom_shift);
+        else if(is_blob) loaded = load_blob(entry, headroom_shift);
+        
+        if(loaded) {
+            size_t name_len = min(file_name.size() - 4, MAX_NAME_CHARS);
+            memcpy(name_text[num_cabs].data(), file_name.c_str(), name_len);
+            name_text[num_cabs][name_len] = '\0';
+            names[num_cabs] = App_String(name_text[num_cabs].data(), name_len);
+            num_cabs++;
+        }
+        entry.close();
+    }
+    dir.close();
+}
+
+size_t Cab_IR_Library::get_num_cabs() { return num_cabs; }
+
+//always want to return at least one name so that a selection parameter can be built from this
+//placeholder is a function-local static so it exists no matter when this gets called
+App_Span<App_String> Cab_IR_Library::get_names() {
+    static std::array<App_String, 1> placeholder = {App_Strings::NO_SD_CABS};
+    if(num_cabs == 0) return App_Span<App_String>(placeholder);
+    return App_Span<App_String>(names.data(), num_cabs);
+}
+
+App_Span<const int16_t> Cab_IR_Library::get_kernel(size_t index) {
+    if(index >= num_cabs) return App_Span<const int16_t>();
+    return App_Span<const int16_t>(kernels[index].taps, kernels[index].num_taps);
+}
+
+//================================= PRIVATE MEMBER FUNCTIONS =============================
+
+bool Cab_IR_Library::load_ir(File& file, uint32_t headroom_shift) {
+    //parse the WAV header
+    SD_Wav_Source source(file);
+    Wav_Reader wav(source);
+    if(wav.parse_header() != Wav_Reader::OK) return false;
+
+    //only need to read in as much of the file as will make it into the truncated, resampled kernel
+    size_t raw_len = IR_Process::input_length_for(App_Constants::SD_CAB_MAX_TAPS, wav.get_sample_rate(), App_Constants::AUDIO_SAMPLE_RATE_HZ);
+    if(raw_len > wav.get_num_frames()) raw_len = wav.get_num_frames();
+    if(raw_len == 0) return false;
+
+    //scratch buffers only need to live during loading --> just heap allocate them
+    std::unique_ptr<float[]> raw(new float[raw_len]);
+    std::unique_ptr<float[]> resampled(new float[App_Constants::SD_CAB_MAX_TAPS]);
+
+    //stream in the samples (reader goes through the file in chunks), then resample to our audio rate
+    raw_len = wav.read_frames(raw.get(), raw_len);
+    size_t num_taps = IR_Process::resample(raw.get(), raw_len, wav.get_sample_rate(),
+                                            resampled.get(), App_Constants::SD_CAB_MAX_TAPS, App_Constants::AUDIO_SAMPLE_RATE_HZ);
+    if(num_taps == 0) return false;
+
+    //allocate the final kernel in PSRAM (`extmem_malloc()` will fall back to RAM if there's no PSRAM)
+    int16_t* taps = (int16_t*)extmem_malloc(num_taps * sizeof(int16_t));
+    if(taps == nullptr) return false;
+
+    //normalize and save the kernel
+    if(!IR_Process::normalize_to_q15(resampled.get(), num_taps, taps, headroom_shift)) {
+        extmem_free(taps);
+        return false;
+    }
+    kernels[num_cabs] = {taps, num_taps};
+    return true;
+}
+
+//preprocessed kernels can be read straight into their final home
+bool Cab_IR_Library::load_blob(File& file, uint32_t headroom_shift) {
+    //make sure the blob was built for our sample rate and headroom, and fits in our FIR
+    uint8_t header[Cab_Blob::HEADER_BYTES];
+    Cab_Blob::Info info;
+    if(file.read(header, sizeof(header)) != (int)sizeof(header)) return false;
+    if(!Cab_Blob::parse_header(header, info)) return false;
+    if(!Cab_Blob::is_compatible(info, App_Constants::AUDIO_SAMPLE_RATE_HZ, App_Constants::SD_CAB_MAX_TAPS, headroom_shift)) return false;
+
+    //allocate the kernel in PSRAM (`extmem_malloc()` will fall back to RAM if there's no PSRAM)
+    //taps are stored little-endian Q15, same as in memory
+    int16_t* taps = (int16_t*)extmem_malloc(info.num_taps * sizeof(int16_t));
+    if(taps == nullptr) return false;
+    if(file.read(taps, info.num_taps * sizeof(int16_t)) != (int)(info.num_taps * sizeof(int16_t))) {
+        extmem_free(taps);
+        return false;
+    }
+
+    kernels[num_cabs] = {taps, info.num_taps};
+    return true;
+}
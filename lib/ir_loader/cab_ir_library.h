@@ -0,0 +1,74 @@
+#pragma once
+
+/*
+ * Library of cabinet impulse responses loaded off the SD card
+ * At boot, `init()` will:
+ *      \--> mount the built-in SD card and look for WAV files in `App_Constants::SD_CAB_DIRECTORY`
+ *      \--> stream each file in chunks, resample it to the audio sample rate and truncate it to `SD_CAB_MAX_TAPS`
+ *      \--> normalize it with the cab sim headroom convention and cache the Q15 taps
+ *      \--> preprocessed `.cab` files (see `cab_blob.h`, made by `tools/ir_compiler`) skip the processing and are read straight in
+ *
+ * Processed kernels are cached in PSRAM if it's fitted (falls back to RAM otherwise, via `extmem_malloc()`)
+ * Kernels are loaded once and never freed, so references returned from here are valid for the lifetime of the program
+ *
+ * Intention is to use this class statically, i.e. don't instantiate it
+ */
+
+#include <array>
+#include <string>
+#include <Arduino.h>
+
+#include <config.h> //for max number of cabs and taps
+#include <utils.h> //for App_Span, App_String
+
+//forward declaring SD card file so we don't need to pull in the SD library everywhere
+class File;
+
+class Cab_IR_Library {
+public:
+    //prevent all flavors of making an instance of one of these
+    Cab_IR_Library() = delete;
+    Cab_IR_Library(const Cab_IR_Library& other) = delete;
+    void operator=(const Cab_IR_Library& other) = delete;
+
+    //mount the SD card and load all the impulse responses we can find
+    //pass in the headroom shift to normalize the impulse responses with
+    //this will take a little bit; call during setup before the audio system starts up
+    static void init(uint32_t headroom_shift);
+
+    //how many impulse responses we were able to load
+    static size_t get_num_cabs();
+
+    //names of all the loaded impulse responses (file names without the extension)
+    //if nothing was loaded, this will contain a single placeholder entry (and `get_kernel()` will return an empty span)
+    //names longer than `MAX_NAME_CHARS` get truncated
+    static App_Span<App_String> get_names();
+
+    //get the Q15 taps for the impulse response at the particular index
+    //returns an empty span if the index is outta range
+    static App_Span<const int16_t> get_kernel(size_t index);
+
+    static constexpr size_t MAX_NAME_CHARS = 31;
+
+private:
+    //processed impulse response, living in PSRAM or RAM
+    struct Cab_Kernel {
+        int16_t* taps;
+        size_t num_taps;
+    };
+
+    //load a single WAV file off the SD card into the next free kernel slot
+    //returns true if the file was successfully loaded
+    static bool load_ir(File& file, uint32_t headroom_shift);
+
+    //load a preprocessed kernel blob off the SD card into the next free kernel slot
+    //blob has to have been normalized with the same headroom shift as the WAV files, or it'd run at the wrong gain
+    //returns true if the file was successfully loaded
+    static bool load_blob(File& file, uint32_t headroom_shift);
+
+    //name text lives in fixed buffers; `names` are the handles to it that get passed around
+    static std::array<std::array<char, MAX_NAME_CHARS + 1>, App_Constants::MAX_SD_CABS> name_text;
+    static std::array<App_String, App_Constants::MAX_SD_CABS> names;
+    static std::array<Cab_Kernel, App_Constants::MAX_SD_CABS> kernels;
+    static size_t num_cabs;
+};
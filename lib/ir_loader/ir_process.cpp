@@ -0,0 +1,90 @@
+#include <ir_process.h>
+
+#include <math.h> //sinf, cosf, ceilf, fabsf
+
+static constexpr float PI_F = 3.14159265358979f;
+
+//=========================== RESAMPLING =========================
+
+size_t IR_Process::input_length_for(size_t out_len, uint32_t in_rate, uint32_t out_rate) {
+    if(out_len == 0) return 0;
+    if(in_rate == out_rate) return out_len;
+
+    //interpolation kernel gets wider (in input samples) when we're downsampling
+    float ratio = (float)in_rate / (float)out_rate;
+    float half_width = ratio > 1.0f ? SINC_HALF_WIDTH * ratio : SINC_HALF_WIDTH;
+    return (size_t)ceilf((out_len - 1) * ratio + half_width) + 1;
+}
+
+size_t IR_Process::resample(const float* in, size_t in_len, uint32_t in_rate, float* out, size_t out_max, uint32_t out_rate) {
+    if(in_len == 0 || out_max == 0) return 0;
+
+    //same rate --> nothing to interpolate
+    if(in_rate == out_rate) {
+        size_t len = in_len < out_max ? in_len : out_max;
+        for(size_t i = 0; i < len; i++) out[i] = in[i];
+        return len;
+    }
+
+    //step through the input by `ratio` samples for every output sample
+    //when downsampling, need to lower the cutoff of the interpolation filter to the output nyquist frequency
+    //  \--> this stretches the kernel (in input samples) by the same ratio
+    const float ratio = (float)in_rate / (float)out_rate;
+    const float cutoff = ratio > 1.0f ? 1.0f / ratio : 1.0f; //relative to the input nyquist frequency
+    const float half_width = SINC_HALF_WIDTH / cutoff; //in input samples
+
+    size_t out_len = (size_t)((in_len - 1) / ratio) + 1;
+    if(out_len > out_max) out_len = out_max;
+
+    for(size_t n = 0; n < out_len; n++) {
+        //position of this output sample in the input, and the range of input samples the kernel covers
+        const float t = n * ratio;
+        int32_t k_start = (int32_t)ceilf(t - half_width);
+        int32_t k_end = (int32_t)(t + half_width);
+        if(k_start < 0) k_start = 0;
+        if(k_end > (int32_t)in_len - 1) k_end = (int32_t)in_len - 1;
+
+        //hann-windowed sinc interpolation
+        float sum = 0;
+        for(int32_t k = k_start; k <= k_end; k++) {
+            float dist = t - k;
+            float x = PI_F * cutoff * dist;
+            float sinc = fabsf(x) < 1e-6f ? 1.0f : sinf(x) / x;
+            float window = 0.5f * (1.0f + cosf(PI_F * dist / half_width));
+            sum += in[k] * cutoff * sinc * window;
+        }
+        out[n] = sum;
+    }
+
+    return out_len;
+}
+
+//=========================== NORMALIZATION =========================
+
+bool IR_Process::normalize_to_q15(const float* in, size_t len, int16_t* out, uint32_t headroom_shift) {
+    //figure out the worst-case gain of the impulse response, along with the largest individual tap
+    float abs_sum = 0;
+    float abs_peak = 0;
+    for(size_t i = 0; i < len; i++) {
+        float mag = fabsf(in[i]);
+        abs_sum += mag;
+        if(mag > abs_peak) abs_peak = mag;
+    }
+    if(abs_sum == 0) return false;
+
+    //scale worst-case gain to our headroom, then back off if any taps wouldn't fit into Q15
+    static constexpr float Q15_MAX = 32767.0f / 32768.0f;
+    float scale = (float)(1UL << headroom_shift) / abs_sum;
+    if(abs_peak * scale > Q15_MAX) scale = Q15_MAX / abs_peak;
+
+    //convert to Q15, rounding to nearest
+    for(size_t i = 0; i < len; i++) {
+        float tap = in[i] * scale * 32768.0f;
+        int32_t rounded = (int32_t)(tap < 0 ? tap - 0.5f : tap + 0.5f);
+        if(rounded > 32767) rounded = 32767;
+        if(rounded < -32768) rounded = -32768;
+        out[i] = (int16_t)rounded;
+    }
+
+    return true;
+}
@@ -0,0 +1,41 @@
+#pragma once
+
+/*
+ * Processing stages to turn a raw impulse response (read in from a WAV file) into FIR taps we can run
+ *      \--> resampling to the audio sample rate (windowed-sinc interpolation, band-limited when downsampling)
+ *      \--> normalization and conversion to Q15 taps
+ *
+ * Like the WAV reader, nothing in here is Arduino-specific so it can be run and tested on a host machine
+ * Intention is to use this class statically, i.e. don't instantiate it
+ */
+
+#include <stdint.h>
+#include <stddef.h>
+
+class IR_Process {
+public:
+    //prevent all flavors of making an instance of one of these
+    IR_Process() = delete;
+    IR_Process(const IR_Process& other) = delete;
+    void operator=(const IR_Process& other) = delete;
+
+    //how many samples at `in_rate` we need to produce `out_len` samples at `out_rate`
+    //includes the extra samples that the interpolation filter looks ahead by
+    static size_t input_length_for(size_t out_len, uint32_t in_rate, uint32_t out_rate);
+
+    //resample `in` from `in_rate` to `out_rate`, writing at most `out_max` samples
+    //returns the number of samples written to `out`
+    //if the rates match, this is just a copy
+    static size_t resample(const float* in, size_t in_len, uint32_t in_rate, float* out, size_t out_max, uint32_t out_rate);
+
+    //normalize the impulse response and convert it to Q15 taps
+    //scales the impulse response such that its worst-case gain (sum of absolute values of the taps) is `1 << headroom_shift`
+    //  \--> same headroom convention as the cab sim's `IMPULSE_POST_SCALE_SHIFT`; loud inputs will safely clip at the output rather than the taps
+    //  \--> will back off the scaling further if any individual tap would exceed the Q15 range
+    //returns false if the impulse response is all zeros
+    static bool normalize_to_q15(const float* in, size_t len, int16_t* out, uint32_t headroom_shift);
+
+private:
+    //number of zero crossings of the interpolation kernel on either side of the center
+    static constexpr size_t SINC_HALF_WIDTH = 16;
+};
@@ -0,0 +1,152 @@
+#include <wav_reader.h>
+
+#include <string.h> //memcmp
+
+//a couple helpers to pull little-endian values out of byte buffers
+static inline uint16_t read_le16(const uint8_t* p) { return (uint16_t)p[0] | ((uint16_t)p[1] << 8); }
+static inline uint32_t read_le32(const uint8_t* p) { return (uint32_t)p[0] | ((uint32_t)p[1] << 8) | ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24); }
+
+//format tags from the WAV spec that we care about
+static constexpr uint16_t WAVE_FORMAT_PCM = 0x0001;
+static constexpr uint16_t WAVE_FORMAT_IEEE_FLOAT = 0x0003;
+static constexpr uint16_t WAVE_FORMAT_EXTENSIBLE = 0xFFFE;
+
+Wav_Reader::Wav_Reader(Wav_Source& _source): source(_source) {}
+
+//=========================== HEADER PARSING =========================
+
+Wav_Reader::Status Wav_Reader::parse_header() {
+    uint8_t header[40]; //big enough for the RIFF header and the largest `fmt ` chunk we care about
+
+    //RIFF header --> "RIFF" <size> "WAVE"
+    if(!read_exact(header, 12)) return READ_ERROR;
+    if(memcmp(header, "RIFF", 4) != 0 || memcmp(header + 8, "WAVE", 4) != 0) return NOT_RIFF_WAVE;
+
+    //walk through the chunks until we find the sample data
+    //`fmt ` has to come before `data`, any other chunks just get skipped
+    bool found_fmt = false;
+    while(true) {
+        if(!read_exact(header, 8)) return found_fmt ? NO_DATA_CHUNK : NO_FMT_CHUNK;
+        uint32_t chunk_size = read_le32(header + 4);
+        uint32_t chunk_padding = chunk_size & 1; //chunks are word-aligned
+
+        if(memcmp(header, "fmt ", 4) == 0) {
+            //only need the first 40 bytes of the format chunk at most
+            uint32_t fmt_bytes = chunk_size < sizeof(header) ? chunk_size : sizeof(header);
+            if(fmt_bytes < 16) return UNSUPPORTED_FORMAT;
+            if(!read_exact(header, fmt_bytes)) return READ_ERROR;
+            if(!skip(chunk_size - fmt_bytes + chunk_padding)) return READ_ERROR;
+
+            uint16_t format_tag = read_le16(header);
+            num_channels = read_le16(header + 2);
+            sample_rate = read_le32(header + 4);
+            bits_per_sample = read_le16(header + 14);
+
+            //extensible format stores the actual format in the first two bytes of the subformat GUID
+            if(format_tag == WAVE_FORMAT_EXTENSIBLE) {
+                if(fmt_bytes < 26) return UNSUPPORTED_FORMAT;
+                format_tag = read_le16(header + 24);
+            }
+
+            //sanity check what we got
+            is_float = (format_tag == WAVE_FORMAT_IEEE_FLOAT);
+            if(format_tag != WAVE_FORMAT_PCM && !is_float) return UNSUPPORTED_FORMAT;
+            if(is_float && bits_per_sample != 32) return UNSUPPORTED_FORMAT;
+            if(!is_float && bits_per_sample != 8 && bits_per_sample != 16 && bits_per_sample != 24 && bits_per_sample != 32) return UNSUPPORTED_FORMAT;
+            if(num_channels == 0 || num_channels > MAX_CHANNELS || sample_rate == 0) return UNSUPPORTED_FORMAT;
+
+            bytes_per_frame = num_channels * (bits_per_sample >> 3);
+            found_fmt = true;
+        }
+
+        else if(memcmp(header, "data", 4) == 0) {
+            if(!found_fmt) return NO_FMT_CHUNK;
+            num_frames = chunk_size / bytes_per_frame;
+            data_bytes_remaining = num_frames * bytes_per_frame; //ignore any partial frame at the end
+            return OK;
+        }
+
+        //some other chunk we don't care about
+        else if(!skip(chunk_size + chunk_padding)) return READ_ERROR;
+    }
+}
+
+uint32_t Wav_Reader::get_sample_rate() { return sample_rate; }
+uint16_t Wav_Reader::get_num_channels() { return num_channels; }
+uint16_t Wav_Reader::get_bits_per_sample() { return bits_per_sample; }
+uint32_t Wav_Reader::get_num_frames() { return num_frames; }
+
+//=========================== SAMPLE READING =========================
+
+size_t Wav_Reader::read_frames(float* dst, size_t max_frames) {
+    const size_t frames_per_chunk = CHUNK_BYTES / bytes_per_frame;
+    const size_t bytes_per_sample = bits_per_sample >> 3;
+    const float channel_scale = 1.0f / (float)num_channels;
+    size_t frames_read = 0;
+
+    //pull in a chunk of the file at a time, convert each chunk to mono floats
+    while(frames_read < max_frames && data_bytes_remaining > 0) {
+        size_t frames_this_chunk = max_frames - frames_read;
+        if(frames_this_chunk > frames_per_chunk) frames_this_chunk = frames_per_chunk;
+        if(frames_this_chunk > data_bytes_remaining / bytes_per_frame) frames_this_chunk = data_bytes_remaining / bytes_per_frame;
+
+        size_t bytes_this_chunk = frames_this_chunk * bytes_per_frame;
+        size_t bytes_got = source.read(chunk_buffer, bytes_this_chunk);
+        frames_this_chunk = bytes_got / bytes_per_frame; //in case the file got truncated
+        if(frames_this_chunk == 0) {
+            data_bytes_remaining = 0;
+            break;
+        }
+        data_bytes_remaining -= bytes_got;
+
+        //average all the channels together
+        const uint8_t* src = chunk_buffer;
+        for(size_t i = 0; i < frames_this_chunk; i++) {
+            float sum = 0;
+            for(size_t ch = 0; ch < num_channels; ch++) {
+                sum += decode_sample(src);
+                src += bytes_per_sample;
+            }
+            dst[frames_read++] = sum * channel_scale;
+        }
+    }
+
+    return frames_read;
+}
+
+//convert a single sample to a float in the range [-1, 1)
+float Wav_Reader::decode_sample(const uint8_t* src) {
+    if(is_float) {
+        uint32_t bits = read_le32(src);
+        float val;
+        memcpy(&val, &bits, sizeof(val));
+        return val;
+    }
+
+    switch(bits_per_sample) {
+        case 8: //8-bit WAV is unsigned
+            return ((int32_t)src[0] - 128) * (1.0f / 128.0f);
+        case 16:
+            return (int16_t)read_le16(src) * (1.0f / 32768.0f);
+        case 24: //sign extend by placing the sample in the top of a 32-bit word
+            return (int32_t)(((uint32_t)src[0] << 8) | ((uint32_t)src[1] << 16) | ((uint32_t)src[2] << 24)) * (1.0f / 2147483648.0f);
+        default: //32
+            return (int32_t)read_le32(src) * (1.0f / 2147483648.0f);
+    }
+}
+
+//=========================== PRIVATE HELPERS =========================
+
+bool Wav_Reader::read_exact(uint8_t* buf, size_t len) {
+    return source.read(buf, len) == len;
+}
+
+//no seeking in the source interface, so just read into the chunk buffer and throw it away
+bool Wav_Reader::skip(uint32_t len) {
+    while(len > 0) {
+        size_t to_read = len < CHUNK_BYTES ? len : CHUNK_BYTES;
+        if(!read_exact(chunk_buffer, to_read)) return false;
+        len -= to_read;
+    }
+    return true;
+}
@@ -0,0 +1,87 @@
+#pragma once
+
+/*
+ * Minimal streaming WAV file parser for loading impulse responses
+ * Intentionally doesn't depend on anything Arduino-specific so this can be compiled and tested on a host machine
+ *      \--> data comes in through a `Wav_Source`, which is just something we can read bytes out of
+ *      \--> on the Teensy this wraps an SD card `File`; on a host machine this can wrap a `FILE*`
+ *
+ * Supports:
+ *      \--> 8/16/24/32-bit integer PCM and 32-bit float samples
+ *      \--> WAVE_FORMAT_EXTENSIBLE headers (as long as the subformat is one of the above)
+ *      \--> any number of channels up to `MAX_CHANNELS`; channels are averaged down to mono
+ *
+ * Samples are read out in chunks of `CHUNK_BYTES` so we never need to hold the entire file in memory
+ */
+
+#include <stdint.h>
+#include <stddef.h>
+
+//interface for something we can pull WAV file bytes out of sequentially
+class Wav_Source {
+public:
+    virtual ~Wav_Source() {}
+
+    //read up to `len` bytes into `buf`, return how many bytes were actually read
+    virtual size_t read(uint8_t* buf, size_t len) = 0;
+};
+
+class Wav_Reader {
+public:
+    //result of parsing the header
+    enum Status {
+        OK = 0,
+        READ_ERROR,
+        NOT_RIFF_WAVE,
+        NO_FMT_CHUNK,
+        UNSUPPORTED_FORMAT,
+        NO_DATA_CHUNK
+    };
+
+    //limits on what we'll try to parse
+    static constexpr size_t MAX_CHANNELS = 8;
+    static constexpr size_t CHUNK_BYTES = 512;
+
+    //just save the source we're reading from
+    Wav_Reader(Wav_Source& _source);
+
+    //read through the file header until we hit the start of the sample data
+    //call this before anything else; all getters are invalid unless this returns `OK`
+    Status parse_header();
+
+    //file information
+    uint32_t get_sample_rate();
+    uint16_t get_num_channels();
+    uint16_t get_bits_per_sample();
+    uint32_t get_num_frames(); //number of samples per channel
+
+    //read up to `max_frames` frames (i.e. one sample per channel) into `dst`, downmixed to mono
+    //samples are normalized to [-1, 1)
+    //returns the number of frames actually read; 0 once we've hit the end of the data
+    size_t read_frames(float* dst, size_t max_frames);
+
+private:
+    //read exactly `len` bytes from the source; returns false if we couldn't
+    bool read_exact(uint8_t* buf, size_t len);
+
+    //skip over `len` bytes in the source by reading them into our chunk buffer
+    bool skip(uint32_t len);
+
+    //convert a single sample at `src` to a float based on our sample format
+    float decode_sample(const uint8_t* src);
+
+    //where we're getting our bytes from
+    Wav_Source& source;
+
+    //format information pulled out of the header
+    bool is_float = false;
+    uint16_t num_channels = 0;
+    uint32_t sample_rate = 0;
+    uint16_t bits_per_sample = 0;
+    uint16_t bytes_per_frame = 0;
+    uint32_t data_bytes_remaining = 0;
+    uint32_t num_frames = 0;
+
+    //scratch buffer that we read chunks of the file into
+    uint8_t chunk_buffer[CHUNK_BYTES];
+};
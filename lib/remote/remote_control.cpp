@@ -0,0 +1,86 @@
+#include <remote_control.h>
+
+#include <string.h> //strncpy
+
+#include <all_effects.h> //the chain we're controlling
+#include <usb_capture.h> //capture control
+
+//================================================ PUBLIC FUNCTIONS ============================================
+
+Remote_Control::Remote_Control():
+    server(*this)
+{}
+
+//stop after every response so a flood of requests can't hold up the rest of `loop()` for long
+void Remote_Control::update() {
+    while(Serial.available() > 0) {
+        size_t response_len = server.feed(Serial.read(), response.data());
+        if(response_len > 0) {
+            Serial.write(response.data(), response_len);
+            return;
+        }
+    }
+}
+
+//======================================== TARGET INTERFACE ===================================
+
+uint8_t Remote_Control::get_num_slots() { return App_Constants::NUM_EFFECTS; }
+uint8_t Remote_Control::get_num_effects() { return Effects_Manager::get_num_effects(); }
+uint8_t Remote_Control::get_params_per_slot() { return App_Constants::NUM_EDIT_PARAMS; }
+
+uint32_t Remote_Control::get_cycles_per_block() {
+    return (uint64_t)F_CPU_ACTUAL * App_Constants::PROCESSING_BLOCK_SIZE / App_Constants::AUDIO_SAMPLE_RATE_HZ;
+}
+
+void Remote_Control::get_effect_name(uint8_t effect, char* name) {
+    strncpy(name, Effects_Manager::get_available_effects()[effect].name.c_str(), Remote_Protocol::MAX_NAME);
+}
+
+//active effects don't keep track of which registry entry made them, so match them back up to the registry by name
+bool Remote_Control::get_slot_effect(uint8_t slot, uint8_t& effect) {
+    App_String active_name = Effects_Manager::get_active_effect(slot)->get_name();
+    App_Span<const Effect_Descriptor> available = Effects_Manager::get_available_effects();
+    for(size_t i = 0; i < available.size(); i++) {
+        if(available[i].name == active_name) {
+            effect = i;
+            return true;
+        }
+    }
+    return false;
+}
+
+void Remote_Control::replace_slot(uint8_t slot, uint8_t effect) {
+    Effects_Manager::replace(slot, effect);
+    UI_Page::request_redraw(); //icons on the main screen
+}
+
+bool Remote_Control::get_param(uint8_t slot, uint8_t param, float& value, float& min, float& max, char* label) {
+    Effect_Parameter* p = Effects_Manager::get_active_effect(slot)->get_param(param);
+    if(p == nullptr) return false;
+
+    value = p->get_value();
+    min = p->get_min_value();
+    max = p->get_max_value();
+    strncpy(label, p->get_label().c_str(), Remote_Protocol::MAX_NAME);
+    return true;
+}
+
+bool Remote_Control::set_param(uint8_t slot, uint8_t param, float value, float& actual) {
+    Effect_Parameter* p = Effects_Manager::get_active_effect(slot)->get_param(param);
+    if(p == nullptr) return false;
+
+    p->set_value(value);
+    actual = p->get_value();
+    return true;
+}
+
+void Remote_Control::get_perf(uint8_t slot, uint32_t& cycles, uint32_t& peak_cycles) {
+    cycles = Effects_Manager::get_cycles(slot);
+    peak_cycles = Effects_Manager::get_peak_cycles(slot);
+}
+
+void Remote_Control::reset_perf_peaks() { Effects_Manager::reset_peak_cycles(); }
+
+bool Remote_Control::start_capture(uint8_t tap_point) { return USB_Capture::start(tap_point); }
+void Remote_Control::stop_capture() { USB_Capture::stop(); }
+void Remote_Control::start_throughput_test() { USB_Capture::start_throughput_test(); }
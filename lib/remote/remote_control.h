@@ -0,0 +1,50 @@
+#pragma once
+
+/*
+ * Firmware side of the remote-control protocol
+ * Lets a host do over USB serial what the encoders do: list effects, swap slots, read/tweak parameters, plus read CPU usage
+ * and start/stop USB audio capture
+ *
+ * `update()` runs from `loop()`, feeding whatever's come in on `Serial` through a `Remote_Server` a byte at a time
+ *      \--> everything happens in `loop()` context, same as the UI, so slot changes and parameter writes need no extra locking
+ *      \--> parameter writes go through the parameter's `set_value()`, so the knob picks up from wherever the host left it
+ *      \--> no heap allocation in the protocol handling (effect names are handles into the constant string table)
+ *
+ * Only instantiate one of these, it owns the serial port's receive side
+ */
+
+#include <array>
+#include <Arduino.h>
+
+#include <remote_server.h> //protocol handling, and the interface we implement
+#include <config.h> //for chain length, parameter count
+
+class Remote_Control : public Remote_Target {
+public:
+    Remote_Control();
+
+    //handle anything that's come in over serial; call this from `loop()`
+    void update();
+
+    //implement the target interface on top of the effects manager
+    uint8_t get_num_slots() override;
+    uint8_t get_num_effects() override;
+    uint8_t get_params_per_slot() override;
+    uint32_t get_cycles_per_block() override;
+    void get_effect_name(uint8_t effect, char* name) override;
+    bool get_slot_effect(uint8_t slot, uint8_t& effect) override;
+    void replace_slot(uint8_t slot, uint8_t effect) override;
+    bool get_param(uint8_t slot, uint8_t param, float& value, float& min, float& max, char* label) override;
+    bool set_param(uint8_t slot, uint8_t param, float value, float& actual) override;
+    void get_perf(uint8_t slot, uint32_t& cycles, uint32_t& peak_cycles) override;
+    void reset_perf_peaks() override;
+    bool start_capture(uint8_t tap_point) override;
+    void stop_capture() override;
+    void start_throughput_test() override;
+
+private:
+    Remote_Server server;
+
+    //encoded response waiting to go out
+    std::array<uint8_t, Remote_Protocol::MAX_ENCODED> response;
+};
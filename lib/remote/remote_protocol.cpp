@@ -0,0 +1,174 @@
+#include <remote_protocol.h>
+
+#include <string.h> //strlen, memcpy
+
+namespace Remote_Protocol {
+
+//bit at a time; messages are tiny so a table isn't worth the space
+uint16_t crc16(const uint8_t* buf, size_t len, uint16_t crc) {
+    for(size_t i = 0; i < len; i++) {
+        crc ^= (uint16_t)buf[i] << 8;
+        for(size_t bit = 0; bit < 8; bit++)
+            crc = (crc & 0x8000) ? (uint16_t)((crc << 1) ^ 0x1021) : (uint16_t)(crc << 1);
+    }
+    return crc;
+}
+
+//lay out the raw message with its CRC, then COBS-encode it straight into `out`
+//every zero gets replaced by the distance to the next zero; blocks are capped at 254 data bytes
+//starts with a zero too, so the receiver drops whatever partial frame (or capture data) came before and starts fresh
+size_t encode(const Message& message, uint8_t* out) {
+    std::array<uint8_t, MAX_MESSAGE> raw;
+    size_t raw_len = 0;
+    raw[raw_len++] = message.command;
+    raw[raw_len++] = message.sequence;
+    memcpy(raw.data() + raw_len, message.payload.data(), message.length);
+    raw_len += message.length;
+    uint16_t crc = crc16(raw.data(), raw_len);
+    raw[raw_len++] = crc & 0xFF;
+    raw[raw_len++] = crc >> 8;
+
+    out[0] = 0;
+    size_t code_pos = 1;
+    size_t out_pos = 2;
+    uint8_t code = 1;
+    for(size_t i = 0; i < raw_len; i++) {
+        if(raw[i] == 0) {
+            out[code_pos] = code;
+            code_pos = out_pos++;
+            code = 1;
+            continue;
+        }
+
+        out[out_pos++] = raw[i];
+        if(++code == 0xFF) {
+            out[code_pos] = code;
+            code_pos = out_pos++;
+            code = 1;
+        }
+    }
+    out[code_pos] = code;
+    out[out_pos++] = 0;
+    return out_pos;
+}
+
+//=========================== PAYLOAD HELPERS =========================
+
+void Payload_Writer::put_u8(uint8_t v) {
+    if(message.length >= MAX_PAYLOAD) {
+        overflow = true;
+        return;
+    }
+    message.payload[message.length++] = v;
+}
+
+void Payload_Writer::put_u32(uint32_t v) {
+    for(size_t i = 0; i < 4; i++) put_u8((v >> (8 * i)) & 0xFF);
+}
+
+void Payload_Writer::put_f32(float v) {
+    uint32_t bits;
+    memcpy(&bits, &v, sizeof(bits));
+    put_u32(bits);
+}
+
+void Payload_Writer::put_string(const char* s) {
+    size_t len = strlen(s);
+    if(len > MAX_NAME) len = MAX_NAME;
+    put_u8(len);
+    for(size_t i = 0; i < len; i++) put_u8(s[i]);
+}
+
+uint8_t Payload_Reader::get_u8() {
+    if(pos >= message.length) {
+        underflow = true;
+        return 0;
+    }
+    return message.payload[pos++];
+}
+
+uint32_t Payload_Reader::get_u32() {
+    uint32_t v = 0;
+    for(size_t i = 0; i < 4; i++) v |= (uint32_t)get_u8() << (8 * i);
+    return v;
+}
+
+float Payload_Reader::get_f32() {
+    uint32_t bits = get_u32();
+    float v;
+    memcpy(&v, &bits, sizeof(v));
+    return v;
+}
+
+size_t Payload_Reader::get_string(char* dest, size_t max_len) {
+    size_t len = get_u8();
+    size_t kept = 0;
+    for(size_t i = 0; i < len; i++) {
+        char c = get_u8();
+        if(kept + 1 < max_len) dest[kept++] = c;
+    }
+    if(max_len > 0) dest[kept] = 0;
+    return kept;
+}
+
+//=========================== INCREMENTAL DECODER =========================
+
+bool Frame_Decoder::feed(uint8_t byte) {
+    //zero always ends a frame, whatever state we were in
+    if(byte == 0) {
+        //back-to-back delimiters are just idle line, not errors
+        if(length == 0 && block_remaining == 0 && !overflow) {
+            reset();
+            return false;
+        }
+
+        //has to have ended on a block boundary, and be long enough for a command, sequence, and CRC
+        bool valid = !overflow && block_remaining == 0 && length >= 2 + CRC_BYTES;
+        if(valid) {
+            size_t body = length - CRC_BYTES;
+            uint16_t crc = buffer[body] | ((uint16_t)buffer[body + 1] << 8);
+            valid = crc16(buffer.data(), body) == crc;
+        }
+
+        if(valid) {
+            message.command = buffer[0];
+            message.sequence = buffer[1];
+            message.length = length - 2 - CRC_BYTES;
+            memcpy(message.payload.data(), buffer.data() + 2, message.length);
+        }
+        else error_count++;
+
+        reset();
+        return valid;
+    }
+
+    //code byte --> the block before it ended in a zero (unless it was a full-length block)
+    if(block_remaining == 0) {
+        if(block_adds_zero) append(0);
+        block_remaining = byte - 1;
+        block_adds_zero = (byte != 0xFF);
+        return false;
+    }
+
+    append(byte);
+    block_remaining--;
+    return false;
+}
+
+//too long for any valid message --> remember that and throw the frame out when it ends
+void Frame_Decoder::append(uint8_t byte) {
+    if(length >= buffer.size()) {
+        overflow = true;
+        return;
+    }
+    buffer[length++] = byte;
+}
+
+void Frame_Decoder::reset() {
+    length = 0;
+    block_remaining = 0;
+    block_adds_zero = false;
+    overflow = false;
+}
+
+}
@@ -0,0 +1,140 @@
+#pragma once
+
+/*
+ * Binary remote-control protocol, carried over the USB serial port
+ * Shared between the firmware (`Remote_Control`) and the host tools (`tools/remote_client`)
+ *
+ * Framing:
+ *      \--> message is [command][sequence][payload...][CRC-16 (CCITT-FALSE, little-endian) of everything before it]
+ *      \--> the whole message is COBS-encoded and sent between two zero bytes, so a zero always marks a frame boundary
+ *      \--> the leading zero matters: the port is shared with the USB capture stream, and without it a response sent right
+ *           after a capture frame would get glued onto that frame's trailing bytes and fail its CRC
+ *      \--> receiver decodes a byte at a time into a fixed buffer; anything malformed (bad CRC, too long) is dropped at the next zero
+ *
+ * Requests and responses:
+ *      \--> responses echo the request's command with `RESPONSE_FLAG` set, and its sequence number
+ *      \--> first byte of every response payload is a status code, anything after that depends on the command (see `Command`)
+ *      \--> multi-byte values are little-endian, floats are IEEE single precision, strings are a length byte then the characters
+ *
+ * Nothing in here is Arduino-specific and nothing allocates, so the host tools can share it
+ */
+
+#include <array>
+#include <stdint.h>
+#include <stddef.h>
+
+namespace Remote_Protocol {
+    //bump if the message layouts change
+    static constexpr uint8_t VERSION = 1;
+
+    //commands, along with their request --> response payloads
+    enum Command : uint8_t {
+        CMD_GET_INFO = 0x01,        //() --> (version, num slots, num available effects, params per slot, u32 CPU cycles per audio block)
+        CMD_GET_EFFECT_NAME,        //(effect) --> (name)
+        CMD_GET_SLOT,               //(slot) --> (effect index in the available list)
+        CMD_REPLACE_SLOT,           //(slot, effect) --> ()
+        CMD_GET_PARAM,              //(slot, param) --> (f32 value, f32 min, f32 max, label)
+        CMD_SET_PARAM,              //(slot, param, f32 value) --> (f32 value actually set)
+        CMD_GET_PERF,               //(reset peaks) --> (u32 cycles, u32 peak cycles) for every slot
+        CMD_CAPTURE_START,          //(tap point) --> ()
+        CMD_CAPTURE_STOP,           //() --> ()
+        CMD_THROUGHPUT_TEST,        //() --> ()
+    };
+    static constexpr uint8_t RESPONSE_FLAG = 0x80;
+
+    //first byte of every response
+    enum Status : uint8_t {
+        STATUS_OK = 0,
+        STATUS_UNKNOWN_COMMAND,
+        STATUS_BAD_LENGTH,          //request payload was the wrong size for the command
+        STATUS_BAD_INDEX,           //slot, effect, parameter, or tap point doesn't exist
+        STATUS_FAILED,              //request made sense but couldn't be carried out
+    };
+
+    //size limits; everything is sized for the biggest message, so nothing needs to allocate
+    static constexpr size_t MAX_PAYLOAD = 64;
+    static constexpr size_t MAX_NAME = 32; //strings get truncated to this
+    static constexpr size_t CRC_BYTES = 2;
+    static constexpr size_t MAX_MESSAGE = 2 + MAX_PAYLOAD + CRC_BYTES;
+    static constexpr size_t MAX_ENCODED = MAX_MESSAGE + MAX_MESSAGE / 254 + 3; //COBS overhead + the zero delimiters
+
+    //a decoded message
+    struct Message {
+        uint8_t command = 0;
+        uint8_t sequence = 0;
+        uint8_t length = 0;
+        std::array<uint8_t, MAX_PAYLOAD> payload = {0};
+    };
+
+    //CRC-16/CCITT-FALSE (polynomial 0x1021, starting at 0xFFFF)
+    uint16_t crc16(const uint8_t* buf, size_t len, uint16_t crc = 0xFFFF);
+
+    //append the CRC, COBS-encode, and delimit `message` into `out` (needs `MAX_ENCODED` of space), returns the encoded length
+    size_t encode(const Message& message, uint8_t* out);
+
+    //=========================== PAYLOAD HELPERS =========================
+
+    //appends values to a message payload; writes past the end are dropped and flagged
+    class Payload_Writer {
+    public:
+        Payload_Writer(Message& _message): message(_message) { message.length = 0; }
+
+        void put_u8(uint8_t v);
+        void put_u32(uint32_t v);
+        void put_f32(float v);
+        void put_string(const char* s); //truncated to `MAX_NAME`
+
+        inline bool overflowed() { return overflow; }
+
+    private:
+        Message& message;
+        bool overflow = false;
+    };
+
+    //reads values out of a message payload; reads past the end return zero and are flagged
+    class Payload_Reader {
+    public:
+        Payload_Reader(const Message& _message, size_t _pos = 0): message(_message), pos(_pos) {}
+
+        uint8_t get_u8();
+        uint32_t get_u32();
+        float get_f32();
+        size_t get_string(char* dest, size_t max_len); //always null-terminates, returns the string length
+
+        inline bool underflowed() { return underflow; }
+        inline size_t remaining() { return pos < message.length ? message.length - pos : 0; }
+
+    private:
+        const Message& message;
+        size_t pos;
+        bool underflow = false;
+    };
+
+    //=========================== INCREMENTAL DECODER =========================
+
+    //undoes the COBS encoding a byte at a time into a fixed buffer, and checks the CRC at the end of every frame
+    class Frame_Decoder {
+    public:
+        //feed in the next byte off the wire
+        //returns true when it completes a valid message, which stays in `get_message()` until the next call
+        bool feed(uint8_t byte);
+
+        inline const Message& get_message() { return message; }
+
+        //frames thrown away for being malformed
+        inline uint32_t get_error_count() { return error_count; }
+
+    private:
+        std::array<uint8_t, MAX_MESSAGE> buffer;
+        size_t length = 0;
+        uint8_t block_remaining = 0; //data bytes left in the current COBS block (0 --> next byte is a code byte)
+        bool block_adds_zero = false; //whether the current block is followed by an implied zero
+        bool overflow = false;
+
+        Message message;
+        uint32_t error_count = 0;
+
+        void append(uint8_t byte);
+        void reset();
+    };
+}
@@ -0,0 +1,129 @@
+#include <remote_server.h>
+
+using namespace Remote_Protocol;
+
+size_t Remote_Server::feed(uint8_t byte, uint8_t* response) {
+    if(!decoder.feed(byte)) return 0;
+    const Message& request = decoder.get_message();
+
+    //status goes first; if the command fails partway, throw away whatever it started writing after it
+    reply.command = request.command | RESPONSE_FLAG;
+    reply.sequence = request.sequence;
+    Payload_Writer out(reply);
+    out.put_u8(STATUS_OK);
+    Status status = dispatch(request, out);
+    if(status != STATUS_OK) reply.length = 1;
+    reply.payload[0] = status;
+
+    return encode(reply, response);
+}
+
+//check the request is the right size and its indices are in range, then hand it to the target
+Status Remote_Server::dispatch(const Message& request, Payload_Writer& out) {
+    Payload_Reader in(request);
+
+    //expected payload length of every request
+    size_t expected_length;
+    switch(request.command) {
+        case CMD_GET_INFO:          expected_length = 0; break;
+        case CMD_GET_EFFECT_NAME:   expected_length = 1; break;
+        case CMD_GET_SLOT:          expected_length = 1; break;
+        case CMD_REPLACE_SLOT:      expected_length = 2; break;
+        case CMD_GET_PARAM:         expected_length = 2; break;
+        case CMD_SET_PARAM:         expected_length = 6; break;
+        case CMD_GET_PERF:          expected_length = 1; break;
+        case CMD_CAPTURE_START:     expected_length = 1; break;
+        case CMD_CAPTURE_STOP:      expected_length = 0; break;
+        case CMD_THROUGHPUT_TEST:   expected_length = 0; break;
+        default: return STATUS_UNKNOWN_COMMAND;
+    }
+    if(request.length != expected_length) return STATUS_BAD_LENGTH;
+
+    switch(request.command) {
+        case CMD_GET_INFO:
+            out.put_u8(VERSION);
+            out.put_u8(target.get_num_slots());
+            out.put_u8(target.get_num_effects());
+            out.put_u8(target.get_params_per_slot());
+            out.put_u32(target.get_cycles_per_block());
+            return STATUS_OK;
+
+        case CMD_GET_EFFECT_NAME: {
+            uint8_t effect = in.get_u8();
+            if(effect >= target.get_num_effects()) return STATUS_BAD_INDEX;
+            char name[MAX_NAME + 1] = {0};
+            target.get_effect_name(effect, name);
+            out.put_string(name);
+            return STATUS_OK;
+        }
+
+        case CMD_GET_SLOT: {
+            uint8_t slot = in.get_u8();
+            uint8_t effect;
+            if(slot >= target.get_num_slots()) return STATUS_BAD_INDEX;
+            if(!target.get_slot_effect(slot, effect)) return STATUS_FAILED;
+            out.put_u8(effect);
+            return STATUS_OK;
+        }
+
+        case CMD_REPLACE_SLOT: {
+            uint8_t slot = in.get_u8();
+            uint8_t effect = in.get_u8();
+            if(slot >= target.get_num_slots() || effect >= target.get_num_effects()) return STATUS_BAD_INDEX;
+            target.replace_slot(slot, effect);
+            return STATUS_OK;
+        }
+
+        case CMD_GET_PARAM: {
+            uint8_t slot = in.get_u8();
+            uint8_t param = in.get_u8();
+            float value, min, max;
+            char label[MAX_NAME + 1] = {0};
+            if(slot >= target.get_num_slots() || param >= target.get_params_per_slot()) return STATUS_BAD_INDEX;
+            if(!target.get_param(slot, param, value, min, max, label)) return STATUS_BAD_INDEX;
+            out.put_f32(value);
+            out.put_f32(min);
+            out.put_f32(max);
+            out.put_string(label);
+            return STATUS_OK;
+        }
+
+        case CMD_SET_PARAM: {
+            uint8_t slot = in.get_u8();
+            uint8_t param = in.get_u8();
+            float value = in.get_f32();
+            float actual;
+            if(slot >= target.get_num_slots() || param >= target.get_params_per_slot()) return STATUS_BAD_INDEX;
+            if(!target.set_param(slot, param, value, actual)) return STATUS_BAD_INDEX;
+            out.put_f32(actual);
+            return STATUS_OK;
+        }
+
+        //read everything before resetting, so the peaks reported are the ones being cleared
+        case CMD_GET_PERF: {
+            bool reset_peaks = in.get_u8() != 0;
+            for(uint8_t slot = 0; slot < target.get_num_slots(); slot++) {
+                uint32_t cycles, peak_cycles;
+                target.get_perf(slot, cycles, peak_cycles);
+                out.put_u32(cycles);
+                out.put_u32(peak_cycles);
+            }
+            if(reset_peaks) target.reset_perf_peaks();
+            return out.overflowed() ? STATUS_FAILED : STATUS_OK;
+        }
+
+        case CMD_CAPTURE_START:
+            return target.start_capture(in.get_u8()) ? STATUS_OK : STATUS_BAD_INDEX;
+
+        case CMD_CAPTURE_STOP:
+            target.stop_capture();
+            return STATUS_OK;
+
+        case CMD_THROUGHPUT_TEST:
+            target.start_throughput_test();
+            return STATUS_OK;
+
+        default:
+            return STATUS_UNKNOWN_COMMAND;
+    }
+}
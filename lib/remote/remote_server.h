@@ -0,0 +1,70 @@
+#pragma once
+
+/*
+ * Device side of the remote-control protocol (see `remote_protocol.h`)
+ *
+ * Split in two so the protocol handling can run on the host too:
+ *      \--> `Remote_Target` is what gets controlled; the firmware implements it on top of the effects manager (`Remote_Control`)
+ *              and the host stand-in (`tools/remote_client/remote_sim.cpp`) implements it on a simulated chain
+ *      \--> `Remote_Server` decodes requests a byte at a time, checks their payloads, calls into the target, and encodes the response
+ *
+ * Fixed-size buffers throughout, nothing allocates
+ */
+
+#include <stdint.h>
+#include <stddef.h>
+
+#include <remote_protocol.h>
+
+class Remote_Target {
+public:
+    virtual ~Remote_Target() {}
+
+    //shape of the chain
+    virtual uint8_t get_num_slots() = 0;
+    virtual uint8_t get_num_effects() = 0; //effects available to load into a slot
+    virtual uint8_t get_params_per_slot() = 0;
+    virtual uint32_t get_cycles_per_block() = 0; //CPU budget for one audio block
+
+    //name of an available effect, written into `name` (at least `Remote_Protocol::MAX_NAME + 1` long)
+    virtual void get_effect_name(uint8_t effect, char* name) = 0;
+
+    //which available effect a slot holds; false if it doesn't match any of them
+    virtual bool get_slot_effect(uint8_t slot, uint8_t& effect) = 0;
+    virtual void replace_slot(uint8_t slot, uint8_t effect) = 0;
+
+    //parameters of the effect in a slot; false if there's no parameter at that index
+    //`label` is at least `Remote_Protocol::MAX_NAME + 1` long
+    virtual bool get_param(uint8_t slot, uint8_t param, float& value, float& min, float& max, char* label) = 0;
+    virtual bool set_param(uint8_t slot, uint8_t param, float value, float& actual) = 0;
+
+    //CPU cycles the slot took for the last block, and the worst case since peaks were last reset
+    virtual void get_perf(uint8_t slot, uint32_t& cycles, uint32_t& peak_cycles) = 0;
+    virtual void reset_perf_peaks() = 0;
+
+    //USB audio capture control; false if the tap point doesn't exist
+    virtual bool start_capture(uint8_t tap_point) = 0;
+    virtual void stop_capture() = 0;
+    virtual void start_throughput_test() = 0;
+};
+
+class Remote_Server {
+public:
+    Remote_Server(Remote_Target& _target): target(_target) {}
+
+    //feed in the next byte off the wire
+    //if it completes a request, the encoded response is written into `response` (needs `Remote_Protocol::MAX_ENCODED` of space)
+    //returns the number of response bytes to send (zero if there's nothing to send yet)
+    size_t feed(uint8_t byte, uint8_t* response);
+
+    //requests thrown away for being malformed
+    inline uint32_t get_error_count() { return decoder.get_error_count(); }
+
+private:
+    Remote_Target& target;
+    Remote_Protocol::Frame_Decoder decoder;
+    Remote_Protocol::Message reply;
+
+    //fill in the response payload (after the status byte) and return the status
+    Remote_Protocol::Status dispatch(const Remote_Protocol::Message& request, Remote_Protocol::Payload_Writer& out);
+};
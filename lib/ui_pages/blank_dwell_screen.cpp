@@ -25,5 +25,5 @@ void Blank_Dwell_Screen::impl_on_entry() {
 void Blank_Dwell_Screen::draw() {
     //just clear the screen when we draw
     graphics_handle.clearBuffer();
-    graphics_handle.sendBuffer();
+    UI_Page::send_buffer();
 }
\ No newline at end of file
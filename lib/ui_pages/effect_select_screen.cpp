@@ -0,0 +1,159 @@
+#include <effect_select_screen.h>
+
+#include <all_effects.h> //for the effect registry and loading effects
+#include <app_strings.h> //for the back entry
+
+//=============================== PUBLIC FUNCTIONS ===============================
+
+//nothing to do until we're configured
+Effect_Select_Screen::Effect_Select_Screen() {}
+
+//save the encoder and LED corresponding to the index provided
+void Effect_Select_Screen::set_knob_led(size_t knob_led_index) {
+    enc = encs[knob_led_index];
+    led = leds[knob_led_index];
+}
+
+//======================================== OVERRIDEN DERIVED CLASS FUNCTIONS ===================================
+
+void Effect_Select_Screen::impl_on_entry() {
+    //back + one entry per registered effect; keep our selection if it's still in range
+    num_entries = Effects_Manager::get_available_effects().size() + 1;
+    if(selected >= num_entries) selected = 0;
+
+    //one encoder count per entry, starting where we left off; pressing selects
+    enc->set_max_counts(num_entries - 1, selected);
+    enc->attach_on_press(Context_Callback_Function<void>(reinterpret_cast<void*>(this), select_cb));
+
+    //light the LED at the dim level
+    led->set_color(theme_color);
+    led->set_brightness(App_Constants::UI_LED_LEVEL_DIM);
+
+    //and start scrolling the selected entry
+    focus(selected);
+}
+
+void Effect_Select_Screen::impl_on_exit() {
+    //stop scrolling, turn the LED off and let go of the knob
+    selected_text.stop();
+    led->set_color(RGB_LED::OFF);
+    enc->attach_on_press({});
+}
+
+//called when a redraw has been requested, at most every `SCREEN_REDRAW_MS`
+void Effect_Select_Screen::draw() {
+    //follow the knob
+    uint32_t enc_counts = enc->get_counts();
+    if(enc_counts != selected && enc_counts < num_entries) focus(enc_counts);
+
+    //start by clearing the display buffer
+    graphics_handle.clearBuffer();
+
+    //############## HEADER AND UNDERBAR ##############
+
+    //draw the header text at the top of the page; compute some constants for doing so
+    u8g2_uint_t text_height = graphics_handle.getAscent() - graphics_handle.getDescent();
+    static const u8g2_uint_t HEADER_TEXT_X = 0;
+    static const u8g2_uint_t HEADER_TEXT_Y = 0;
+
+    graphics_handle.setFontPosTop();
+    graphics_handle.drawStr(HEADER_TEXT_X, HEADER_TEXT_Y, header_text.c_str());
+    graphics_handle.setFontPosBaseline(); //restore to default
+
+    //draw a horizontal bar underneath the header
+    u8g2_uint_t UNDERBAR_Y = text_height + 1;
+    graphics_handle.drawHLine(0, UNDERBAR_Y, graphics_handle.getDisplayWidth());
+
+    //############## ENTRIES ##############
+    //same spacing as the full screen menu: padding around each entry, increased by 1 to accommodate the frame
+    static const u8g2_uint_t MENU_ITEM_PADDING_X = 1;
+    static const u8g2_uint_t MENU_ITEM_PADDING_Y = 2;
+    static const u8g2_uint_t ACTIVE_REGION_START_X = MENU_ITEM_PADDING_X + 1;
+    static const u8g2_uint_t ACTIVE_REGION_END_X = graphics_handle.getDisplayWidth() - (MENU_ITEM_PADDING_X + 1);
+    u8g2_uint_t ACTIVE_REGION_START_Y = UNDERBAR_Y;
+    static const u8g2_uint_t ACTIVE_REGION_END_Y = graphics_handle.getDisplayHeight();
+
+    //every entry is a single line of text in the current font
+    graphics_handle.setFontRefHeightAll();
+    const int32_t entry_height = graphics_handle.getAscent() - graphics_handle.getDescent();
+    const int32_t entry_pitch = entry_height + (2*MENU_ITEM_PADDING_Y + 1);
+
+    //selected entry sits at the center of the active region
+    u8g2_uint_t selected_start = ((ACTIVE_REGION_END_Y - ACTIVE_REGION_START_Y - entry_height) >> 1) + ACTIVE_REGION_START_Y;
+
+    //only visit the entries that land on the screen: below the selection until we run off the bottom...
+    int32_t below_start = selected_start + entry_pitch;
+    for(size_t i = selected + 1; i < num_entries && below_start <= (int32_t)ACTIVE_REGION_END_Y; i++) {
+        draw_entry( i, ACTIVE_REGION_START_X, below_start, ACTIVE_REGION_END_X, below_start + entry_height,
+                    ACTIVE_REGION_START_Y, ACTIVE_REGION_END_Y);
+        below_start += entry_pitch;
+    }
+
+    //...and above it until we run off the top
+    //going up is a little dicey since values can be negative, hence the signed coordinates
+    int32_t above_end = (int32_t)selected_start - (2*MENU_ITEM_PADDING_Y + 1);
+    for(size_t i = selected; i > 0 && above_end >= (int32_t)ACTIVE_REGION_START_Y; i--) {
+        draw_entry( i - 1, ACTIVE_REGION_START_X, above_end - entry_height, ACTIVE_REGION_END_X, above_end,
+                    ACTIVE_REGION_START_Y, ACTIVE_REGION_END_Y);
+        above_end -= entry_pitch;
+    }
+
+    //the selected entry gets the scrolling text
+    selected_text.set_bounding_box( selected_start, selected_start + entry_height,
+                                    ACTIVE_REGION_START_X, ACTIVE_REGION_END_X);
+    selected_text.render(graphics_handle);
+
+    //############## SELECTED ENTRY FRAME ##############
+    //draw a frame around our selected entry, computing some constants first
+    static const u8g2_uint_t frame_x_start = 0;
+    static const u8g2_uint_t frame_width = graphics_handle.getDisplayWidth();
+    u8g2_uint_t frame_y_start = selected_start - MENU_ITEM_PADDING_Y - 1;
+    u8g2_uint_t frame_height = entry_height + 2*(MENU_ITEM_PADDING_X + 1);
+
+    graphics_handle.setMaxClipWindow();
+    graphics_handle.drawRFrame(frame_x_start, frame_y_start, frame_width, frame_height, 1);
+
+    //############## SEND BUFFER ##############
+    UI_Page::send_buffer();
+}
+
+//====================================== PRIVATE FUNCTIONS ====================================
+
+//entry 0 is "back", the rest come straight out of the registry
+App_String Effect_Select_Screen::get_entry_text(size_t index) {
+    if(index == 0) return App_Strings::MENU_BACK;
+    return Effects_Manager::get_available_effects()[index - 1].name;
+}
+
+//stop scrolling the old entry, start on the new one
+void Effect_Select_Screen::focus(size_t index) {
+    selected_text.stop();
+    selected = index;
+    selected_text.set_render_text(get_entry_text(selected));
+    selected_text.start();
+}
+
+//draw an entry that isn't selected; no scrolling, so just clip it to its row
+void Effect_Select_Screen::draw_entry(  size_t index, u8g2_uint_t x_left, int32_t y_top, u8g2_uint_t x_right, int32_t y_bot,
+                                        u8g2_uint_t clip_top, u8g2_uint_t clip_bot)
+{
+    u8g2_uint_t row_top = (u8g2_uint_t)max(y_top, (int32_t)clip_top);
+    u8g2_uint_t row_bot = (u8g2_uint_t)min(y_bot, (int32_t)clip_bot);
+    if(row_bot <= row_top) return;
+
+    graphics_handle.setClipWindow(x_left, row_top, x_right, row_bot);
+    graphics_handle.setFontPosCenter(); //vertically center our text
+    graphics_handle.drawStr(x_left, (u8g2_uint_t)((y_top + y_bot) >> 1), get_entry_text(index).c_str());
+    graphics_handle.setFontPosBaseline();
+    graphics_handle.setMaxClipWindow();
+}
+
+//load the selected effect (unless it's "back") and head back to the previous page
+void Effect_Select_Screen::select_cb(void* context) {
+    Effect_Select_Screen* page = reinterpret_cast<Effect_Select_Screen*>(context); //pull the instance outta the context
+
+    if(page->selected > 0)
+        Effects_Manager::replace(page->effect_index, page->selected - 1);
+
+    page->to_prev_page();
+}
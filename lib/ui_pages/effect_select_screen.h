@@ -0,0 +1,88 @@
+#pragma once
+
+/*
+ * Page that picks which effect to load into an effect channel
+ * Looks and works like the `Menu_Full_Screen` it replaces: header + underbar, selected entry centered in a frame
+ *      \--> main knob moves through the list, pressing it loads the selected effect and goes back to the main screen
+ *      \--> first entry is "back", which just goes back
+ *
+ * That menu needed a heap-allocated `Menu_Item_Scroll` (plus a heap-allocated [channel, effect] pair for its callback)
+ * for every available effect, for every channel, never freed; RAM grew with channels x effects
+ * This page doesn't own an item per entry:
+ *      \--> entries are read out of the effect registry (`Effects_Manager::get_available_effects()`) as they're drawn
+ *      \--> only the rows that fit on the screen around the selection get drawn
+ *      \--> the selected row scrolls with the page's one `Scroll_String`; the rest are drawn straight, clipped to their row
+ * So a page is the same size no matter how many effects are registered
+ */
+
+#include <Arduino.h>
+#include <U8g2lib.h>
+
+#include <ui_page.h> //inherit from here
+#include <ui_page_helpers/scroll_string.h> //for the selected entry
+#include <encoder.h>
+#include <rgb.h>
+#include <utils.h> //for string handles
+
+class Effect_Select_Screen : public UI_Page {
+public:
+    //default constructor so these can live in an array; configure with the setters below
+    Effect_Select_Screen();
+
+    //which effect channel this page loads effects into
+    inline void set_effect_index(size_t _effect_index) { effect_index = _effect_index; }
+
+    //which knob and LED to use (index into the encoder and LED arrays)
+    void set_knob_led(size_t knob_led_index);
+
+    //page to go back to; we also go here after loading an effect
+    inline void set_prev_page(UI_Page* _prev_page) { to_prev_page.set_to(_prev_page); }
+
+    //color to light the LED on entry
+    inline void set_theme_color(RGB_LED::COLOR _theme_color) { theme_color = _theme_color; }
+
+    //set the header text at the top left of the page
+    //this is just a handle, so whatever it points to has to outlive the page
+    inline void set_header_text(App_String _header_text) { header_text = _header_text; }
+
+private:
+    //override the `UI_Page` functions
+    void impl_on_entry() override; //attach the knob, start scrolling the selected entry
+    void impl_on_exit() override; //detach the knob, turn off the LED
+    void draw() override;
+
+    //text of the entry at `index` --> "back" for 0, the effect name from the registry otherwise
+    App_String get_entry_text(size_t index);
+
+    //move the selection to `index` and restart the scrolling text on it
+    void focus(size_t index);
+
+    //draw an unselected entry left aligned and vertically centered in its row, same as a scroll string that isn't scrolling
+    //`clip_top` and `clip_bot` are where the menu's active region ends, so rows partly off it get cut off there
+    void draw_entry(size_t index, u8g2_uint_t x_left, int32_t y_top, u8g2_uint_t x_right, int32_t y_bot,
+                    u8g2_uint_t clip_top, u8g2_uint_t clip_bot);
+
+    //main knob press --> go back, or load the selected effect into our channel and go back
+    //expects the context to point to the `Effect_Select_Screen` instance
+    static void select_cb(void* context);
+
+    //knob, LED and color to light it with
+    Rotary_Encoder* enc = nullptr;
+    RGB_LED* led = nullptr;
+    RGB_LED::COLOR theme_color = RGB_LED::OFF;
+
+    //header text and the channel we're picking for
+    App_String header_text;
+    size_t effect_index = 0;
+
+    //number of entries (back + every registered effect) and which one is selected
+    //selection sticks around between visits, like the menu this replaced
+    size_t num_entries = 1;
+    size_t selected = 0;
+
+    //the one scrolling string, always showing the selected entry
+    Scroll_String selected_text;
+
+    //transition back to the previous page
+    Pg_Transition to_prev_page;
+};
@@ -1,5 +1,7 @@
 #include <idle_screen.h>
 
+#include <app_strings.h> //for the idle message
+
 //constructor to basically set up some member variables
 Idle_Screen::Idle_Screen(UI_Page* _next_page):
     to_next_page(_next_page) //set up the page transition
@@ -28,15 +30,13 @@ void Idle_Screen::impl_on_entry() {
     graphics_handle.clearBuffer();
 
     //############## HEADER AND UNDERBAR ##############
-    static const std::string IDLE_HEADER = "Idle Screen";
-    
     //draw the header text at the top of the page; compute some constants for doing so
     u8g2_uint_t text_height = graphics_handle.getAscent() - graphics_handle.getDescent();    
     static const u8g2_uint_t HEADER_TEXT_X = 0;
     static const u8g2_uint_t HEADER_TEXT_Y = 0;
 
     graphics_handle.setFontPosTop(); //use the centerline of the text to place it
-    graphics_handle.drawStr(HEADER_TEXT_X, HEADER_TEXT_Y, IDLE_HEADER.c_str());
+    graphics_handle.drawStr(HEADER_TEXT_X, HEADER_TEXT_Y, App_Strings::IDLE_HEADER.c_str());
     graphics_handle.setFontPosBaseline(); //restore to default
 
     //draw a horizontal bar underneath the header
@@ -44,29 +44,20 @@ void Idle_Screen::impl_on_entry() {
     graphics_handle.drawHLine(0, UNDERBAR_Y, graphics_handle.getDisplayWidth());
 
     //############## IDLE MESSAGE ##############
-    static const std::array<std::string, 6> IDLE_MSG = {
-            "This page reduces noise",
-            "by turning off LEDs",
-            "and halting the screen",
-            "",
-            "Turn/click effect knobs",
-            "to return to home page"
-        };
-    
     static const u8g2_uint_t MSG_TEXT_X = 5;
     u8g2_uint_t MSG_TEXT_Y = UNDERBAR_Y + 2;
 
     UI_Page::apply_font_small_params();
     text_height = graphics_handle.getAscent() - graphics_handle.getDescent(); 
     graphics_handle.setFontPosTop(); //use the centerline of the text to place it
-    for(auto& text : IDLE_MSG) {
+    for(const App_String& text : App_Strings::IDLE_MESSAGE) {
         graphics_handle.drawStr(MSG_TEXT_X, MSG_TEXT_Y, text.c_str());
         MSG_TEXT_Y += text_height + 1;
     }
     graphics_handle.setFontPosBaseline(); //restore to default
 
     //########### update the screen ############
-    graphics_handle.sendBuffer();
+    UI_Page::send_buffer();
     UI_Page::restore_font_default();
 
 }
@@ -80,5 +71,5 @@ void Idle_Screen::impl_on_exit() {
 
     //clear the screen
     graphics_handle.clearBuffer();
-    graphics_handle.sendBuffer();
+    UI_Page::send_buffer();
 }
@@ -1,6 +1,11 @@
 
 #include <main_screen.h>
 
+#include <string.h> //memcpy
+
+#include <all_effects.h> //to notice when the chain changes
+#include <app_strings.h> //for the menu text
+
 //============================ STATIC MEMBER DEFINITIONS ========================
 
 const std::array<uint8_t, (Main_Screen::SETTINGS_ICON_WIDTH+7)/8 * Main_Screen::SETTINGS_ICON_HEIGHT> 
@@ -44,9 +49,9 @@ Main_Screen::Main_Screen(std::array<std::unique_ptr<Effect_Interface>, App_Const
     //we'll configure the "nothing selected" text in our entry function
     //since that requires knowing what effects are active
     for(size_t i = 0; i < App_Constants::NUM_EFFECTS; i++) {
-        render_texts[i].set_render_text("Channel [" + std::to_string(i + 1) + "] - Choose Effect");
+        render_texts[i].set_render_text(App_Strings::CHANNEL_CHOOSE_EFFECT[i]);
     }
-    render_texts[App_Constants::NUM_EFFECTS].set_render_text("Settings");
+    render_texts[App_Constants::NUM_EFFECTS].set_render_text(App_Strings::MENU_SETTINGS);
 }
 
 //provide a function to attach effects select pages
@@ -83,7 +88,7 @@ void Main_Screen::impl_on_entry() {
         erc.enc->attach_on_press(erc.to_effect_edit);
 
         //set the corresponding LED to the theme color of the effect at a dim level
-        erc.led->set_color(erc.effect->get()->get_theme_color());
+        erc.led->set_color(erc.theme_color);
         erc.led->set_brightness(App_Constants::UI_LED_LEVEL_DIM);
     }
 
@@ -99,12 +104,15 @@ void Main_Screen::impl_on_entry() {
     //configure our "nothing selected" text
     //list the names of the effects currently active
     //and save this string to our last render text index
-    std::string effect_names_text = "Active Effects:";
+    //formatted into a fixed buffer on the stack; the scrolling text copies it (and skips re-rasterizing if nothing changed)
+    std::array<char, ACTIVE_EFFECTS_TEXT_MAX_CHARS + 1> effect_names_text;
+    size_t text_len = append_text(effect_names_text, 0, App_Strings::MENU_ACTIVE_EFFECTS);
     for(size_t i = 0; i < App_Constants::NUM_EFFECTS; i++) {
-        effect_names_text += " [" + std::to_string(i + 1) + "] ";
-        effect_names_text += ercs[i].effect->get()->get_name();
+        const char channel_tag[] = {' ', '[', (char)('1' + i), ']', ' ', '\0'}; //single-digit channel numbers
+        text_len = append_text(effect_names_text, text_len, channel_tag);
+        text_len = append_text(effect_names_text, text_len, ercs[i].effect->get()->get_name());
     }
-    render_texts.back().set_render_text(effect_names_text);
+    render_texts.back().set_render_text(App_String(effect_names_text.data(), text_len));
 
     //and trigger our scrolling text in advance of entering our menu
     last_selected_item = main_selected_item;
@@ -134,83 +142,26 @@ void Main_Screen::impl_on_exit() {
     idle_screen_timeout.deschedule();
 }
 
-//called every `SCREEN_REDRAW_MS`
+//called when a redraw has been requested, at most every `SCREEN_REDRAW_MS`
 void Main_Screen::draw() {
 
     //###################### RENDERING #####################
 
-    //Start render process by clearing the draw buffer
-    graphics_handle.clearBuffer();
-
-    //######################## SIGNAL "PIPE" RENDERING #####################
-    //simple box to draw a "signal input and output" shape behind all the icons
-    //shape will consist of a rectangular frame at the centerline of the icons, spanning across the width of the screen
-    //then a triangle designating the input and output
-
-    //draw the input triangle
-    static const u8g2_uint_t intri_height = 9;
-    static const u8g2_uint_t intri_width = 4;
-    static const u8g2_uint_t intri_x_start = 0;
-    static const u8g2_uint_t intri_x_end = intri_x_start + intri_width;
-    static const u8g2_uint_t intri_y_mid = graphics_handle.getHeight() - App_Constants::EFFECT_PADDING - ((App_Constants::EFFECT_ICON_HEIGHT + 1) >> 1);
-    static const u8g2_uint_t intri_y_start = intri_y_mid - ((intri_height + 1) >> 1);
-    static const u8g2_uint_t intri_y_end = intri_y_mid + ((intri_height + 1) >> 1);
-    graphics_handle.drawTriangle(   intri_x_start, intri_y_start,
-                                    intri_x_start, intri_y_end,
-                                    intri_x_end, intri_y_mid);
-
-    //draw the output triangle
-    static const u8g2_uint_t outtri_height = intri_height;
-    static const u8g2_uint_t outtri_width = intri_width;
-    static const u8g2_uint_t outtri_x_start = graphics_handle.getWidth() - outtri_width - 1;
-    static const u8g2_uint_t outtri_x_end = graphics_handle.getWidth();
-    static const u8g2_uint_t outtri_y_mid = intri_y_mid;
-    static const u8g2_uint_t outtri_y_start = intri_y_start;
-    static const u8g2_uint_t outtri_y_end = intri_y_end;
-    graphics_handle.drawTriangle(   outtri_x_start, outtri_y_start,
-                                    outtri_x_start, outtri_y_end,
-                                    outtri_x_end, outtri_y_mid);
-
-    //draw the rectangle going across the screen
-    static const u8g2_uint_t rect_width = graphics_handle.getWidth() - outtri_width;
-    static const u8g2_uint_t rect_height = 3;
-    static const u8g2_uint_t rect_x_start = 0;
-    static const u8g2_uint_t rect_y_start = graphics_handle.getHeight() - App_Constants::EFFECT_PADDING - ((App_Constants::EFFECT_ICON_HEIGHT + rect_height) >> 1);
-    graphics_handle.drawBox(rect_x_start, rect_y_start, rect_width, rect_height);
-
-
-    //######################## EFFECT ICON RENDERING #####################
-
-    //RENDER THE EFFECT ICONS --> start by computing some dimension constants
-    static const u8g2_uint_t total_icon_width = App_Constants::NUM_EFFECTS * 
-                                                (App_Constants::EFFECT_ICON_WIDTH + App_Constants::EFFECT_PADDING) - 
-                                                App_Constants::EFFECT_PADDING;
-    static const u8g2_uint_t icon_start_x = (graphics_handle.getWidth() - total_icon_width) >> 1;
-    static const u8g2_uint_t icon_start_y = (graphics_handle.getHeight() - App_Constants::EFFECT_ICON_HEIGHT - App_Constants::EFFECT_PADDING);
-
-    //now actually draw all the icons on the screen
-    u8g2_uint_t x_coord = icon_start_x;
-    for(auto& erc : ercs) {
-        graphics_handle.drawXBMP(   x_coord, icon_start_y, 
-                                    App_Constants::EFFECT_ICON_WIDTH, App_Constants::EFFECT_ICON_HEIGHT, erc.effect->get()->get_icon().data());
-        x_coord += App_Constants::EFFECT_ICON_WIDTH + App_Constants::EFFECT_PADDING;
+    //the pipe, effect icons and settings icon only change when the chain does
+    //render them once into the background layer, then start every frame from a copy of it
+    //chain can change under us (e.g. over remote control), so pick up the new icons and colors too
+    if(!background_valid || background_chain_version != Effects_Manager::get_chain_version()) {
+        for(auto& erc : ercs) erc.update_display_info();
+        render_background();
     }
+    memcpy(graphics_handle.getBufferPtr(), background.data(), background_bytes);
 
-    //########################## SETTINGS ICON RENDERING #######################
-
-    //render an icon in the top right corner as "settings"
-    static u8g2_uint_t settings_x_start = graphics_handle.getWidth() - SETTINGS_ICON_WIDTH - SETTINGS_ICON_X_PADDING;
-    static u8g2_uint_t settings_y_start = SETTINGS_ICON_Y_PADDING;
-    graphics_handle.drawXBMP(   settings_x_start, settings_y_start,
-                                SETTINGS_ICON_WIDTH, SETTINGS_ICON_HEIGHT,
-                                settings_icon.data());
-
-    //###################### end BACKGROUND RENDERING begin MAIN ENCODER HANDLING #####################
+    //########################## MAIN ENCODER HANDLING #######################
 
     //depending on what the main knob is selecting, render the screen and set the LED appropriately
     if(main_selected_item < App_Constants::NUM_EFFECTS) { //we're selecting an effect
         //set the main LED (the last one) color to match the effect theme color
-        leds.back()->set_color(ercs[main_selected_item].effect->get()->get_theme_color());
+        leds.back()->set_color(ercs[main_selected_item].theme_color);
         leds.back()->set_brightness(App_Constants::UI_LED_LEVEL_DIM);
 
         //draw a graphic rectangle around the icon of the selected effect, inverting its colors
@@ -247,6 +198,9 @@ void Main_Screen::draw() {
         blend_counter += App_Constants::SETTINGS_LED_FADE_INC;
         if(blend_counter > App_Constants::SPLASH_LED_COLORS.size()) blend_counter -= (float)App_Constants::SPLASH_LED_COLORS.size();
 
+        //fade advances a step per frame, so keep the frames coming
+        UI_Page::request_redraw();
+
 
         //draw a graphic rectangle around the icon of the settings menu, inverting its colors
         //do so by computing some parameters related to the rectangle
@@ -286,11 +240,99 @@ void Main_Screen::draw() {
     //###################### SEND DISPLAY BUFFER #####################
 
     //write the buffer out to the OLED
-    graphics_handle.sendBuffer();
+    UI_Page::send_buffer();
 }
 
 //====================================== PRIVATE FUNCTIONS ====================================
 
+//draw everything that doesn't depend on the selection, and save it as the background layer
+//also works out where the icons ended up, so the selection highlight can be drawn over them
+void Main_Screen::render_background() {
+    //start by clearing the draw buffer
+    graphics_handle.clearBuffer();
+
+    //######################## SIGNAL "PIPE" RENDERING #####################
+    //simple box to draw a "signal input and output" shape behind all the icons
+    //shape will consist of a rectangular frame at the centerline of the icons, spanning across the width of the screen
+    //then a triangle designating the input and output
+
+    //draw the input triangle
+    static const u8g2_uint_t intri_height = 9;
+    static const u8g2_uint_t intri_width = 4;
+    static const u8g2_uint_t intri_x_start = 0;
+    static const u8g2_uint_t intri_x_end = intri_x_start + intri_width;
+    static const u8g2_uint_t intri_y_mid = graphics_handle.getHeight() - App_Constants::EFFECT_PADDING - ((App_Constants::EFFECT_ICON_HEIGHT + 1) >> 1);
+    static const u8g2_uint_t intri_y_start = intri_y_mid - ((intri_height + 1) >> 1);
+    static const u8g2_uint_t intri_y_end = intri_y_mid + ((intri_height + 1) >> 1);
+    graphics_handle.drawTriangle(   intri_x_start, intri_y_start,
+                                    intri_x_start, intri_y_end,
+                                    intri_x_end, intri_y_mid);
+
+    //draw the output triangle
+    static const u8g2_uint_t outtri_height = intri_height;
+    static const u8g2_uint_t outtri_width = intri_width;
+    static const u8g2_uint_t outtri_x_start = graphics_handle.getWidth() - outtri_width - 1;
+    static const u8g2_uint_t outtri_x_end = graphics_handle.getWidth();
+    static const u8g2_uint_t outtri_y_mid = intri_y_mid;
+    static const u8g2_uint_t outtri_y_start = intri_y_start;
+    static const u8g2_uint_t outtri_y_end = intri_y_end;
+    graphics_handle.drawTriangle(   outtri_x_start, outtri_y_start,
+                                    outtri_x_start, outtri_y_end,
+                                    outtri_x_end, outtri_y_mid);
+
+    //draw the rectangle going across the screen
+    static const u8g2_uint_t rect_width = graphics_handle.getWidth() - outtri_width;
+    static const u8g2_uint_t rect_height = 3;
+    static const u8g2_uint_t rect_x_start = 0;
+    static const u8g2_uint_t rect_y_start = graphics_handle.getHeight() - App_Constants::EFFECT_PADDING - ((App_Constants::EFFECT_ICON_HEIGHT + rect_height) >> 1);
+    graphics_handle.drawBox(rect_x_start, rect_y_start, rect_width, rect_height);
+
+
+    //######################## EFFECT ICON RENDERING #####################
+
+    //RENDER THE EFFECT ICONS --> start by computing some dimension constants
+    static const u8g2_uint_t total_icon_width = App_Constants::NUM_EFFECTS * 
+                                                (App_Constants::EFFECT_ICON_WIDTH + App_Constants::EFFECT_PADDING) - 
+                                                App_Constants::EFFECT_PADDING;
+    icon_start_x = (graphics_handle.getWidth() - total_icon_width) >> 1;
+    icon_start_y = (graphics_handle.getHeight() - App_Constants::EFFECT_ICON_HEIGHT - App_Constants::EFFECT_PADDING);
+
+    //now actually draw all the icons on the screen
+    u8g2_uint_t x_coord = icon_start_x;
+    for(auto& erc : ercs) {
+        graphics_handle.drawXBMP(   x_coord, icon_start_y, 
+                                    App_Constants::EFFECT_ICON_WIDTH, App_Constants::EFFECT_ICON_HEIGHT, erc.icon->data());
+        x_coord += App_Constants::EFFECT_ICON_WIDTH + App_Constants::EFFECT_PADDING;
+    }
+
+    //########################## SETTINGS ICON RENDERING #######################
+
+    //render an icon in the top right corner as "settings"
+    settings_x_start = graphics_handle.getWidth() - SETTINGS_ICON_WIDTH - SETTINGS_ICON_X_PADDING;
+    settings_y_start = SETTINGS_ICON_Y_PADDING;
+    graphics_handle.drawXBMP(   settings_x_start, settings_y_start,
+                                SETTINGS_ICON_WIDTH, SETTINGS_ICON_HEIGHT,
+                                settings_icon.data());
+
+    //########################## SAVE THE LAYER #######################
+
+    //keep a copy of the buffer; sized for our 128x64 panel, but don't overrun it if the buffer's somehow bigger
+    size_t buffer_bytes = 8 * graphics_handle.getBufferTileWidth() * graphics_handle.getBufferTileHeight();
+    background_bytes = min(buffer_bytes, background.size());
+    memcpy(background.data(), graphics_handle.getBufferPtr(), background_bytes);
+
+    background_chain_version = Effects_Manager::get_chain_version();
+    background_valid = true;
+}
+
+//copy as much of `text` as fits into `buf` starting at `pos`, keeping it null-terminated; returns the new length
+size_t Main_Screen::append_text(std::array<char, ACTIVE_EFFECTS_TEXT_MAX_CHARS + 1>& buf, size_t pos, App_String text) {
+    size_t len = min(text.size(), ACTIVE_EFFECTS_TEXT_MAX_CHARS - pos);
+    memcpy(buf.data() + pos, text.c_str(), len);
+    buf[pos + len] = '\0';
+    return pos + len;
+}
+
 //callback function when the main knob (final knob in array) is being rotated
 void Main_Screen::main_change_cb(void* context) {
     //get the pointer to the actual screen instance
@@ -41,6 +41,14 @@ private:
     //callback function when the main knob (final knob in array) is being rotated
     static void main_change_cb(void* context);
 
+    //draw the parts of the page that don't depend on the selection into `background`
+    void render_background();
+
+    //"nothing selected" text listing the active effects, built in a fixed buffer rather than heap strings
+    //as long as the scrolling text will keep; anything past that gets cut off
+    static constexpr size_t ACTIVE_EFFECTS_TEXT_MAX_CHARS = Scroll_String::MAX_TEXT_CHARS;
+    static size_t append_text(std::array<char, ACTIVE_EFFECTS_TEXT_MAX_CHARS + 1>& buf, size_t pos, App_String text);
+
     //create a structure that collects everything related to an effects channel as relevant to the UI
     //includes:
     //  - a pointer to the particular `Main_Page` instance to reference instance parameters
@@ -65,6 +73,9 @@ private:
         /* Hardware related fields  */
         RGB_LED* led;
         Rotary_Encoder* enc;
+        /* What we draw for the effect, cached so we don't go through the virtuals every frame */
+        const Effect_Icon_t* icon = nullptr; //points at the effect's static icon
+        RGB_LED::COLOR theme_color = RGB_LED::OFF;
 
         //implement a pseudo-constructor --> have to implement a default constructor if we want an array of these
         //technically possible to work witha non-default constructuro, but REALLY gross to implement --> this is the lesser of two evils 
@@ -83,12 +94,20 @@ private:
             this->to_quick_edit.set_to(&quick_edit_page);
             this->led = _led;   //save the LED to use
             this->enc = _enc;   //save the encoder to use
+            this->update_display_info(); //grab the icon and theme color
         
             //set the quick edit parameter and the theme color to use in the quick edit page
             //use the default quick edit parameter the effect initializes with
             //looks pretty gross since we got a pointer to a pointer (necessary evil)
             this->quick_edit_page.set_qe_param_color(   this->quick_edit_param, 
-                                                        effect->get()->get_theme_color());
+                                                        this->theme_color);
+        }
+
+        //re-read the icon and theme color from the effect
+        //cheap, but only needs to happen when the effect in this channel changes
+        void update_display_info() {
+            this->icon = &this->effect->get()->get_icon();
+            this->theme_color = this->effect->get()->get_theme_color();
         }
 
         //implement a way to update the struct after the effect gets updated
@@ -99,13 +118,14 @@ private:
             //useful in case location of effect in the heap has changed
             this->to_effect_edit.set_to(this->effect->get());
 
-            //update the retrieved quick edit parameter
+            //update the retrieved quick edit parameter, icon and theme color
             this->quick_edit_param = this->effect->get()->get_quick_edit_param();
+            this->update_display_info();
 
             //update the quick edit page with the new parameter and theme color as necessary
             //will ensure quick edit param is valid and updated, and theme color is updated
             this->quick_edit_page.set_qe_param_color(   this->quick_edit_param, 
-                                                        effect->get()->get_theme_color());
+                                                        this->theme_color);
         }
 
         //and a function to make an array of these for convenience
@@ -172,4 +192,18 @@ private:
     //and finally a little primitive to keep track of where we are when blending colors
     //animating the LED when hovering over the settings menu
     float blend_counter = 0;
+
+    //static layer of the page (signal pipe, effect icons, settings icon), pre-rendered in full frame buffer format
+    //redrawn only when the effect chain changes; every frame starts by copying it into the frame buffer
+    static constexpr size_t BACKGROUND_MAX_BYTES = 128 * 64 / 8;
+    std::array<uint8_t, BACKGROUND_MAX_BYTES> background;
+    size_t background_bytes = 0;
+    bool background_valid = false;
+    uint32_t background_chain_version = 0;
+
+    //where the background put the icons, for drawing the selection highlight over them
+    u8g2_uint_t icon_start_x = 0;
+    u8g2_uint_t icon_start_y = 0;
+    u8g2_uint_t settings_x_start = 0;
+    u8g2_uint_t settings_y_start = 0;
 };
\ No newline at end of file
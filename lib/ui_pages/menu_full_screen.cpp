@@ -10,7 +10,7 @@ Menu_Full_Screen::Menu_Full_Screen(size_t knob_led_index, UI_Page* _prev_page, U
 {}
 
 //setter method for the header text when we render our screen
-void Menu_Full_Screen::set_header_text(std::string _header_text) {
+void Menu_Full_Screen::set_header_text(App_String _header_text) {
     header_text = _header_text;
 }
 
@@ -102,5 +102,5 @@ void Menu_Full_Screen::menu_draw() {
 
     //############## RESTORE SETTINGS AND SEND BUFFER ##############
     graphics_handle.setMaxClipWindow();
-    graphics_handle.sendBuffer();
+    UI_Page::send_buffer();
 }
\ No newline at end of file
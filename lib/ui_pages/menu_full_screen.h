@@ -5,6 +5,7 @@
 #include <U8g2lib.h>
 
 #include <ui_menu_page.h> //inherit from here
+#include <utils.h> //for string handles
 
 class Menu_Full_Screen : public UI_Menu {
 public:
@@ -16,12 +17,13 @@ public:
     Menu_Full_Screen(size_t knob_led_index, UI_Page* _prev_page, UI_Menu_Item& _back_item);
 
     //set the header text at the top left of the menu
-    void set_header_text(std::string _header_text);
+    void set_header_text(App_String _header_text);
 
 private:
     //implement the draw function
     void menu_draw() override;
 
     //beyond what the base class stores, store some text to render as a header
-    std::string header_text;
+    //this is just a handle, so whatever it points to has to outlive the menu
+    App_String header_text;
 };
\ No newline at end of file
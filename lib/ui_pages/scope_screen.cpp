@@ -0,0 +1,154 @@
+#include <scope_screen.h>
+
+#include <math.h> //for log10f
+#include <stdio.h> //for snprintf
+
+//============================ STATIC MEMBER DEFINITIONS ========================
+
+const std::array<uint32_t, 4> Scope_Screen::TIMEBASES = {1, 2, 4, 8};
+
+//================================================ PUBLIC FUNCTIONS ============================================
+
+Scope_Screen::Scope_Screen(UI_Page* _prev_page):
+    to_prev_page(_prev_page)
+{}
+
+Scope_Screen::Scope_Screen():
+    Scope_Screen(nullptr)
+{}
+
+void Scope_Screen::set_prev_page(UI_Page* _prev_page) {
+    to_prev_page.set_to(_prev_page);
+}
+
+//======================================== OVERRIDEN DERIVED CLASS FUNCTIONS ===================================
+
+void Scope_Screen::impl_on_entry() {
+    has_capture = false;
+
+    //nothing to show on the LEDs
+    for(RGB_LED* led : leds)
+        led->set_color(RGB_LED::OFF);
+
+    //load the current settings into the encoders; any turn reads them all back
+    Context_Callback_Function<void> settings_cb(reinterpret_cast<void*>(this), settings_changed_cb);
+    encs[0]->set_max_counts(Audio_Tap::TAP_OUTPUT, tap_point);
+    encs[1]->set_max_counts(2 * (TRIGGER_STEPS - 1), trigger_step + (TRIGGER_STEPS - 1));
+    encs[2]->set_max_counts(TIMEBASES.size() - 1, timebase_index);
+    for(size_t i = 0; i < 3; i++)
+        encs[i]->attach_on_change(settings_cb);
+
+    //fourth encoder press toggles auto triggering, main encoder press takes us back
+    encs[3]->attach_on_press(Context_Callback_Function<void>(reinterpret_cast<void*>(this), toggle_auto_cb));
+    encs.back()->attach_on_press(to_prev_page);
+
+    rearm();
+}
+
+void Scope_Screen::impl_on_exit() {
+    //stop capturing
+    Audio_Tap::disarm_scope();
+
+    //detach our encoder callback functions
+    for(size_t i = 0; i < 3; i++)
+        encs[i]->attach_on_change({});
+    encs[3]->attach_on_press({});
+    encs.back()->attach_on_press({});
+}
+
+//called every `SCREEN_REDRAW_MS`
+void Scope_Screen::draw() {
+    //grab a finished capture if there is one and get the next one going
+    if(Audio_Tap::scope_capture_ready()) {
+        capture = Audio_Tap::get_scope_capture();
+        rearm();
+
+        has_capture = true;
+        capture_peak = 0;
+        for(int16_t s : capture) capture_peak = max(capture_peak, abs((int32_t)s));
+    }
+
+    graphics_handle.clearBuffer();
+
+    //############## HEADER AND UNDERBAR ##############
+
+    u8g2_uint_t text_height = graphics_handle.getAscent() - graphics_handle.getDescent();
+    graphics_handle.setFontPosTop();
+
+    //tap point, timebase, and trigger mode on the left
+    char header_text[20];
+    char tap_text[4];
+    if(tap_point == Audio_Tap::TAP_INPUT) snprintf(tap_text, sizeof(tap_text), "IN");
+    else if(tap_point == Audio_Tap::TAP_OUTPUT) snprintf(tap_text, sizeof(tap_text), "OUT");
+    else snprintf(tap_text, sizeof(tap_text), "S%u", (unsigned)tap_point);
+    snprintf(header_text, sizeof(header_text), "%s x%u %s", tap_text, (unsigned)TIMEBASES[timebase_index], auto_trigger ? "AUTO" : "NORM");
+    graphics_handle.drawStr(0, 0, header_text);
+
+    //peak of the capture on the right
+    if(has_capture) {
+        char peak_text[8];
+        if(capture_peak >= 32767) snprintf(peak_text, sizeof(peak_text), "CLIP");
+        else if(capture_peak == 0) snprintf(peak_text, sizeof(peak_text), "-inf");
+        else snprintf(peak_text, sizeof(peak_text), "%ddB", (int)floorf(20.0f * log10f(capture_peak / 32768.0f)));
+        graphics_handle.drawStr(graphics_handle.getDisplayWidth() - graphics_handle.getStrWidth(peak_text), 0, peak_text);
+    }
+    graphics_handle.setFontPosBaseline();
+    graphics_handle.drawHLine(0, text_height + 1, graphics_handle.getDisplayWidth());
+
+    //############## TRACE ##############
+
+    //trace area runs from under the header to the bottom of the screen, full scale at either end
+    const int32_t top = text_height + 3;
+    const int32_t span = graphics_handle.getDisplayHeight() - 1 - top;
+    auto sample_to_y = [top, span](int32_t s) { return top + ((32767 - s) * span) / 65535; };
+
+    //trigger level as a dotted line
+    int32_t trigger_y = sample_to_y(trigger_step * TRIGGER_STEP);
+    for(u8g2_uint_t x = 0; x < graphics_handle.getDisplayWidth(); x += 4)
+        graphics_handle.drawPixel(x, trigger_y);
+
+    //every column covers `TIMEBASES[timebase_index]` samples; draw a line between the extremes
+    //include the last sample of the previous column so the trace stays connected
+    if(has_capture) {
+        const size_t samples_per_px = TIMEBASES[timebase_index];
+        int16_t prev = capture[0];
+        for(u8g2_uint_t x = 0; x < graphics_handle.getDisplayWidth(); x++) {
+            int16_t lo = prev;
+            int16_t hi = prev;
+            for(size_t i = x * samples_per_px; i < (x + 1) * samples_per_px; i++) {
+                lo = min(lo, capture[i]);
+                hi = max(hi, capture[i]);
+            }
+            prev = capture[(x + 1) * samples_per_px - 1];
+
+            int32_t y_top = sample_to_y(hi);
+            graphics_handle.drawVLine(x, y_top, sample_to_y(lo) - y_top + 1);
+        }
+    }
+
+    UI_Page::send_buffer();
+
+    //live display, keep checking for new captures every frame while we're up
+    UI_Page::request_redraw();
+}
+
+//====================================== PRIVATE FUNCTIONS ====================================
+
+//settings take effect on the next capture
+void Scope_Screen::settings_changed_cb(void* context) {
+    Scope_Screen* s = reinterpret_cast<Scope_Screen*>(context);
+    s->tap_point = s->encs[0]->get_counts();
+    s->trigger_step = s->encs[1]->get_counts() - (TRIGGER_STEPS - 1);
+    s->timebase_index = s->encs[2]->get_counts();
+    s->rearm();
+}
+
+void Scope_Screen::toggle_auto_cb(void* context) {
+    Scope_Screen* s = reinterpret_cast<Scope_Screen*>(context);
+    s->auto_trigger = !s->auto_trigger;
+    s->rearm();
+}
+
+void Scope_Screen::rearm() {
+    Audio_Tap::arm_scope(tap_point, trigger_step * TRIGGER_STEP, auto_trigger);
+}
@@ -0,0 +1,69 @@
+#pragma once
+
+/*
+ * Oscilloscope page
+ *
+ * Audio update does the triggering and fills a preallocated capture buffer in `Audio_Tap`, then leaves it alone
+ *      \--> every redraw, this page checks whether a capture finished; if so it copies it out and re-arms straight away
+ *      \--> drawing only ever works from our own copy, so the trace holds steady between triggers
+ *
+ * Any buffer in the chain can be tapped: the input, the output of any slot, or the final output
+ * Top and bottom of the trace area are full scale, so anything flattened against them is clipping
+ * Header shows the tap point, timebase, trigger mode, and the peak level of the capture (or CLIP)
+ *
+ * Controls:
+ *      \--> first encoder picks the tap point
+ *      \--> second encoder sets the trigger level (dotted line)
+ *      \--> third encoder sets the timebase (samples per pixel)
+ *      \--> fourth encoder press switches between auto and normal triggering
+ *      \--> main encoder press returns to the previous page
+ */
+
+#include <array>
+#include <Arduino.h>
+
+#include <ui_page.h> //inherit from here
+#include <audio_tap.h> //triggered capture out of the audio update
+#include <config.h> //scope configuration
+
+class Scope_Screen : public UI_Page {
+public:
+    //pass in the page to return to when we're done
+    Scope_Screen(UI_Page* _prev_page);
+
+    //provide a default constructor too, set the return page later
+    Scope_Screen();
+    void set_prev_page(UI_Page* _prev_page);
+
+private:
+    //override all the `UI_page()` functions
+    void draw() override;
+    void impl_on_entry() override; //set up the encoders and arm the first capture
+    void impl_on_exit() override; //disarm the capture, detach the encoders
+
+    //read the settings back off the encoders and re-arm with them
+    static void settings_changed_cb(void* context);
+    static void toggle_auto_cb(void* context);
+    void rearm();
+
+    //trigger level steps in either direction from zero, each `TRIGGER_STEP` counts
+    static constexpr int32_t TRIGGER_STEPS = 16;
+    static constexpr int32_t TRIGGER_STEP = 32768 / TRIGGER_STEPS;
+
+    //timebases on offer, in samples per pixel; slowest one has to fit in the capture across the whole display
+    static const std::array<uint32_t, 4> TIMEBASES;
+
+    //last completed capture, and its peak magnitude
+    Audio_Tap::Scope_Buffer_t capture = {0};
+    bool has_capture = false;
+    int32_t capture_peak = 0;
+
+    //current settings
+    size_t tap_point = Audio_Tap::TAP_OUTPUT;
+    int32_t trigger_step = 0;
+    size_t timebase_index = 0;
+    bool auto_trigger = true;
+
+    //transition back to wherever we came from
+    Pg_Transition to_prev_page;
+};
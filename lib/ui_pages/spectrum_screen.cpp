@@ -0,0 +1,141 @@
+#include <spectrum_screen.h>
+
+#include <math.h> //for powf, lroundf
+
+#include <effect_dsp/fixed_log2.h> //bin power to dB
+
+//================================================ PUBLIC FUNCTIONS ============================================
+
+//build the window and work out which bins go into which bar
+Spectrum_Screen::Spectrum_Screen(UI_Page* _prev_page):
+    fft(FFT_SIZE),
+    to_prev_page(_prev_page)
+{
+    FFT_Q15::make_hann_window(window.data(), window.size());
+
+    //log-spaced bar edges, never below bin 1 (skip DC) or past the last bin
+    const float bin_hz = (float)App_Constants::AUDIO_SAMPLE_RATE_HZ / FFT_SIZE;
+    const float ratio = App_Constants::SPECTRUM_MAX_HZ / App_Constants::SPECTRUM_MIN_HZ;
+    for(size_t b = 0; b <= NUM_BARS; b++) {
+        float edge_hz = App_Constants::SPECTRUM_MIN_HZ * powf(ratio, (float)b / NUM_BARS);
+        bar_edges[b] = constrain(lroundf(edge_hz / bin_hz), 1L, (long)NUM_BINS);
+    }
+}
+
+Spectrum_Screen::Spectrum_Screen():
+    Spectrum_Screen(nullptr)
+{}
+
+void Spectrum_Screen::set_prev_page(UI_Page* _prev_page) {
+    to_prev_page.set_to(_prev_page);
+}
+
+//======================================== OVERRIDEN DERIVED CLASS FUNCTIONS ===================================
+
+void Spectrum_Screen::impl_on_entry() {
+    //start from a clean slate, and start pulling audio out of the audio update
+    frame.fill(0);
+    bar_heights.fill(0);
+    Audio_Tap::enable_spectrum_feed(true, tap_point);
+
+    //nothing to show on the LEDs
+    for(RGB_LED* led : leds)
+        led->set_color(RGB_LED::OFF);
+
+    //main encoder press takes us back, first encoder press switches the source
+    encs.back()->attach_on_press(to_prev_page);
+    encs[0]->attach_on_press(Context_Callback_Function<void>(reinterpret_cast<void*>(this), toggle_source_cb));
+}
+
+void Spectrum_Screen::impl_on_exit() {
+    //stop the feed
+    Audio_Tap::enable_spectrum_feed(false);
+
+    //detach our encoder callback functions
+    encs.back()->attach_on_press({});
+    encs[0]->attach_on_press({});
+}
+
+//called every `SCREEN_REDRAW_MS`
+void Spectrum_Screen::draw() {
+    analyze();
+
+    graphics_handle.clearBuffer();
+
+    //############## HEADER AND UNDERBAR ##############
+
+    u8g2_uint_t text_height = graphics_handle.getAscent() - graphics_handle.getDescent();
+    graphics_handle.setFontPosTop();
+    graphics_handle.drawStr(0, 0, "Spectrum");
+
+    //show which end of the chain we're looking at in the top right
+    const char* source_text = (tap_point == Audio_Tap::TAP_INPUT) ? "IN" : "OUT";
+    graphics_handle.drawStr(graphics_handle.getDisplayWidth() - graphics_handle.getStrWidth(source_text), 0, source_text);
+    graphics_handle.setFontPosBaseline();
+    graphics_handle.drawHLine(0, text_height + 1, graphics_handle.getDisplayWidth());
+
+    //############## BARS ##############
+
+    //bars grow up from the bottom of the screen, 1 pixel wide with a 1 pixel gap
+    const u8g2_uint_t bottom = graphics_handle.getDisplayHeight();
+    for(size_t b = 0; b < NUM_BARS; b++)
+        if(bar_heights[b] > 0)
+            graphics_handle.drawVLine(b * BAR_PITCH, bottom - bar_heights[b], bar_heights[b]);
+
+    UI_Page::send_buffer();
+
+    //live display, analyze and redraw every frame while we're up
+    UI_Page::request_redraw();
+}
+
+//====================================== PRIVATE FUNCTIONS ====================================
+
+void Spectrum_Screen::analyze() {
+    //slide the frame along by however many new samples we have
+    //if we've got more than a whole frame, only the newest frame's worth matters
+    Audio_Tap::Spectrum_Ring_t& ring = Audio_Tap::get_spectrum_ring();
+    size_t new_samples = ring.available();
+    if(new_samples >= frame.size()) {
+        ring.discard(new_samples - frame.size());
+        ring.pop(frame.data(), frame.size());
+    }
+    else if(new_samples > 0) {
+        std::copy(frame.begin() + new_samples, frame.end(), frame.begin());
+        ring.pop(frame.data() + frame.size() - new_samples, new_samples);
+    }
+
+    //window the frame into the real parts of the transform buffer, transform, and get the power in every bin
+    for(size_t i = 0; i < FFT_SIZE; i++) {
+        fft_buffer[2 * i] = (int16_t)(((int32_t)frame[i] * window[i]) >> 15);
+        fft_buffer[2 * i + 1] = 0;
+    }
+    fft.transform(fft_buffer.data());
+    FFT_Q15::magnitude_squared(fft_buffer.data(), power.data(), NUM_BINS);
+
+    //map [-SPECTRUM_RANGE_DB, 0] dBFS onto the space under the header
+    //bin power is a squared magnitude, so one log2 unit of it is ~3.01dB
+    static const int32_t RANGE_LOG2_Q16 = Fixed_Log2::db_to_log2_q16(App_Constants::SPECTRUM_RANGE_DB) * 2;
+    const int32_t max_height = graphics_handle.getDisplayHeight() - (graphics_handle.getAscent() - graphics_handle.getDescent()) - 3;
+
+    for(size_t b = 0; b < NUM_BARS; b++) {
+        //loudest bin in the bar; at the low end bars are narrower than a bin, so they just show the bin they sit in
+        size_t first = min(bar_edges[b], (uint16_t)(NUM_BINS - 1));
+        size_t last = max(bar_edges[b + 1], (uint16_t)(first + 1));
+        uint32_t peak = 0;
+        for(size_t i = first; i < last; i++) peak = max(peak, power[i]);
+
+        //level relative to full scale --> pixels
+        int32_t level = Fixed_Log2::log2_q16(peak) - (FULL_SCALE_POWER_LOG2 << 16) + RANGE_LOG2_Q16;
+        int32_t height = constrain((int32_t)(((int64_t)level * max_height) / RANGE_LOG2_Q16), (int32_t)0, max_height);
+
+        //jump up straight away, fall back slowly
+        bar_heights[b] = max(height, bar_heights[b] - BAR_FALL_PX);
+    }
+}
+
+//retarget the feed straight away; the frame will have a seam in it for one redraw
+void Spectrum_Screen::toggle_source_cb(void* context) {
+    Spectrum_Screen* s = reinterpret_cast<Spectrum_Screen*>(context);
+    s->tap_point = (s->tap_point == Audio_Tap::TAP_INPUT) ? Audio_Tap::TAP_OUTPUT : Audio_Tap::TAP_INPUT;
+    Audio_Tap::enable_spectrum_feed(true, s->tap_point);
+}
@@ -0,0 +1,81 @@
+#pragma once
+
+/*
+ * Spectrum analyzer page
+ *
+ * Audio update only copies blocks from the selected point in the chain into `Audio_Tap`'s spectrum ring
+ *      \--> every redraw, this page takes the newest `SPECTRUM_FFT_SIZE` samples, applies a Hann window, and runs a fixed-point FFT
+ *      \--> bins are grouped into `NUM_BARS` log-spaced bars (loudest bin in each bar wins), converted to dB with the table-based log
+ *      \--> all of this runs from `loop()` at the display rate, never in interrupt context
+ *
+ * Bars jump up instantly and fall back at a limited rate so they're readable
+ * Top of the display is a full-scale sine, bottom is `SPECTRUM_RANGE_DB` below that
+ *
+ * Controls:
+ *      \--> main encoder press returns to the previous page
+ *      \--> first encoder press switches between the chain input and the chain output
+ */
+
+#include <array>
+#include <Arduino.h>
+
+#include <ui_page.h> //inherit from here
+#include <audio_tap.h> //full-rate feed out of the audio update
+#include <effect_dsp/fft_q15.h> //fixed-point FFT
+#include <config.h> //spectrum configuration
+
+class Spectrum_Screen : public UI_Page {
+public:
+    //pass in the page to return to when we're done
+    Spectrum_Screen(UI_Page* _prev_page);
+
+    //provide a default constructor too, set the return page later
+    Spectrum_Screen();
+    void set_prev_page(UI_Page* _prev_page);
+
+private:
+    //override all the `UI_page()` functions
+    void draw() override;
+    void impl_on_entry() override; //start the spectrum feed, set up the encoders
+    void impl_on_exit() override; //stop the spectrum feed
+
+    //pull the newest samples out of the ring, transform them, and update the bar heights
+    void analyze();
+
+    //switch between tapping the input and the output
+    static void toggle_source_cb(void* context);
+
+    //one bar every 2 pixels across the display
+    static constexpr size_t NUM_BARS = 64;
+    static constexpr size_t BAR_PITCH = 2;
+
+    //how many pixels a bar can drop per redraw
+    static constexpr int32_t BAR_FALL_PX = 2;
+
+    //log2 of the bin power for a full-scale sine through the Hann window (amplitude * 1/2 window gain * 1/2 real-signal split)^2
+    static constexpr int32_t FULL_SCALE_POWER_LOG2 = 26;
+
+    static constexpr size_t FFT_SIZE = App_Constants::SPECTRUM_FFT_SIZE;
+    static constexpr size_t NUM_BINS = FFT_SIZE / 2;
+
+    //transform + window, and the newest frame of samples
+    FFT_Q15 fft;
+    std::array<int16_t, FFT_SIZE> window;
+    std::array<int16_t, FFT_SIZE> frame = {0};
+
+    //scratch space for the transform (interleaved complex) and the bin powers
+    std::array<int16_t, FFT_SIZE * 2> fft_buffer;
+    std::array<uint32_t, NUM_BINS> power;
+
+    //first bin of every bar (plus one past the end of the last bar), worked out once in the constructor
+    std::array<uint16_t, NUM_BARS + 1> bar_edges;
+
+    //bar heights in pixels, as of the last redraw
+    std::array<int32_t, NUM_BARS> bar_heights = {0};
+
+    //which point in the chain we're looking at
+    size_t tap_point = Audio_Tap::TAP_OUTPUT;
+
+    //transition back to wherever we came from
+    Pg_Transition to_prev_page;
+};
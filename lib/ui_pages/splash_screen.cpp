@@ -138,10 +138,10 @@ void Splash_Screen::draw() {
     static const uint32_t x_loc = (graphics_handle.getWidth() - splash_image_width) >> 1;
     static const uint32_t y_loc = (graphics_handle.getHeight() - splash_image_height) >> 1;
 
-    //canonical `clearBuffer --> stuff --> sendBuffer` routine with graphics
+    //canonical `clearBuffer --> stuff --> send_buffer` routine with graphics
     graphics_handle.clearBuffer();
     graphics_handle.drawXBMP(x_loc, y_loc, splash_image_width, splash_image_height, splash_image.data());
-    graphics_handle.sendBuffer();
+    UI_Page::send_buffer();
 }
 
 //=================================== PRIVATE FUNCTION DEFS =================================
@@ -0,0 +1,205 @@
+#include <tuner_screen.h>
+
+#include <math.h> //for log2f, roundf
+#include <stdio.h> //for snprintf
+
+#include <audio_tap.h> //decimated input feed
+#include <audio_out_mqs.h> //to mute the output
+#include <app_strings.h> //for the header and mute text
+
+//============================ STATIC MEMBER DEFINITIONS ========================
+
+const std::array<const char*, 12> Tuner_Screen::NOTE_NAMES = {
+    "C", "C#", "D", "D#", "E", "F", "F#", "G", "G#", "A", "A#", "B"
+};
+
+//================================================ PUBLIC FUNCTIONS ============================================
+
+Tuner_Screen::Tuner_Screen(UI_Page* _prev_page):
+    detector(Audio_Tap::TUNER_SAMPLE_RATE_HZ, MIN_PITCH_HZ, MAX_PITCH_HZ),
+    to_prev_page(_prev_page)
+{}
+
+Tuner_Screen::Tuner_Screen():
+    Tuner_Screen(nullptr)
+{}
+
+void Tuner_Screen::set_prev_page(UI_Page* _prev_page) {
+    to_prev_page.set_to(_prev_page);
+}
+
+//======================================== OVERRIDEN DERIVED CLASS FUNCTIONS ===================================
+
+void Tuner_Screen::impl_on_entry() {
+    //start from a clean slate
+    frame.fill(0);
+    has_pitch = false;
+    hold_remaining = 0;
+
+    //start pulling the decimated input out of the audio update, and run the detector periodically
+    Audio_Tap::enable_tuner_feed(true);
+    detect_sched.schedule_interval_ms(Context_Callback_Function<void>(reinterpret_cast<void*>(this), detect_cb),
+                                        App_Constants::TUNER_DETECT_MS);
+
+    //mute the output if we're configured to
+    Audio_Out_MQS::set_mute(mute);
+
+    //start with all the LEDs off, they'll get lit once we detect something
+    for(RGB_LED* led : leds)
+        led->set_color(RGB_LED::OFF);
+
+    //main encoder press takes us back, first encoder press toggles the mute
+    encs.back()->attach_on_press(to_prev_page);
+    encs[0]->attach_on_press(Context_Callback_Function<void>(reinterpret_cast<void*>(this), toggle_mute_cb));
+}
+
+void Tuner_Screen::impl_on_exit() {
+    //stop the feed and the detector, and let audio back through
+    Audio_Tap::enable_tuner_feed(false);
+    detect_sched.deschedule();
+    Audio_Out_MQS::set_mute(false);
+
+    //turn off all of our LEDs
+    for(RGB_LED* led : leds)
+        led->set_color(RGB_LED::OFF);
+
+    //detach our encoder callback functions
+    encs.back()->attach_on_press({});
+    encs[0]->attach_on_press({});
+}
+
+//called when a redraw has been requested, at most every `SCREEN_REDRAW_MS`
+void Tuner_Screen::draw() {
+    graphics_handle.clearBuffer();
+
+    //############## HEADER AND UNDERBAR ##############
+
+    u8g2_uint_t text_height = graphics_handle.getAscent() - graphics_handle.getDescent();
+    graphics_handle.setFontPosTop();
+    graphics_handle.drawStr(0, 0, App_Strings::TUNER_HEADER.c_str());
+
+    //show whether we're muted in the top right
+    if(mute) {
+        const char* mute_text = App_Strings::TUNER_MUTE.c_str();
+        graphics_handle.drawStr(graphics_handle.getDisplayWidth() - graphics_handle.getStrWidth(mute_text), 0, mute_text);
+    }
+    graphics_handle.setFontPosBaseline();
+    graphics_handle.drawHLine(0, text_height + 1, graphics_handle.getDisplayWidth());
+
+    //############## NOTE NAME ##############
+
+    //draw the note name in a big font in the center of the screen, with the octave just after it in the small font
+    static const u8g2_uint_t NOTE_Y = 42;
+    const u8g2_uint_t center_x = graphics_handle.getDisplayWidth() >> 1;
+    graphics_handle.setFont(u8g2_font_logisoso24_tr);
+    if(has_pitch) {
+        const char* name = NOTE_NAMES[note % 12];
+        u8g2_uint_t name_width = graphics_handle.getStrWidth(name);
+        graphics_handle.drawStr(center_x - (name_width >> 1), NOTE_Y, name);
+
+        char octave_text[4];
+        snprintf(octave_text, sizeof(octave_text), "%d", (int)(note / 12) - 1);
+        apply_font_small_params();
+        graphics_handle.drawStr(center_x + (name_width >> 1) + 2, NOTE_Y, octave_text);
+    }
+    else {
+        const char* no_pitch_text = App_Strings::TUNER_NO_PITCH.c_str();
+        graphics_handle.drawStr(center_x - (graphics_handle.getStrWidth(no_pitch_text) >> 1), NOTE_Y, no_pitch_text);
+    }
+
+    //frequency and cents in the bottom corners
+    apply_font_small_params();
+    if(has_pitch) {
+        char freq_text[12];
+        char cents_text[8];
+        snprintf(freq_text, sizeof(freq_text), "%.1fHz", frequency);
+        snprintf(cents_text, sizeof(cents_text), "%+dc", (int)roundf(cents));
+        graphics_handle.drawStr(0, graphics_handle.getDisplayHeight() - 1, freq_text);
+        graphics_handle.drawStr(graphics_handle.getDisplayWidth() - graphics_handle.getStrWidth(cents_text),
+                                graphics_handle.getDisplayHeight() - 1, cents_text);
+    }
+    restore_font_default();
+
+    //############## CENTS METER ##############
+
+    //ticks every 10 cents across +/-50 cents, with a longer tick in the center
+    static const u8g2_uint_t METER_Y = 50;
+    static const u8g2_uint_t METER_HALF_WIDTH = 50;
+    graphics_handle.drawHLine(center_x - METER_HALF_WIDTH, METER_Y, (METER_HALF_WIDTH << 1) + 1);
+    for(int32_t tick = -5; tick <= 5; tick++)
+        graphics_handle.drawVLine(center_x + tick * (METER_HALF_WIDTH / 5), METER_Y - 2, 2);
+    graphics_handle.drawVLine(center_x, METER_Y - 4, 4);
+
+    //needle is a small box under the meter
+    if(has_pitch) {
+        int32_t needle_x = center_x + (int32_t)(cents * METER_HALF_WIDTH / 50.0f);
+        graphics_handle.drawBox(needle_x - 1, METER_Y + 1, 3, 4);
+    }
+
+    UI_Page::send_buffer();
+}
+
+//====================================== PRIVATE FUNCTIONS ====================================
+
+//runs from `loop()` every `TUNER_DETECT_MS`
+void Tuner_Screen::detect() {
+    //slide the frame along by however many new samples we have
+    //if we've got more than a whole frame, only the newest frame's worth matters
+    Audio_Tap::Tuner_Ring_t& ring = Audio_Tap::get_tuner_ring();
+    size_t new_samples = ring.available();
+    if(new_samples == 0) return;
+
+    if(new_samples >= frame.size()) {
+        ring.discard(new_samples - frame.size());
+        ring.pop(frame.data(), frame.size());
+    }
+    else {
+        std::copy(frame.begin() + new_samples, frame.end(), frame.begin());
+        ring.pop(frame.data() + frame.size() - new_samples, new_samples);
+    }
+
+    //run the detector, hold onto the last reading for a little bit if we lose the signal
+    float detected = detector.detect(frame);
+    UI_Page::request_redraw(); //new reading (or lack of one) to show
+    if(detected == 0) {
+        if(hold_remaining > 0) hold_remaining--;
+        else has_pitch = false;
+        update_leds();
+        return;
+    }
+
+    //convert to the nearest note and how far off we are from it
+    float midi_note = 69.0f + 12.0f * log2f(detected / App_Constants::TUNER_REFERENCE_HZ);
+    note = max((int32_t)lroundf(midi_note), (int32_t)0);
+    cents = (midi_note - note) * 100.0f;
+    frequency = detected;
+    has_pitch = true;
+    hold_remaining = HOLD_DETECTIONS;
+    update_leds();
+}
+
+//flip the mute and apply it straight away
+void Tuner_Screen::toggle_mute_cb(void* context) {
+    Tuner_Screen* s = reinterpret_cast<Tuner_Screen*>(context);
+    s->mute = !s->mute;
+    Audio_Out_MQS::set_mute(s->mute);
+    UI_Page::request_redraw(); //mute indicator changed
+}
+
+//flat --> left LEDs, sharp --> right LEDs, in tune --> main LED green
+void Tuner_Screen::update_leds() {
+    for(RGB_LED* led : leds)
+        led->set_color(RGB_LED::OFF);
+    if(!has_pitch) return;
+
+    if(fabsf(cents) <= App_Constants::TUNER_IN_TUNE_CENTS)
+        leds.back()->set_color(RGB_LED::GREEN, App_Constants::UI_LED_LEVEL_BRIGHT);
+    else if(cents < -FAR_CENTS)
+        leds[0]->set_color(RGB_LED::RED, App_Constants::UI_LED_LEVEL_BRIGHT);
+    else if(cents < 0)
+        leds[1]->set_color(RGB_LED::ORANGE, App_Constants::UI_LED_LEVEL_BRIGHT);
+    else if(cents <= FAR_CENTS)
+        leds[2]->set_color(RGB_LED::ORANGE, App_Constants::UI_LED_LEVEL_BRIGHT);
+    else
+        leds[3]->set_color(RGB_LED::RED, App_Constants::UI_LED_LEVEL_BRIGHT);
+}
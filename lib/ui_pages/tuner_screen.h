@@ -0,0 +1,83 @@
+#pragma once
+
+/*
+ * Chromatic tuner page
+ *
+ * Audio update only pushes a decimated copy of the input into `Audio_Tap`'s tuner ring
+ *      \--> this page drains the ring and runs a YIN pitch detector from `loop()` every `TUNER_DETECT_MS`
+ *      \--> detection never runs in interrupt context, so it never costs the audio update anything
+ *
+ * Display shows the nearest note, its octave, and a cents meter
+ * RGB LEDs double as a flat/sharp indicator:
+ *      \--> left two LEDs light up when flat (outer one when way flat), right two when sharp
+ *      \--> main LED goes green when in tune
+ *
+ * Controls:
+ *      \--> main encoder press returns to the previous page
+ *      \--> first encoder press toggles the output mute
+ */
+
+#include <array>
+#include <Arduino.h>
+
+#include <ui_page.h> //inherit from here
+#include <scheduler.h> //to run pitch detection periodically
+#include <effect_dsp/pitch_detector.h> //YIN pitch detector
+#include <config.h> //tuner configuration
+
+class Tuner_Screen : public UI_Page {
+public:
+    //pass in the page to return to when we're done tuning
+    Tuner_Screen(UI_Page* _prev_page);
+
+    //provide a default constructor too, set the return page later
+    Tuner_Screen();
+    void set_prev_page(UI_Page* _prev_page);
+
+private:
+    //override all the `UI_page()` functions
+    void draw() override;
+    void impl_on_entry() override; //start the tuner feed, set up the encoders
+    void impl_on_exit() override; //stop the tuner feed, unmute, turn off LEDs
+
+    //pull whatever's in the tuner ring into our frame and run the pitch detector
+    void detect();
+    static inline void detect_cb(void* context) { reinterpret_cast<Tuner_Screen*>(context)->detect(); }
+
+    //flip the output mute
+    static void toggle_mute_cb(void* context);
+
+    //light the LEDs according to how far off we are
+    void update_leds();
+
+    //pitch range we'll look for --> low B on a 5-string bass up to the top of a guitar neck
+    static constexpr float MIN_PITCH_HZ = 30.0f;
+    static constexpr float MAX_PITCH_HZ = 1500.0f;
+
+    //beyond this many cents is "way off" (outer LEDs)
+    static constexpr float FAR_CENTS = 20.0f;
+
+    //keep showing the last note for this many detections after the signal drops out
+    static constexpr uint32_t HOLD_DETECTIONS = 10;
+
+    //names of the notes, starting from C
+    static const std::array<const char*, 12> NOTE_NAMES;
+
+    //pitch detector, and the most recent frame of decimated input
+    Pitch_Detector detector;
+    Pitch_Detector::Frame_t frame = {0};
+    Scheduler detect_sched;
+
+    //last reading
+    bool has_pitch = false;
+    uint32_t hold_remaining = 0;
+    float frequency = 0;
+    int32_t note = 0; //MIDI note number
+    float cents = 0;
+
+    //whether the output is muted while we're tuning
+    bool mute = App_Constants::TUNER_MUTE_DEFAULT;
+
+    //transition back to wherever we came from
+    Pg_Transition to_prev_page;
+};
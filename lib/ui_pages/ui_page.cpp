@@ -11,6 +11,9 @@ Scheduler UI_Page::draw_sched;
 //will be initialized on entry into the UI system, don't need to worry too much about nullptr
 UI_Page* UI_Page::active_page = nullptr;
 
+//new pages always get drawn at least once
+volatile bool UI_Page::redraw_requested = true;
+
 //========================= PUBLIC FUNCTIONS ========================
 
 //function that gets called when this page is loaded
@@ -19,6 +22,9 @@ void UI_Page::on_entry() {
     //we're the active page now
     active_page = this;
 
+    //new page, so whatever's on screen is out of date
+    request_redraw();
+
     //call the draw function at the rate specified by the app configuration
     draw_sched.schedule_interval_ms(    Context_Callback_Function<void>(reinterpret_cast<void*>(this), draw_cb),
                                         App_Constants::SCREEN_REDRAW_MS);
@@ -35,4 +41,17 @@ void UI_Page::on_exit() {
 
     //run the child's implementation of `on_exit()`
     this->impl_on_exit();        
-}
\ No newline at end of file
+}
+
+//send whatever changed as one background transfer
+size_t UI_Page::send_buffer() {
+    //waits for the previous frame to finish, so any error it ran into has been flagged by now
+    Display_I2C::begin_frame();
+
+    //a transfer got abandoned, so we don't know what made it onto the screen; resend all of it
+    if(Display_I2C::check_and_clear_error()) Frame_Diff::invalidate();
+
+    size_t sent = Frame_Diff::send(graphics_handle);
+    Display_I2C::end_frame();
+    return sent;
+}
@@ -16,6 +16,8 @@
 #include <encoder.h> //for rotary encoder type
 #include <rgb.h> //for RGB LED type
 
+#include <ui_page_helpers/frame_diff.h> //only send the parts of the screen that changed
+#include <display_i2c.h> //non-blocking display transfers
 #include <utils.h> //callback function for transition class
 #include <scheduler.h> //to call the draw function
 #include <config.h>
@@ -45,6 +47,16 @@ public:
     static inline void restore_font_default() { graphics_handle.setFont(DEFAULT_FONT); }
     static inline void apply_font_small_params() { graphics_handle.setFont(SMALL_FONT); }
 
+    //mark the screen as needing a redraw; the active page's `draw()` runs on the next redraw tick
+    //call this whenever something on screen changes (encoder moves, parameter changes, text scrolls, new meter readings)
+    //animations just call it again from `draw()` to get their next frame; safe to call from interrupts
+    static inline void request_redraw() { redraw_requested = true; }
+
+    //push the frame buffer out to the display; use this instead of `sendBuffer()`
+    //only the tiles that changed since the last frame actually go out over I2C, and they go out in the background
+    //the frame buffer is free to draw into again as soon as this returns
+    static size_t send_buffer();
+
 //children can use the graphics handle too
 protected:
     //function called to render the particular UI page
@@ -58,7 +70,12 @@ protected:
     
 
     //static callback function to forward to the instance `draw()` function
-    static inline void draw_cb(void* context) { reinterpret_cast<UI_Page*>(context)->draw(); }
+    //only draws if something asked for a redraw since last time; clear the flag first so `draw()` can ask again
+    static inline void draw_cb(void* context) {
+        if(!redraw_requested) return;
+        redraw_requested = false;
+        reinterpret_cast<UI_Page*>(context)->draw();
+    }
 
     //graphics handle, LEDs, and rotary encoder instances will be shared across all pages
     //will be initialized before any UI code executes
@@ -73,7 +90,9 @@ private:
 
     //own a scheduler that calls `draw()` at the application configured frame rate
     //only the base class should be able to touch this
+    //acts as the frame rate limit --> nothing gets drawn unless a redraw has been requested
     static Scheduler draw_sched;
+    static volatile bool redraw_requested;
 
     //define a default font to use for rendering menu headers and text and such
     static const uint8_t* DEFAULT_FONT;
@@ -0,0 +1,72 @@
+#include <ui_page_helpers/frame_diff.h>
+
+#include <string.h> //memcmp, memcpy
+
+//========================= STATIC VARIABLE DEFINITION ========================
+
+std::array<uint8_t, Frame_Diff::MAX_BUFFER_BYTES> Frame_Diff::shadow;
+bool Frame_Diff::shadow_valid = false; //don't know what's on the display at power up
+
+size_t Frame_Diff::last_bytes = 0;
+size_t Frame_Diff::peak_bytes = 0;
+uint32_t Frame_Diff::total_bytes = 0;
+uint32_t Frame_Diff::frame_count = 0;
+
+//========================= PUBLIC FUNCTIONS ========================
+
+size_t Frame_Diff::send(U8G2& graphics_handle) {
+    const size_t tile_cols = graphics_handle.getBufferTileWidth();
+    const size_t tile_rows = graphics_handle.getBufferTileHeight();
+    const size_t row_bytes = tile_cols * BYTES_PER_TILE;
+    const size_t buffer_bytes = row_bytes * tile_rows;
+
+    size_t sent = 0;
+    if(!shadow_valid || buffer_bytes > MAX_BUFFER_BYTES) sent = send_full(graphics_handle, buffer_bytes);
+    else {
+        const uint8_t* frame = graphics_handle.getBufferPtr();
+        for(size_t row = 0; row < tile_rows; row++) {
+            const uint8_t* frame_row = frame + row * row_bytes;
+            uint8_t* shadow_row = shadow.data() + row * row_bytes;
+
+            //find the first and last tile in this row that changed
+            size_t first = tile_cols;
+            size_t last = 0;
+            for(size_t col = 0; col < tile_cols; col++) {
+                if(memcmp(frame_row + col * BYTES_PER_TILE, shadow_row + col * BYTES_PER_TILE, BYTES_PER_TILE) == 0) continue;
+                if(first == tile_cols) first = col;
+                last = col;
+            }
+            if(first == tile_cols) continue; //whole row matches
+
+            //send the changed span and remember it
+            size_t span = last - first + 1;
+            graphics_handle.updateDisplayArea(first, row, span, 1);
+            memcpy(shadow_row + first * BYTES_PER_TILE, frame_row + first * BYTES_PER_TILE, span * BYTES_PER_TILE);
+            sent += span * BYTES_PER_TILE;
+        }
+    }
+
+    //update the stats
+    last_bytes = sent;
+    if(sent > peak_bytes) peak_bytes = sent;
+    total_bytes += sent;
+    frame_count++;
+    return sent;
+}
+
+void Frame_Diff::reset_stats() {
+    peak_bytes = 0;
+    total_bytes = 0;
+    frame_count = 0;
+}
+
+//========================= PRIVATE FUNCTIONS ========================
+
+size_t Frame_Diff::send_full(U8G2& graphics_handle, size_t buffer_bytes) {
+    graphics_handle.sendBuffer();
+
+    //only trust the copy if the whole frame fit in it
+    shadow_valid = buffer_bytes <= MAX_BUFFER_BYTES;
+    if(shadow_valid) memcpy(shadow.data(), graphics_handle.getBufferPtr(), buffer_bytes);
+    return buffer_bytes;
+}
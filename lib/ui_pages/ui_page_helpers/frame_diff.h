@@ -0,0 +1,63 @@
+#pragma once
+
+/*
+ * Sends only the parts of the frame buffer that changed since the last frame went out
+ * `sendBuffer()` pushes the whole 1KB frame over I2C every redraw, even when a knob turn only moved one parameter bar
+ *      \--> keeps a copy of what the display is currently showing (i.e. the last frame we sent)
+ *      \--> compares the new frame against it one 8x8 tile at a time (8 bytes; each byte is a column of 8 pixels)
+ *      \--> per tile row, sends the span from the first to the last changed tile with `updateDisplayArea()`
+ *              \--> one transfer per row keeps the I2C transaction overhead down; a few unchanged tiles in the middle are cheaper to resend
+ *      \--> nothing changed --> nothing sent
+ *
+ * Also keeps count of how many bytes went out, so we can see what the display is costing us
+ *
+ * NOTE: assumes the display only ever gets written through here; call `invalidate()` if something else draws to it
+ *       (e.g. after `begin()` or waking the display) so the next frame gets sent in full
+ *
+ * Intention is to use this class statically, i.e. don't instantiate it
+ */
+
+#include <array>
+#include <Arduino.h>
+#include <U8g2lib.h>
+
+class Frame_Diff {
+public:
+    //prevent all flavors of making an instance of one of these
+    Frame_Diff() = delete;
+    Frame_Diff(const Frame_Diff& other) = delete;
+    void operator=(const Frame_Diff& other) = delete;
+
+    //largest frame buffer we'll keep a copy of (128x64 monochrome)
+    //bigger displays just fall back to sending the whole buffer
+    static constexpr size_t MAX_BUFFER_BYTES = 1024;
+    static constexpr size_t BYTES_PER_TILE = 8;
+
+    //send whatever changed in `graphics_handle`'s buffer since the last call
+    //returns how many bytes of pixel data went out
+    static size_t send(U8G2& graphics_handle);
+
+    //forget what's on the display; the next `send()` pushes the whole frame
+    static inline void invalidate() { shadow_valid = false; }
+
+    //traffic stats: pixel bytes in the last frame, the most in any frame, and the running totals
+    //`reset_stats()` clears the peak and totals (e.g. after reporting them)
+    static inline size_t get_last_bytes() { return last_bytes; }
+    static inline size_t get_peak_bytes() { return peak_bytes; }
+    static inline uint32_t get_total_bytes() { return total_bytes; }
+    static inline uint32_t get_frame_count() { return frame_count; }
+    static void reset_stats();
+
+private:
+    //what the display is showing right now
+    static std::array<uint8_t, MAX_BUFFER_BYTES> shadow;
+    static bool shadow_valid;
+
+    static size_t last_bytes;
+    static size_t peak_bytes;
+    static uint32_t total_bytes;
+    static uint32_t frame_count;
+
+    //whole buffer out in one go, and remember it
+    static size_t send_full(U8G2& graphics_handle, size_t buffer_bytes);
+};
@@ -1,17 +1,29 @@
 
 #include "scroll_string.h"
 
+#include <string.h> //memcpy, memset
+
+//scratch space for rasterizing, and the strip itself, shared by everyone
+std::array<uint8_t, Scroll_String::RASTERIZE_SCRATCH_BYTES> Scroll_String::rasterize_scratch;
+std::array<uint8_t, Scroll_String::MAX_STRIP_WIDTH * Scroll_String::MAX_STRIP_PAGES> Scroll_String::strip;
+Scroll_String* Scroll_String::strip_owner = nullptr;
+u8g2_uint_t Scroll_String::strip_width = 0;
+size_t Scroll_String::strip_pages = 0;
+int32_t Scroll_String::strip_above_baseline = 0;
+bool Scroll_String::strip_attempted = false;
+bool Scroll_String::strip_valid = false;
+
 //default constructor does nothing
 Scroll_String::Scroll_String() {}
 
 //initialize the object with specific render text
-Scroll_String::Scroll_String(std::string _text_to_render) 
+Scroll_String::Scroll_String(App_String _text_to_render) 
 {
     set_render_text(_text_to_render);
 }
 
 //initialize the object with render text AND a position on the screen
-Scroll_String::Scroll_String(   std::string _text_to_render, 
+Scroll_String::Scroll_String(   App_String _text_to_render, 
                                 u8g2_uint_t _top_y, 
                                 u8g2_uint_t _bottom_y, 
                                 u8g2_uint_t _left_x, 
@@ -21,9 +33,21 @@ Scroll_String::Scroll_String(   std::string _text_to_render,
     set_bounding_box(_top_y, bottom_y, _left_x, _right_x);
 }
 
-//just save the passed text into the member variable
-void Scroll_String::set_render_text(std::string _text_to_render) {
-    text_to_render = _text_to_render;
+Scroll_String::~Scroll_String() {
+    if(strip_owner == this) strip_owner = nullptr;
+}
+
+//copy the passed text into our buffer (cutting it off if it's too long)
+//and have the next render measure it again (and rasterize it, if we have the strip)
+void Scroll_String::set_render_text(App_String _text_to_render) {
+    size_t len = min(_text_to_render.size(), MAX_TEXT_CHARS);
+    if(App_String(_text_to_render.c_str(), len) == App_String(text_to_render.data(), text_len)) return;
+    memcpy(text_to_render.data(), _text_to_render.c_str(), len);
+    text_to_render[len] = '\0';
+    text_len = len;
+
+    prepared_font = nullptr;
+    if(strip_owner == this) strip_attempted = false;
 }
 
 //just save the coordinates in to the local variables
@@ -51,6 +75,13 @@ void Scroll_String::start(bool _enable_scrolling) {
     //and reactivate the scheduler that sets this flag
     do_scroll = false;
     enable_scrolling = _enable_scrolling;
+
+    //we're the focused text now --> take over the strip
+    if(strip_owner != this) {
+        strip_owner = this;
+        strip_attempted = false;
+    }
+
     scroll_sched.schedule_oneshot_ms(   Context_Callback_Function<void>(reinterpret_cast<void*>(this), do_scroll_cb),
                                         App_Constants::SCROLLING_TEXT_DWELL_MS);
 }
@@ -61,6 +92,7 @@ void Scroll_String::stop() {
     scroll_sched.deschedule();
     enable_scrolling = false;
     text_x_offset = 0; //reset out text offset 
+    if(strip_owner == this) strip_owner = nullptr;
 }
 
 //render the text on the screen
@@ -71,11 +103,18 @@ void Scroll_String::stop() {
 //      ADDITIONALLY, set the render font before calling this function!
 void Scroll_String::render(U8G2& graphics_handle) {
     
+    //only measure the text when it or the font has changed
+    if(graphics_handle.getU8g2()->font != prepared_font) prepare(graphics_handle);
+
+    //and if it's our turn with the strip, rasterize it (once)
+    if(strip_owner == this && !strip_attempted) {
+        strip_valid = rasterize(graphics_handle);
+        strip_attempted = true;
+    }
+
     //################### COMPUTE THE HORIZONTAL LOCATION OF OUR TEXT ###################
 
     //check whether our text can fit in our bounding box
-    u8g2_uint_t text_width = graphics_handle.getStrWidth(text_to_render.c_str());
-    u8g2_uint_t text_width_plus_pad = graphics_handle.getStrWidth((text_to_render + "    ").c_str());
     bool text_fits = ( text_width <= (right_x - left_x) );
     bool scrolling = !text_fits && enable_scrolling && do_scroll;
     
@@ -89,28 +128,154 @@ void Scroll_String::render(U8G2& graphics_handle) {
         //wrap around once our offset reaches the width of our text + padding
         if(text_x_offset <= -(float)(text_width_plus_pad))
             text_x_offset = 0;
-    }
-
-    //################### ACTUALLY DRAW OUR TEXT ###################
 
-    //we'll clip our buffer write area to the bounding box  
-    graphics_handle.setClipWindow(left_x, top_y, right_x, bottom_y);
+        //keep the frames coming while we're moving
+        UI_Page::request_redraw();
+    }
 
     //compute our pixel coordinates of the text we wanna render
     //text can automatically center align, so just compute the vert center of our box
     u8g2_uint_t vert_center = (bottom_y + top_y) >> 1;
     u8g2_uint_t horiz_left = left_x + ((u8g2_uint_t) - (u8g2_uint_t)(-1 * text_x_offset)); //have to do some messy unsigned math here
+
+    //################### COPY THE RASTERIZED TEXT IF WE CAN ###################
+
+    if(has_strip() && can_blit(graphics_handle)) {
+        //same vertical placement `setFontPosCenter()` would give: baseline sits halfway between the reference ascent and descent
+        int32_t ascent = graphics_handle.getAscent();
+        int32_t descent = graphics_handle.getDescent();
+        int32_t baseline = (int32_t)vert_center + (ascent - descent) / 2 + descent;
+
+        //same horizontal position as above, just signed
+        int32_t x_left = (int32_t)left_x - (int32_t)(-1 * text_x_offset);
+        blit(graphics_handle, x_left, baseline - strip_above_baseline);
+        if(scrolling) blit(graphics_handle, x_left + text_width_plus_pad, baseline - strip_above_baseline);
+        return;
+    }
+
+    //################### OTHERWISE DRAW OUR TEXT ###################
+
+    //we'll clip our buffer write area to the bounding box  
+    graphics_handle.setClipWindow(left_x, top_y, right_x, bottom_y);
     
     //draw two copies of the font at the computed positions
     //draw another copy of the text if we're scrolling --> gives effect of wrapping around
     graphics_handle.setFontPosCenter(); //vertically center our text
-    graphics_handle.drawStr(horiz_left, vert_center, text_to_render.c_str());
+    graphics_handle.drawStr(horiz_left, vert_center, text_to_render.data());
     if(scrolling)
         graphics_handle.drawStr(horiz_left + text_width_plus_pad, 
-                                vert_center, text_to_render.c_str());    
+                                vert_center, text_to_render.data());    
 
     //bring font and screen clipping back to default
     graphics_handle.setFontPosBaseline(); 
     graphics_handle.setMaxClipWindow();
 
-}
\ No newline at end of file
+}
+
+//============================== PRIVATE FUNCTIONS ==============================
+
+//measure the text (and the text + the gap before it repeats when scrolling)
+//new font means the strip (if it's ours) needs redoing too
+void Scroll_String::prepare(U8G2& graphics_handle) {
+    text_width = graphics_handle.getStrWidth(text_to_render.data());
+    text_width_plus_pad = text_width + graphics_handle.getStrWidth("    ");
+    prepared_font = graphics_handle.getU8g2()->font;
+    if(strip_owner == this) strip_attempted = false;
+}
+
+/*
+ * U8g2 can only draw into the frame buffer, so borrow the top few pages of it:
+ *  \--> save them off, clear them, and clip drawing to them
+ *  \--> draw the text with its tallest glyph's top at row 0, one display width's worth at a time (text can be wider than the screen)
+ *  \--> copy each chunk into the strip
+ *  \--> put the frame buffer back the way it was
+ */
+bool Scroll_String::rasterize(U8G2& graphics_handle) {
+    if(!can_blit(graphics_handle)) return false;
+    if(text_width == 0 || text_width > MAX_STRIP_WIDTH) return false;
+
+    //tallest glyph in the font decides how tall the strip is, and where the baseline sits in it
+    const int32_t strip_height = graphics_handle.getMaxCharHeight();
+    const int32_t above_baseline = strip_height + graphics_handle.getU8g2()->font_info.y_offset;
+    if(strip_height <= 0) return false;
+
+    const size_t pages = (strip_height + 7) >> 3;
+    const size_t buffer_width = graphics_handle.getBufferTileWidth() * 8;
+    const size_t borrowed_bytes = pages * buffer_width;
+    if(pages > MAX_STRIP_PAGES || pages > graphics_handle.getBufferTileHeight() || borrowed_bytes > rasterize_scratch.size()) return false;
+
+    uint8_t* frame = graphics_handle.getBufferPtr();
+    memcpy(rasterize_scratch.data(), frame, borrowed_bytes);
+
+    graphics_handle.setFontPosBaseline();
+    graphics_handle.setClipWindow(0, 0, buffer_width, pages * 8);
+    for(size_t chunk_start = 0; chunk_start < text_width; chunk_start += buffer_width) {
+        memset(frame, 0, borrowed_bytes);
+        graphics_handle.drawStr((u8g2_uint_t)(0 - chunk_start), above_baseline, text_to_render.data()); //same unsigned wrap as scrolling
+
+        size_t chunk_width = min(buffer_width, text_width - chunk_start);
+        for(size_t page = 0; page < pages; page++)
+            memcpy(&strip[page * text_width + chunk_start], frame + page * buffer_width, chunk_width);
+    }
+    graphics_handle.setMaxClipWindow();
+    memcpy(frame, rasterize_scratch.data(), borrowed_bytes);
+
+    strip_width = text_width;
+    strip_pages = pages;
+    strip_above_baseline = above_baseline;
+    return true;
+}
+
+//bits of a frame buffer page (8 rows starting at `page_top`) that fall inside rows [`clip_top`, `clip_bot`)
+static inline uint8_t page_row_mask(int32_t page_top, int32_t clip_top, int32_t clip_bot) {
+    int32_t lo = max(clip_top - page_top, (int32_t)0);
+    int32_t hi = min(clip_bot - page_top, (int32_t)8);
+    if(lo >= hi) return 0;
+    return (uint8_t)(((1u << hi) - 1) & ~((1u << lo) - 1));
+}
+
+//each strip page lands across (at most) two frame buffer pages, shifted down by however far the strip is off the page grid
+void Scroll_String::blit(U8G2& graphics_handle, int32_t x, int32_t y) {
+    uint8_t* frame = graphics_handle.getBufferPtr();
+    const int32_t buffer_width = graphics_handle.getBufferTileWidth() * 8;
+    const int32_t buffer_height = graphics_handle.getBufferTileHeight() * 8;
+
+    //clip to the bounding box and the frame buffer (right and bottom edges excluded, like the clip window)
+    const int32_t clip_left = left_x;
+    const int32_t clip_right = min((int32_t)right_x, buffer_width);
+    const int32_t clip_top = top_y;
+    const int32_t clip_bot = min((int32_t)bottom_y, buffer_height);
+
+    //columns of the strip that end up visible
+    const int32_t col_start = max(clip_left - x, (int32_t)0);
+    const int32_t col_end = min(clip_right - x, (int32_t)strip_width);
+    if(col_start >= col_end) return;
+
+    const int32_t pages = strip_pages;
+    for(int32_t page = 0; page < pages; page++) {
+        //which frame buffer page the top row of this strip page falls in, and how far down in it
+        int32_t row = y + page * 8;
+        int32_t dest_page = (row >= 0) ? (row >> 3) : -((7 - row) >> 3);
+        uint8_t shift = row - dest_page * 8;
+
+        uint8_t mask_upper = (dest_page >= 0 && dest_page * 8 < buffer_height) ? page_row_mask(dest_page * 8, clip_top, clip_bot) : 0;
+        uint8_t mask_lower = (shift != 0 && dest_page + 1 >= 0 && (dest_page + 1) * 8 < buffer_height) ?
+                                page_row_mask((dest_page + 1) * 8, clip_top, clip_bot) : 0;
+
+        const uint8_t* src = &strip[page * strip_width];
+        if(mask_upper) {
+            uint8_t* dst = frame + dest_page * buffer_width;
+            for(int32_t col = col_start; col < col_end; col++) dst[x + col] |= (uint8_t)(src[col] << shift) & mask_upper;
+        }
+        if(mask_lower) {
+            uint8_t* dst = frame + (dest_page + 1) * buffer_width;
+            for(int32_t col = col_start; col < col_end; col++) dst[x + col] |= (uint8_t)(src[col] >> (8 - shift)) & mask_lower;
+        }
+    }
+}
+
+//full frame buffer, not rotated --> buffer pages map straight onto screen rows
+bool Scroll_String::can_blit(U8G2& graphics_handle) {
+    return  graphics_handle.getU8g2()->cb == U8G2_R0 &&
+            graphics_handle.getBufferTileHeight() * 8 >= graphics_handle.getDisplayHeight();
+}
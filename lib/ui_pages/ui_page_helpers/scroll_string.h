@@ -11,31 +11,51 @@
  *      \--> main page
  *      \--> UI menus
  *      \--> parameters
+ *
+ * Text gets copied into a fixed buffer (up to `MAX_TEXT_CHARS`, longer text is cut off), so setting it never allocates
+ *
+ * The focused text (the last one `start()`ed) is rasterized once into a strip bitmap (same 1-bpp, 8-rows-per-byte layout as U8g2's frame buffer)
+ *      \--> there's only one strip, fixed size and shared by every instance; the focused text is the one that scrolls, so it gets it
+ *      \--> happens on the first `render()` after the text or the font changes, since that's when we know the font
+ *      \--> every frame after that just copies the visible part of the strip into the frame buffer at the scroll offset
+ *      \--> strip pixels get OR'ed in, i.e. the text is drawn in the default draw color
+ *      \--> everything else draws its glyphs every frame, as does the focused text if the strip can't be used
+ *           (rotated display, page buffer, really long text or a really tall font)
  * 
  * By Ishaan Gov Jan 2024 
  */
 
-#include <string>
+#include <array>
 
 #include <Arduino.h>
 #include <U8g2lib.h>
 
 #include <scheduler.h> //for when to start scrolling text 
+#include <ui_page.h> //to request redraws while scrolling
+#include <utils.h> //for string handles
 
 class Scroll_String {
 public:
     //default constructor to easily initialize an array of these
     //non-default constructor to specify text and/or location on startup
     Scroll_String();
-    Scroll_String(std::string _text_to_render);
-    Scroll_String(  std::string _text_to_render, 
+    Scroll_String(App_String _text_to_render);
+    Scroll_String(  App_String _text_to_render, 
                     u8g2_uint_t _top_y, 
                     u8g2_uint_t _bottom_y, 
                     u8g2_uint_t _left_x, 
                     u8g2_uint_t _right_x);
 
+    //let go of the strip if we have it
+    ~Scroll_String();
+
+    //longest text we keep; anything past this gets cut off
+    static constexpr size_t MAX_TEXT_CHARS = 127;
+
     //set the string to render
-    void set_render_text(std::string _text_to_render);
+    //text gets copied, so it doesn't have to outlive this
+    //setting the same text again does nothing (i.e. doesn't cost a re-rasterize)
+    void set_render_text(App_String _text_to_render);
 
     //set how many pixels to scroll per screen update
     inline void set_scroll_px_per_update(float px) { if(px > 0) scroll_px_per_update = px; }
@@ -48,12 +68,14 @@ public:
     void set_bounding_box(u8g2_uint_t _top_y, u8g2_uint_t _bottom_y, u8g2_uint_t _left_x, u8g2_uint_t _right_x);
 
     //reset the rendering state variables and schedule the callback that enables scrolling after dwell
+    //also takes over the strip, so this text gets rasterized on its next render
     //intent is to call this function from `on_focus()` when using scrolling text for menus
     void start(bool _enable_scrolling = true);
 
     //this function is basically to deschedule the scrolling callback function
     //and force disables scrolling of the text
     //ensures that if we're going through menus quickly, we don't get a bunch of callback functions queued up
+    //hands the strip back too
     //intent is to call this function from `on_defocus()` when using scrolling text for menus
     void stop();
 
@@ -63,14 +85,57 @@ public:
     //NOTE: set the font to render before calling this particular function
     void render(U8G2& graphics_handle);
 
+    //widest and tallest text that gets a strip; anything bigger is drawn glyph by glyph
+    static constexpr u8g2_uint_t MAX_STRIP_WIDTH = 1024;
+    static constexpr size_t MAX_STRIP_PAGES = 3;
+
 private:
+    //measure the text with the current font
+    void prepare(U8G2& graphics_handle);
+
+    //draw our text into the strip, borrowing the top of the frame buffer to do so; false if we can't use a strip here
+    bool rasterize(U8G2& graphics_handle);
+
+    //whether the strip currently holds our text
+    inline bool has_strip() { return strip_owner == this && strip_valid; }
+
+    //OR the strip into the frame buffer with its top left corner at (x, y), clipped to the bounding box
+    void blit(U8G2& graphics_handle, int32_t x, int32_t y);
+
+    //strips only work if the frame buffer is laid out the way we draw into it
+    static bool can_blit(U8G2& graphics_handle);
+
     //scheduler callback function that sets the `do_scroll` flag
+    //and asks for a frame so the scrolling actually gets going
     static inline void do_scroll_cb(void* context) {
         reinterpret_cast<Scroll_String*>(context)->do_scroll = true;
+        UI_Page::request_redraw();
     }
 
     //this is the actual string that we're going to render
-    std::string text_to_render = "";
+    std::array<char, MAX_TEXT_CHARS + 1> text_to_render = {};
+    size_t text_len = 0;
+
+    //the focused text, rasterized; pages of 8 rows, one byte per column, `strip_width` columns per page
+    //along with how many rows of it sit above the baseline
+    //shared by all instances, only ever used from the UI loop
+    static std::array<uint8_t, MAX_STRIP_WIDTH * MAX_STRIP_PAGES> strip;
+    static Scroll_String* strip_owner;
+    static u8g2_uint_t strip_width;
+    static size_t strip_pages;
+    static int32_t strip_above_baseline;
+    static bool strip_attempted; //owner has tried rasterizing its current text/font; don't retry every frame if it didn't fit
+    static bool strip_valid;
+
+    //font the text was measured (and, if we own the strip, rasterized) with; cleared when the text changes so it gets redone
+    const uint8_t* prepared_font = nullptr;
+    u8g2_uint_t text_width = 0;
+    u8g2_uint_t text_width_plus_pad = 0;
+
+    //somewhere to keep the part of the frame buffer we borrow while rasterizing
+    //shared by all instances, only ever used from the UI loop
+    static constexpr size_t RASTERIZE_SCRATCH_BYTES = 1024;
+    static std::array<uint8_t, RASTERIZE_SCRATCH_BYTES> rasterize_scratch;
 
     //delay scrolling of text by a little bit after `reset()` is called
     Scheduler scroll_sched;
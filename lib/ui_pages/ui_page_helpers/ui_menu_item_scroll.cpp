@@ -8,12 +8,12 @@ Menu_Item_Scroll::Menu_Item_Scroll():
 {}
 
 //constructor with parameter string--just pass this to the scrolling text
-Menu_Item_Scroll::Menu_Item_Scroll(std::string _render_text):
+Menu_Item_Scroll::Menu_Item_Scroll(App_String _render_text):
     scroller(_render_text)
 {}
 
 //set the render text
-void Menu_Item_Scroll::set_render_text(std::string _text_to_render) {
+void Menu_Item_Scroll::set_render_text(App_String _text_to_render) {
     scroller.set_render_text(_text_to_render);
 }
 
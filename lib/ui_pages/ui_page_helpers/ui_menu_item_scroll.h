@@ -21,11 +21,11 @@ class Menu_Item_Scroll : public UI_Menu_Item {
 public:
     //provide a default constructor and a constructor that initializes the scrolling text
     Menu_Item_Scroll();
-    Menu_Item_Scroll(std::string _render_text);
+    Menu_Item_Scroll(App_String _render_text);
 
     //provide a way to set the text if default constructor is used
     //just forward it to the scroll string class
-    void set_render_text(std::string _text_to_render);
+    void set_render_text(App_String _text_to_render);
 
     //override these functions from the menu item class
     //NOTE: render font MUST be set before calling draw!
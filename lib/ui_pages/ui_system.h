@@ -34,19 +34,8 @@ public:
     static inline void start() { if(entry != nullptr) entry->on_entry(); }
 
 private:
-    //select effect forwarding function
-    //use this function to select a new effect for the particular effect index
-    //expects `context` to point to a std::pair<size_t, size_t>
-    //  \--> first element corresponds to index
-    //  \--> second element corresponds to new effect number
-    static void replace_effect_cb(void* context);
-
     //this is our entry point into the UI system
     //set this variable only after make_ui() has been called
     static UI_Page* entry;
-
-    //a little messy, but have a pointer to the main screen
-    //use this to transition back to the main screen after choosing an effect
-    static UI_Page* app_main_screen;
 };
 
@@ -0,0 +1,65 @@
+#include <capture_frame.h>
+
+#include <string.h> //memcmp, memcpy
+
+static constexpr char MAGIC[4] = {'F', 'X', 'A', 'C'};
+
+//CRC-32 of every nibble value; half-byte steps keep the table tiny and it's still plenty fast for ~100kB/s
+static const uint32_t CRC_NIBBLE_TABLE[16] = {
+	0x00000000, 0x1DB71064, 0x3B6E20C8, 0x26D930AC, 0x76DC4190, 0x6B6B51F4, 0x4DB26158, 0x5005713C,
+	0xEDB88320, 0xF00F9344, 0xD6D6A3E8, 0xCB61B38C, 0x9B64C2B0, 0x86D3D2D4, 0xA00AE278, 0xBDBDF21C
+};
+
+//helpers to move little-endian values in and out of byte buffers
+static inline uint16_t read_le16(const uint8_t* p) { return (uint16_t)p[0] | ((uint16_t)p[1] << 8); }
+static inline uint32_t read_le32(const uint8_t* p) { return (uint32_t)p[0] | ((uint32_t)p[1] << 8) | ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24); }
+static inline void write_le16(uint8_t* p, uint16_t v) { p[0] = v & 0xFF; p[1] = v >> 8; }
+static inline void write_le32(uint8_t* p, uint32_t v) { p[0] = v & 0xFF; p[1] = (v >> 8) & 0xFF; p[2] = (v >> 16) & 0xFF; p[3] = v >> 24; }
+
+size_t Capture_Frame::write(uint8_t* buf, const Info& info, const int16_t* samples) {
+    memcpy(buf, MAGIC, sizeof(MAGIC));
+    write_le32(buf + 4, info.sequence);
+    buf[8] = info.tap_point;
+    buf[9] = info.flags;
+    write_le16(buf + 10, info.num_samples);
+
+    uint8_t* payload = buf + HEADER_BYTES;
+    for(size_t i = 0; i < info.num_samples; i++)
+        write_le16(payload + 2 * i, (uint16_t)samples[i]);
+
+    //CRC covers everything but the magic
+    size_t crc_offset = HEADER_BYTES + info.num_samples * 2;
+    write_le32(buf + crc_offset, crc32(buf + sizeof(MAGIC), crc_offset - sizeof(MAGIC)));
+    return crc_offset + CRC_BYTES;
+}
+
+bool Capture_Frame::parse_header(const uint8_t* buf, Info& info) {
+    if(memcmp(buf, MAGIC, sizeof(MAGIC)) != 0) return false;
+
+    info.sequence = read_le32(buf + 4);
+    info.tap_point = buf[8];
+    info.flags = buf[9];
+    info.num_samples = read_le16(buf + 10);
+    return info.num_samples <= MAX_SAMPLES;
+}
+
+bool Capture_Frame::verify(const uint8_t* buf, const Info& info) {
+    size_t crc_offset = HEADER_BYTES + info.num_samples * 2;
+    return crc32(buf + sizeof(MAGIC), crc_offset - sizeof(MAGIC)) == read_le32(buf + crc_offset);
+}
+
+void Capture_Frame::read_samples(const uint8_t* buf, const Info& info, int16_t* samples) {
+    const uint8_t* payload = buf + HEADER_BYTES;
+    for(size_t i = 0; i < info.num_samples; i++)
+        samples[i] = (int16_t)read_le16(payload + 2 * i);
+}
+
+uint32_t Capture_Frame::crc32(const uint8_t* buf, size_t len, uint32_t crc) {
+    crc = ~crc;
+    for(size_t i = 0; i < len; i++) {
+        crc ^= buf[i];
+        crc = (crc >> 4) ^ CRC_NIBBLE_TABLE[crc & 0x0F];
+        crc = (crc >> 4) ^ CRC_NIBBLE_TABLE[crc & 0x0F];
+    }
+    return ~crc;
+}
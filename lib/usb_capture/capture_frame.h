@@ -0,0 +1,68 @@
+#pragma once
+
+/*
+ * Framing for audio blocks streamed to a host over USB serial
+ * Produced by `USB_Capture` in the firmware, reassembled by `tools/capture_decoder`
+ *
+ * Layout (all little-endian):
+ *      \--> 4 bytes    magic "FXAC"
+ *      \--> 4 bytes    sequence number (counts every block the audio update produced, so gaps are dropped blocks)
+ *      \--> 1 byte     tap point the block came from (0 is the chain input)
+ *      \--> 1 byte     flags
+ *      \--> 2 bytes    number of samples
+ *      \--> num_samples x 2 bytes      samples
+ *      \--> 4 bytes    CRC-32 (IEEE 802.3) of everything after the magic, up to the end of the samples
+ *
+ * The magic lets the host resync after garbage (e.g. debug prints sharing the port); the CRC catches false syncs and corruption
+ * Like the cab blob format, nothing in here is Arduino-specific so the host tool can share it
+ * Intention is to use this class statically, i.e. don't instantiate it
+ */
+
+#include <stdint.h>
+#include <stddef.h>
+
+class Capture_Frame {
+public:
+    //prevent all flavors of making an instance of one of these
+    Capture_Frame() = delete;
+    Capture_Frame(const Capture_Frame& other) = delete;
+    void operator=(const Capture_Frame& other) = delete;
+
+    //fixed-size parts of the frame
+    static constexpr size_t HEADER_BYTES = 12;
+    static constexpr size_t CRC_BYTES = 4;
+
+    //frames never carry more than one audio block
+    static constexpr size_t MAX_SAMPLES = 128;
+    static constexpr size_t MAX_FRAME_BYTES = HEADER_BYTES + MAX_SAMPLES * 2 + CRC_BYTES;
+
+    //flag bits
+    static constexpr uint8_t FLAG_THROUGHPUT_TEST = 0x01; //dummy frame from the throughput test, not audio
+
+    //information stored in the header
+    struct Info {
+        uint32_t sequence;
+        uint8_t tap_point;
+        uint8_t flags;
+        uint16_t num_samples;
+    };
+
+    //total size of a frame carrying `num_samples` samples
+    static constexpr size_t frame_bytes(size_t num_samples) { return HEADER_BYTES + num_samples * 2 + CRC_BYTES; }
+
+    //write a complete frame into `buf` (needs `frame_bytes(info.num_samples)` of space), returns how many bytes were written
+    static size_t write(uint8_t* buf, const Info& info, const int16_t* samples);
+
+    //parse the `HEADER_BYTES` at `buf` into `info`
+    //returns false if the magic doesn't match or the sample count is out of range
+    static bool parse_header(const uint8_t* buf, Info& info);
+
+    //check the CRC of a complete frame whose header has already been parsed into `info`
+    static bool verify(const uint8_t* buf, const Info& info);
+
+    //pull the samples out of a complete frame
+    static void read_samples(const uint8_t* buf, const Info& info, int16_t* samples);
+
+    //CRC-32 (reflected, polynomial 0xEDB88320), continuing from `crc` if running over several buffers
+    static uint32_t crc32(const uint8_t* buf, size_t len, uint32_t crc = 0);
+};
@@ -0,0 +1,80 @@
+#include <usb_capture.h>
+
+#include <audio_tap.h> //capture feed out of the audio update
+
+//======================== STATIC VARIABLE DEFINITION =====================
+
+bool USB_Capture::throughput_test_running = false;
+uint32_t USB_Capture::throughput_test_start_ms = 0;
+uint32_t USB_Capture::throughput_test_sequence = 0;
+std::array<uint8_t, USB_Capture::FRAME_BYTES> USB_Capture::frame_buffer;
+
+//================================= PUBLIC FUNCTIONS =============================
+
+bool USB_Capture::start(size_t tap_point) {
+    if(tap_point > Audio_Tap::TAP_OUTPUT) return false;
+    throughput_test_running = false;
+    Audio_Tap::enable_capture_feed(true, tap_point);
+    return true;
+}
+
+void USB_Capture::stop() {
+    Audio_Tap::enable_capture_feed(false);
+    throughput_test_running = false;
+}
+
+//no audio while the test is running, it needs all the bandwidth
+void USB_Capture::start_throughput_test() {
+    Audio_Tap::enable_capture_feed(false);
+    throughput_test_running = true;
+    throughput_test_start_ms = millis();
+    throughput_test_sequence = 0;
+}
+
+void USB_Capture::update() {
+    if(throughput_test_running) run_throughput_test();
+    else if(Audio_Tap::capture_feed_enabled()) drain_capture_ring();
+}
+
+//================================= PRIVATE FUNCTIONS =============================
+
+void USB_Capture::drain_capture_ring() {
+    Audio_Tap::Capture_Ring_t& ring = Audio_Tap::get_capture_ring();
+    static Audio_Tap::Capture_Block_t block;
+
+    while(ring.available() > 0 && (size_t)Serial.availableForWrite() >= FRAME_BYTES) {
+        ring.pop(&block, 1);
+
+        Capture_Frame::Info info;
+        info.sequence = block.sequence;
+        info.tap_point = block.tap_point;
+        info.flags = 0;
+        info.num_samples = block.samples.size();
+        Capture_Frame::write(frame_buffer.data(), info, block.samples.data());
+        Serial.write(frame_buffer.data(), FRAME_BYTES);
+    }
+}
+
+//frames are the same size as audio frames, so the host can compare straight against what audio needs
+//payload is a ramp so the host can sanity check it if it wants to
+void USB_Capture::run_throughput_test() {
+    static std::array<int16_t, App_Constants::PROCESSING_BLOCK_SIZE> dummy_samples;
+
+    while((size_t)Serial.availableForWrite() >= FRAME_BYTES) {
+        if(millis() - throughput_test_start_ms >= App_Constants::CAPTURE_THROUGHPUT_TEST_MS) {
+            throughput_test_running = false;
+            return;
+        }
+
+        for(size_t i = 0; i < dummy_samples.size(); i++)
+            dummy_samples[i] = (int16_t)(throughput_test_sequence + i);
+
+        Capture_Frame::Info info;
+        info.sequence = throughput_test_sequence++;
+        info.tap_point = 0;
+        info.flags = Capture_Frame::FLAG_THROUGHPUT_TEST;
+        info.num_samples = dummy_samples.size();
+        Capture_Frame::write(frame_buffer.data(), info, dummy_samples.data());
+        Serial.write(frame_buffer.data(), FRAME_BYTES);
+    }
+}
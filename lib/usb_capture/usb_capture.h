@@ -0,0 +1,57 @@
+#pragma once
+
+/*
+ * Streams audio from any point in the chain to a host over the USB serial port
+ *
+ * Audio update only tags blocks and pushes them into `Audio_Tap`'s capture ring
+ *      \--> `update()` runs from `loop()`, framing blocks (see `capture_frame.h`) and writing them out as long as USB has room
+ *      \--> if the host can't keep up the ring fills and blocks get dropped; the sequence numbers let the host see exactly which
+ *
+ * Started/stopped by the host through the remote-control protocol (see `Remote_Control`)
+ *      \--> throughput test streams dummy frames as fast as USB takes them for `CAPTURE_THROUGHPUT_TEST_MS`
+ *
+ * Intention is to use this class statically, i.e. don't instantiate it
+ */
+
+#include <array>
+#include <Arduino.h>
+
+#include <capture_frame.h> //framing shared with the host decoder
+#include <config.h> //capture configuration
+
+class USB_Capture {
+public:
+    //prevent all flavors of making an instance of one of these
+    USB_Capture() = delete;
+    USB_Capture(const USB_Capture& other) = delete;
+    void operator=(const USB_Capture& other) = delete;
+
+    //start streaming from `tap_point` (0 is the input, `NUM_EFFECTS` is the final output); returns false if there's no such tap point
+    static bool start(size_t tap_point);
+    static void stop();
+
+    //stream dummy frames flat out for a while (stops any capture in progress)
+    static void start_throughput_test();
+
+    //send out whatever's waiting; call this from `loop()`
+    static void update();
+
+private:
+    //send framed blocks out of the capture ring while USB has room for them
+    static void drain_capture_ring();
+
+    //send dummy frames while USB has room for them, until the test time is up
+    static void run_throughput_test();
+
+    //frame of a full block
+    static constexpr size_t FRAME_BYTES = Capture_Frame::frame_bytes(App_Constants::PROCESSING_BLOCK_SIZE);
+    static_assert(App_Constants::PROCESSING_BLOCK_SIZE <= Capture_Frame::MAX_SAMPLES, "Audio block doesn't fit in a capture frame!");
+
+    //throughput test progress
+    static bool throughput_test_running;
+    static uint32_t throughput_test_start_ms;
+    static uint32_t throughput_test_sequence;
+
+    //scratch space to build frames in
+    static std::array<uint8_t, FRAME_BYTES> frame_buffer;
+};
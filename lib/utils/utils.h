@@ -48,6 +48,7 @@
  */
 
 #include <array> //for span implementation
+#include <string.h> //for string view comparison
 #include <Arduino.h> //don't think this is necessary, but just outta good form
 
 class Callback_Function {
@@ -128,4 +129,46 @@ private:
 	//just hold a pointer and a size
 	T* span_ptr;
 	size_t span_size; 
-};
\ No newline at end of file
+};
+
+/*
+ * ====================== "DIY" STRING VIEW ===================
+ * Same idea as the span above, for text: most of our text never changes (effect names, parameter labels, menu text),
+ * so there's no reason to copy it into heap `std::string`s everywhere
+ * Kept as our own type rather than `std::string_view` for two things the standard one doesn't do:
+ * 	\--> comparing checks the pointer first, so two handles to the same interned text compare in one step
+ * 	\--> always null-terminated, so `c_str()` can go straight to U8g2 and `Serial`
+ * 
+ * Just a pointer to some null-terminated text and its length; whoever made the text owns it
+ * 	\--> mostly made from string literals (see `App_Strings` in `app_strings.h`), which live forever in flash
+ * 	\--> can also point at a char buffer or a `std::string` that outlives the handle
+ * Cheap to copy and pass by value; constructing from a literal happens at compile time
+ */
+
+class App_String {
+public:
+	constexpr App_String(): str_ptr(""), str_len(0) {}
+	constexpr App_String(const char* _str): str_ptr(_str), str_len(const_strlen(_str)) {}
+	constexpr App_String(const char* _str, size_t _len): str_ptr(_str), str_len(_len) {}
+
+	inline const char* c_str() const { return str_ptr; }
+	inline size_t size() const { return str_len; }
+	inline bool empty() const { return str_len == 0; }
+
+	inline bool operator==(const App_String& other) const {
+		if(str_ptr == other.str_ptr) return str_len == other.str_len;
+		return str_len == other.str_len && memcmp(str_ptr, other.str_ptr, str_len) == 0;
+	}
+	inline bool operator!=(const App_String& other) const { return !(*this == other); }
+
+private:
+	//`strlen()` isn't constexpr; this is, so literals get measured by the compiler
+	static constexpr size_t const_strlen(const char* str) {
+		size_t len = 0;
+		while(str[len] != '\0') len++;
+		return len;
+	}
+
+	const char* str_ptr;
+	size_t str_len;
+};
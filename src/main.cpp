@@ -4,7 +4,14 @@
 
 //helper function includes
 #include <all_effects.h>
+#include <cab_ir_library.h>
+#include <effect_cab_sim.h>
 #include <ui_system.h>
+#include <ui_page_helpers/frame_diff.h>
+#include <display_i2c.h>
+#include <audio_tap.h>
+#include <usb_capture.h>
+#include <remote_control.h>
 
 //Utility-type things includes
 #include <config.h>
@@ -46,7 +53,8 @@ const std::array<uint8_t, App_Constants::LEVEL_VIS_NUM_LEDS> Audio_Level_Vis::le
 //get the specific display type and rotation from the config 
 //TODO: FIX!!! Another PlatformIO include path issue
 //App_Constants::U8G2_LCD_TYPE ui_display(App_Constants::SCREEN_ROTATION);
-U8G2_SH1106_128X64_NONAME_F_HW_I2C ui_display(U8G2_R0);
+//DMA-driven I2C underneath so frames go out in the background
+U8G2_SH1106_128X64_NONAME_F_DMA_I2C ui_display(U8G2_R0);
 
 //initialize the static variables in the UI_Page parent class
 //includes default fonts, LEDs and Encoders
@@ -70,15 +78,48 @@ void audio_system_update() {
 	//run the audio samples through the effect chain
 	//input from the array at the current index
 	//output to the array at the next index
-	for(size_t i = 0; i < App_Constants::NUM_EFFECTS; i++) 
+	//time each effect with the cycle counter so we can keep an eye on the CPU budget
+	for(size_t i = 0; i < App_Constants::NUM_EFFECTS; i++) {
+		uint32_t start_cycles = ARM_DWT_CYCCNT;
 		Effects_Manager::get_active_effect(i)->audio_update(
 			effect_buffers[i],	//read from current index
 			effect_buffers[i+1]	//write to next index
 		);
+		Effects_Manager::record_cycles(i, ARM_DWT_CYCCNT - start_cycles);
+	}
 	
 
 	//write the data out with the processed audio data from the last effect
 	Audio_Out_MQS::update(effect_buffers[App_Constants::NUM_EFFECTS]);
+
+	//hand off copies of the chain to anything listening from `loop()` (tuner, etc.)
+	Audio_Tap::update(effect_buffers);
+}
+
+//host control over USB serial (parameters, chain edits, capture)
+Remote_Control remote_control;
+
+//print the CPU usage of each effect slot over serial
+//report as a percentage of the time we have to process a single block too
+Scheduler cycle_report_sched;
+void report_effect_cycles() {
+	static const float CYCLES_PER_BLOCK = (float)F_CPU_ACTUAL * App_Constants::PROCESSING_BLOCK_SIZE / App_Constants::AUDIO_SAMPLE_RATE_HZ;
+	for(size_t i = 0; i < App_Constants::NUM_EFFECTS; i++) {
+		uint32_t peak = Effects_Manager::get_peak_cycles(i);
+		Serial.printf("[%u] %s: %lu cycles (peak %lu, %.1f%%)\n", (unsigned)i, Effects_Manager::get_active_effect(i)->get_name().c_str(),
+						Effects_Manager::get_cycles(i), peak, 100.0f * peak / CYCLES_PER_BLOCK);
+	}
+	Effects_Manager::reset_peak_cycles();
+}
+
+//print how much pixel data went out to the display since the last report
+Scheduler display_report_sched;
+void report_display_traffic() {
+	uint32_t frames = Frame_Diff::get_frame_count();
+	uint32_t total = Frame_Diff::get_total_bytes();
+	Serial.printf("Display: %lu frames, %lu bytes (avg %lu, peak %u bytes/frame), %lu bus errors\n", frames, total,
+					frames > 0 ? total / frames : 0, (unsigned)Frame_Diff::get_peak_bytes(), Display_I2C::get_error_count());
+	Frame_Diff::reset_stats();
 }
 
 void setup() {
@@ -95,6 +136,10 @@ void setup() {
 	for(size_t i = 1; i <= 6; i++)
 		CrashReport.breadcrumb(i, 0);
 	
+	//load cabinet impulse responses off the SD card
+	//do this before the audio system and UI come up so cab sims can see the loaded cabs
+	Cab_IR_Library::init(Effect_Cab_Sim::IMPULSE_POST_SCALE_SHIFT);
+
 	//initialize our audio effects
 	Effects_Manager::init();
 
@@ -116,6 +161,9 @@ void setup() {
 	//initialize our audio input level visualizer
 	Audio_Level_Vis::init();
 
+	//initialize the taps that hand audio off to `loop()`
+	Audio_Tap::init();
+
 	//attach the update hook to the output function --> this corresponds to the main audio system update!
 	//should run at the highest priority to provide the most real time operation
 	Audio_Out_MQS::attach_interrupt(audio_system_update, App_Constants::AUDIO_BLOCK_PROCESS_PRIO);
@@ -129,12 +177,26 @@ void setup() {
 
 	//start our UI system
 	UI_System::start();
+
+	//start reporting effect CPU usage if we've enabled it
+	if(App_Constants::REPORT_EFFECT_CYCLES)
+		cycle_report_sched.schedule_interval_ms(report_effect_cycles, App_Constants::EFFECT_CYCLES_REPORT_MS);
+
+	//same for the display traffic
+	if(App_Constants::REPORT_DISPLAY_TRAFFIC)
+		display_report_sched.schedule_interval_ms(report_display_traffic, App_Constants::DISPLAY_TRAFFIC_REPORT_MS);
 }
 
 void loop() {
-	//all we need to do in the loop is run our scheduler and encoder callbacks
+	//all we need to do in the loop is run our scheduler and encoder callbacks, and service the USB serial port
 	//everything else is managed by the UI system
 	//and audio updates run in interrupt context; so don't need to take place here
-	Rotary_Encoder::update_all();
+	
+	//anything the user does with the knobs is worth a redraw (the draw scheduler limits how often that happens)
+	if(Rotary_Encoder::update_all()) UI_Page::request_redraw();
 	Scheduler::update();
+
+	//handle any remote commands, then stream any captured audio out over USB as fast as it'll go
+	remote_control.update();
+	USB_Capture::update();
 }
\ No newline at end of file
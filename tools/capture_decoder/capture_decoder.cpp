@@ -0,0 +1,335 @@
+/*
+ * Host side of the USB audio capture
+ * Records framed audio blocks from the firmware's USB serial port (or decodes a raw dump of one) and reassembles them into a WAV
+ *
+ * Decoding:
+ *      \--> scans for the frame magic, then checks the CRC; anything that doesn't check out is skipped a byte at a time to resync
+ *      \--> gaps in the sequence numbers are blocks the firmware had to drop; they're filled with silence so the timing stays intact
+ *      \--> bytes that aren't part of a frame (e.g. debug prints) are counted and otherwise ignored
+ *
+ * Report at the end:
+ *      \--> frames decoded, CRC failures, dropped blocks (and what fraction of the stream that is), stray bytes
+ *      \--> measured byte/frame rates against what 48kHz x 16-bit mono needs once framed
+ *      \--> with `--throughput`, the firmware first streams dummy frames flat out, measuring the ceiling of the link
+ *
+ * Frame format is shared with the firmware (`lib/usb_capture/capture_frame.h`)
+ * Capture is started and stopped with remote-control commands (`tools/remote_client`)
+ *
+ * Build (from this directory):
+ *      g++ -std=c++17 -O2 -I../../lib/usb_capture -I../../lib/remote -I../remote_client capture_decoder.cpp \
+ *          ../../lib/usb_capture/capture_frame.cpp ../../lib/remote/remote_protocol.cpp ../remote_client/remote_client.cpp -o capture_decoder
+ *
+ * Usage:
+ *      capture_decoder <output wav> [options]
+ *          --port DEV          serial device to record from (default /dev/ttyACM0)
+ *          --tap N             point in the chain to record, 0 is the input (default 4, the final output)
+ *          --seconds S         how long to record for (default 10)
+ *          --throughput        measure the throughput ceiling of the link before recording
+ *          --input FILE        decode a raw dump instead of recording from the device
+ *          --dump FILE         save the raw bytes received from the device too
+ *          --rate HZ           sample rate to write into the WAV header (default 48000)
+ */
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <fcntl.h>
+#include <termios.h>
+#include <unistd.h>
+
+#include <capture_frame.h>
+#include <remote_client.h>
+
+using Clock = std::chrono::steady_clock;
+
+//how long to listen during the throughput test; a bit longer than the firmware runs it for (`CAPTURE_THROUGHPUT_TEST_MS`)
+static constexpr double THROUGHPUT_LISTEN_SECONDS = 3.0;
+
+struct Options {
+    std::string output_path;
+    std::string port = "/dev/ttyACM0";
+    std::string input_path;
+    std::string dump_path;
+    unsigned tap_point = 4;
+    double seconds = 10;
+    bool throughput = false;
+    uint32_t rate = 48000;
+};
+
+//=========================== STREAM DECODER =========================
+
+//pulls frames out of an arbitrary byte stream
+class Stream_Decoder {
+public:
+    //stats over everything decoded so far
+    size_t frames = 0;
+    size_t crc_failures = 0;
+    size_t dropped_blocks = 0;
+    size_t stray_bytes = 0;
+    size_t test_frames = 0;
+
+    //reassembled audio
+    std::vector<int16_t> samples;
+
+    //feed in whatever came off the wire
+    void feed(const uint8_t* data, size_t len) {
+        pending.insert(pending.end(), data, data + len);
+
+        size_t pos = 0;
+        while(pending.size() - pos >= Capture_Frame::HEADER_BYTES) {
+            //not a frame (or a frame with a bogus length) --> slide along a byte
+            Capture_Frame::Info info;
+            if(!Capture_Frame::parse_header(pending.data() + pos, info)) {
+                pos++;
+                stray_bytes++;
+                continue;
+            }
+
+            //wait for the rest of it
+            size_t frame_len = Capture_Frame::frame_bytes(info.num_samples);
+            if(pending.size() - pos < frame_len) break;
+
+            //magic can show up in the audio too, so a bad CRC just means keep scanning
+            if(!Capture_Frame::verify(pending.data() + pos, info)) {
+                pos++;
+                crc_failures++;
+                continue;
+            }
+
+            accept(pending.data() + pos, info);
+            pos += frame_len;
+        }
+        pending.erase(pending.begin(), pending.begin() + pos);
+    }
+
+private:
+    std::vector<uint8_t> pending;
+    bool have_sequence = false;
+    uint32_t next_sequence = 0;
+
+    void accept(const uint8_t* frame, const Capture_Frame::Info& info) {
+        frames++;
+        if(info.flags & Capture_Frame::FLAG_THROUGHPUT_TEST) {
+            test_frames++;
+            return;
+        }
+
+        //firmware restarts at zero every time capture starts; anything else missing was dropped
+        //fill the gap with silence, assuming full blocks went missing
+        if(have_sequence && info.sequence != next_sequence) {
+            if(info.sequence > next_sequence) {
+                uint32_t missing = info.sequence - next_sequence;
+                dropped_blocks += missing;
+                samples.insert(samples.end(), (size_t)missing * info.num_samples, 0);
+            }
+        }
+        have_sequence = true;
+        next_sequence = info.sequence + 1;
+
+        size_t start = samples.size();
+        samples.resize(start + info.num_samples);
+        Capture_Frame::read_samples(frame, info, samples.data() + start);
+    }
+};
+
+//=========================== SERIAL PORT =========================
+
+//raw mode, nothing translated; USB CDC ignores the baud rate anyway
+static int open_port(const std::string& path) {
+    int fd = open(path.c_str(), O_RDWR | O_NOCTTY);
+    if(fd < 0) return -1;
+
+    termios tty;
+    if(tcgetattr(fd, &tty) != 0) {
+        close(fd);
+        return -1;
+    }
+    cfmakeraw(&tty);
+    tty.c_cc[VMIN] = 0;
+    tty.c_cc[VTIME] = 1; //reads time out after 100ms
+    tcsetattr(fd, TCSANOW, &tty);
+    tcflush(fd, TCIOFLUSH);
+    return fd;
+}
+
+//read from the port into the decoder (and the dump file) for `seconds`, returns how many bytes came in
+//`active_seconds` is the time between the first and last bytes arriving
+static size_t record(int fd, double seconds, Stream_Decoder& decoder, FILE* dump, double& active_seconds) {
+    std::vector<uint8_t> buf(16384);
+    size_t total = 0;
+    Clock::time_point first, last;
+    Clock::time_point end = Clock::now() + std::chrono::duration_cast<Clock::duration>(std::chrono::duration<double>(seconds));
+    while(Clock::now() < end) {
+        ssize_t n = read(fd, buf.data(), buf.size());
+        if(n <= 0) continue;
+
+        last = Clock::now();
+        if(total == 0) first = last;
+        decoder.feed(buf.data(), n);
+        if(dump) fwrite(buf.data(), 1, n, dump);
+        total += n;
+    }
+    active_seconds = std::chrono::duration<double>(last - first).count();
+    return total;
+}
+
+//=========================== WAV OUTPUT =========================
+
+static void put_le16(FILE* f, uint16_t v) { fputc(v & 0xFF, f); fputc(v >> 8, f); }
+static void put_le32(FILE* f, uint32_t v) { put_le16(f, v & 0xFFFF); put_le16(f, v >> 16); }
+
+//16-bit mono PCM
+static bool write_wav(const std::string& path, const std::vector<int16_t>& samples, uint32_t rate) {
+    FILE* f = fopen(path.c_str(), "wb");
+    if(!f) return false;
+
+    uint32_t data_bytes = samples.size() * 2;
+    fwrite("RIFF", 1, 4, f);
+    put_le32(f, 36 + data_bytes);
+    fwrite("WAVEfmt ", 1, 8, f);
+    put_le32(f, 16);            //fmt chunk size
+    put_le16(f, 1);             //PCM
+    put_le16(f, 1);             //mono
+    put_le32(f, rate);
+    put_le32(f, rate * 2);      //byte rate
+    put_le16(f, 2);             //block align
+    put_le16(f, 16);            //bits per sample
+    fwrite("data", 1, 4, f);
+    put_le32(f, data_bytes);
+    for(int16_t s : samples) put_le16(f, (uint16_t)s);
+
+    fclose(f);
+    return true;
+}
+
+//=========================== MAIN =========================
+
+static void usage() {
+    fprintf(stderr, "usage: capture_decoder <output wav> [--port DEV] [--tap N] [--seconds S] [--throughput] "
+                    "[--input FILE] [--dump FILE] [--rate HZ]\n");
+}
+
+static bool parse_args(int argc, char** argv, Options& opts) {
+    if(argc < 2) return false;
+    opts.output_path = argv[1];
+    for(int i = 2; i < argc; i++) {
+        std::string arg = argv[i];
+        bool has_value = i + 1 < argc;
+        if(arg == "--throughput") opts.throughput = true;
+        else if(arg == "--port" && has_value) opts.port = argv[++i];
+        else if(arg == "--tap" && has_value) opts.tap_point = atoi(argv[++i]);
+        else if(arg == "--seconds" && has_value) opts.seconds = atof(argv[++i]);
+        else if(arg == "--input" && has_value) opts.input_path = argv[++i];
+        else if(arg == "--dump" && has_value) opts.dump_path = argv[++i];
+        else if(arg == "--rate" && has_value) opts.rate = atoi(argv[++i]);
+        else return false;
+    }
+    return opts.tap_point <= 9;
+}
+
+int main(int argc, char** argv) {
+    Options opts;
+    if(!parse_args(argc, argv, opts)) {
+        usage();
+        return 1;
+    }
+
+    //what a live stream needs: one full frame for every block
+    const size_t block_samples = Capture_Frame::MAX_SAMPLES;
+    const double frames_per_sec_needed = (double)opts.rate / block_samples;
+    const double bytes_per_sec_needed = frames_per_sec_needed * Capture_Frame::frame_bytes(block_samples);
+
+    Stream_Decoder decoder;
+    size_t capture_bytes = 0;
+    double capture_seconds = 0;
+
+    if(!opts.input_path.empty()) {
+        //offline --> just decode the dump
+        FILE* in = fopen(opts.input_path.c_str(), "rb");
+        if(!in) {
+            fprintf(stderr, "Couldn't open %s\n", opts.input_path.c_str());
+            return 1;
+        }
+        std::vector<uint8_t> buf(16384);
+        size_t n;
+        while((n = fread(buf.data(), 1, buf.size(), in)) > 0) {
+            decoder.feed(buf.data(), n);
+            capture_bytes += n;
+        }
+        fclose(in);
+    }
+    else {
+        int fd = open_port(opts.port);
+        if(fd < 0) {
+            fprintf(stderr, "Couldn't open %s\n", opts.port.c_str());
+            return 1;
+        }
+        FILE* dump = opts.dump_path.empty() ? nullptr : fopen(opts.dump_path.c_str(), "wb");
+        Fd_Transport transport(fd);
+        Remote_Client client(transport);
+
+        //make sure nothing's streaming from a previous session
+        if(!client.stop_capture()) {
+            fprintf(stderr, "No response from %s\n", opts.port.c_str());
+            return 1;
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(200));
+        tcflush(fd, TCIFLUSH);
+
+        //flat-out dummy frames; the firmware stops on its own, just listen for a bit longer than it runs
+        if(opts.throughput) {
+            Stream_Decoder test_decoder;
+            if(!client.start_throughput_test()) {
+                fprintf(stderr, "Couldn't start the throughput test\n");
+                return 1;
+            }
+            double test_seconds = 0;
+            size_t test_bytes = record(fd, THROUGHPUT_LISTEN_SECONDS, test_decoder, nullptr, test_seconds);
+            if(test_seconds <= 0) {
+                fprintf(stderr, "No throughput test frames received\n");
+                return 1;
+            }
+
+            //rate over the span the frames actually arrived in
+            double ceiling = test_bytes / test_seconds;
+            printf("Throughput test: %zu frames (%zu CRC failures) --> ~%.0f bytes/s, ~%.0f frames/s\n",
+                    test_decoder.test_frames, test_decoder.crc_failures, ceiling, test_decoder.test_frames / test_seconds);
+            printf("Live capture needs %.0f bytes/s (%.1f frames/s): %.1fx headroom\n",
+                    bytes_per_sec_needed, frames_per_sec_needed, ceiling / bytes_per_sec_needed);
+        }
+
+        //start capturing the requested tap point
+        if(!client.start_capture(opts.tap_point)) {
+            fprintf(stderr, "Couldn't start capturing tap %u\n", (unsigned)opts.tap_point);
+            return 1;
+        }
+        capture_bytes = record(fd, opts.seconds, decoder, dump, capture_seconds);
+        client.stop_capture();
+
+        if(dump) fclose(dump);
+        close(fd);
+    }
+
+    if(!write_wav(opts.output_path, decoder.samples, opts.rate)) {
+        fprintf(stderr, "Couldn't write %s\n", opts.output_path.c_str());
+        return 1;
+    }
+
+    //############## REPORT ##############
+
+    size_t expected_blocks = decoder.frames - decoder.test_frames + decoder.dropped_blocks;
+    printf("Wrote %zu samples (%.2fs) to %s\n", decoder.samples.size(), (double)decoder.samples.size() / opts.rate, opts.output_path.c_str());
+    printf("Frames: %zu decoded, %zu CRC failures, %zu stray bytes\n", decoder.frames - decoder.test_frames, decoder.crc_failures, decoder.stray_bytes);
+    printf("Dropped blocks: %zu (%.3f%%)\n", decoder.dropped_blocks,
+            expected_blocks ? 100.0 * decoder.dropped_blocks / expected_blocks : 0.0);
+    if(capture_seconds > 0) {
+        double rate = capture_bytes / capture_seconds;
+        printf("Capture rate: %.0f bytes/s (needs %.0f bytes/s, %.1f%%)\n", rate, bytes_per_sec_needed, 100.0 * rate / bytes_per_sec_needed);
+    }
+    return 0;
+}
@@ -0,0 +1,225 @@
+/*
+ * Host benchmark for the delay effect's memory access pattern
+ * Runs the same input and the same knob movements through two versions of the delay line, both on a simulated slow memory:
+ *      \--> block: `Block_Delay_Line` (`lib/effects/effect_dsp/block_delay_line.cpp`), compiled straight from the firmware source
+ *           --> one span read and one block write per audio block
+ *      \--> per sample: the same math, but every output sample reads its two neighbors and writes its feedback sample
+ *           straight to the slow memory (what the delay line would look like without the internal RAM staging)
+ * Checks that both produce exactly the same output, then reports memory traffic and modeled bus time per block
+ *
+ * Slow memory model is PSRAM on the Teensy 4.1's FlexSPI2, quad mode at 88MHz:
+ *      \--> every access is a separate transaction: command + address (+ dummy cycles for reads), then 2 clocks per byte
+ *      \--> doesn't model the M7's data cache; cached reads soften the per-sample case on the pedal, so treat its numbers as the worst case
+ * Host wall time is reported too, but that's just memcpy into host RAM; the modeled bus time is the number that matters
+ *
+ * Build (from this directory):
+ *      g++ -std=c++17 -O2 -I../host_shim -I../../lib/config -I../../lib/utils -I../../lib/rgb_led -I../../lib/effects \
+ *          delay_bench.cpp ../../lib/effects/effect_dsp/block_delay_line.cpp -o delay_bench
+ *
+ * Usage:
+ *      delay_bench [blocks]        (default 20000)
+ * Exits non-zero if the two versions don't produce the same output
+ */
+
+#include <array>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+
+#include <dspinst.h>
+#include <effect_dsp/block_delay_line.h>
+
+//========================= SLOW MEMORY MODEL =========================
+
+//PSRAM timing (quad SPI, 88MHz)
+static constexpr double CLOCK_NS = 1000.0 / 88.0;
+static constexpr double READ_SETUP_CLOCKS = 2 + 6 + 6 + 1;  //command, 24-bit address, dummy cycles, chip select turnaround
+static constexpr double WRITE_SETUP_CLOCKS = 2 + 6 + 1;     //command, 24-bit address, chip select turnaround
+static constexpr double CLOCKS_PER_BYTE = 2;
+
+//copies like plain memory, but counts every transaction and what it would have cost on the bus
+class Slow_Memory : public Block_Delay_Line::Memory {
+public:
+    void read(const int16_t* src, int16_t* dst, size_t len) override {
+        memcpy(dst, src, len * sizeof(int16_t));
+        reads++;
+        bytes += len * sizeof(int16_t);
+        bus_ns += (READ_SETUP_CLOCKS + CLOCKS_PER_BYTE * len * sizeof(int16_t)) * CLOCK_NS;
+    }
+    void write(int16_t* dst, const int16_t* src, size_t len) override {
+        memcpy(dst, src, len * sizeof(int16_t));
+        writes++;
+        bytes += len * sizeof(int16_t);
+        bus_ns += (WRITE_SETUP_CLOCKS + CLOCKS_PER_BYTE * len * sizeof(int16_t)) * CLOCK_NS;
+    }
+
+    uint64_t reads = 0;
+    uint64_t writes = 0;
+    uint64_t bytes = 0;
+    double bus_ns = 0;
+};
+
+//========================= PER-SAMPLE VERSION =========================
+
+//same delay time glide and interpolation as `Block_Delay_Line::process()`, but straight to memory a sample at a time
+class Per_Sample_Delay_Line {
+public:
+    static constexpr uint32_t DELAY_FRAC_BITS = Block_Delay_Line::DELAY_FRAC_BITS;
+
+    Per_Sample_Delay_Line(Slow_Memory& _memory): memory(_memory) {}
+
+    void attach(int16_t* _buffer, size_t len, float delay_samples) {
+        buffer = _buffer;
+        buffer_len = len;
+        write_pos = 0;
+        current_delay = (int32_t)delay_samples << DELAY_FRAC_BITS;
+    }
+
+    void process(const Audio_Block_t& block_in, Audio_Block_t& block_out, float target_delay_samples, int32_t feedback_q15, int32_t wet_q15) {
+        const int32_t target_delay = (int32_t)target_delay_samples << DELAY_FRAC_BITS;
+        const int32_t dry_q15 = 32767 - wet_q15;
+
+        const int32_t MAX_SLEW = Block_Delay_Line::MAX_SLEW_SAMPLES << DELAY_FRAC_BITS;
+        int32_t delay_step = (target_delay - current_delay) >> Block_Delay_Line::SMOOTHING_SHIFT;
+        if(delay_step == 0) delay_step = target_delay - current_delay;
+        delay_step = constrain(delay_step, -MAX_SLEW, MAX_SLEW);
+        const int32_t delay_start = current_delay;
+        current_delay += delay_step;
+
+        const size_t BLOCK_SIZE = block_in.size();
+        for(size_t i = 0; i < BLOCK_SIZE; i++) {
+            int32_t delay_i = delay_start + (int32_t)((delay_step * (int32_t)(i + 1)) / (int32_t)BLOCK_SIZE);
+
+            //absolute read position in the line, then the two neighboring samples off the slow memory
+            int64_t read_pos = ((int64_t)(write_pos + i) << DELAY_FRAC_BITS) - delay_i;
+            int64_t idx = read_pos >> DELAY_FRAC_BITS;
+            int32_t frac = (int32_t)(read_pos & ((1 << DELAY_FRAC_BITS) - 1));
+            size_t pos0 = (size_t)((idx % (int64_t)buffer_len + buffer_len) % buffer_len);
+            size_t pos1 = pos0 + 1 < buffer_len ? pos0 + 1 : 0;
+
+            int16_t s0, s1;
+            memory.read(buffer + pos0, &s0, 1);
+            memory.read(buffer + pos1, &s1, 1);
+            int32_t wet = s0 + ((((int32_t)s1 - s0) * frac) >> DELAY_FRAC_BITS);
+
+            int32_t dry = block_in[i];
+            block_out[i] = (int16_t)signed_saturate_rshift(dry * dry_q15 + wet * wet_q15, 16, 15);
+
+            int16_t fed_back = (int16_t)signed_saturate_rshift(dry * 32768 + wet * feedback_q15, 16, 15);
+            memory.write(buffer + write_pos + i, &fed_back, 1);
+        }
+
+        write_pos += BLOCK_SIZE;
+        if(write_pos >= buffer_len) write_pos = 0;
+    }
+
+private:
+    Slow_Memory& memory;
+    int16_t* buffer = nullptr;
+    size_t buffer_len = 0;
+    size_t write_pos = 0;
+    int32_t current_delay = 0;
+};
+
+//========================= TEST DATA =========================
+
+//small deterministic generator so every run sees the same input
+static uint32_t lcg_state = 12345;
+static float rand_unit() {
+    lcg_state = lcg_state * 1664525u + 1013904223u;
+    return (float)(lcg_state >> 8) / (float)(1u << 24) * 2.0f - 1.0f;
+}
+
+//plucked notes: decaying tone bursts every quarter second, with a little noise
+static void make_input(std::vector<Audio_Block_t>& blocks) {
+    size_t n = 0;
+    for(auto& block : blocks) {
+        for(auto& sample : block) {
+            float t = (float)(n % 12000) / 48000.0f;
+            float x = 8000.0f * expf(-t * 12.0f) * sinf(2.0f * (float)M_PI * 196.0f * t) + 200.0f * rand_unit();
+            sample = (int16_t)lrintf(x);
+            n++;
+        }
+    }
+}
+
+//someone turning the time knob now and then (and tapping in a tempo), between 120ms and 700ms
+static float delay_ms_at(size_t block) {
+    static const float KNOB_POSITIONS[] = {350, 352.5f, 360, 420, 120, 700, 500, 333};
+    return KNOB_POSITIONS[(block / 300) % (sizeof(KNOB_POSITIONS) / sizeof(KNOB_POSITIONS[0]))];
+}
+
+//========================= MAIN =========================
+
+struct Run_Result {
+    double host_ns_per_block;
+    std::vector<Audio_Block_t> output;
+};
+
+template<class Line>
+static Run_Result run(Line& line, const std::vector<Audio_Block_t>& input, size_t blocks, bool keep_output) {
+    static constexpr float SAMPLES_PER_MS = App_Constants::AUDIO_SAMPLE_RATE_HZ / 1000.0f;
+    static constexpr int32_t FEEDBACK_Q15 = 35 * 327.67f;
+    static constexpr int32_t WET_Q15 = 30 * 327.67f;
+
+    Run_Result result;
+    Audio_Block_t out;
+    auto start = std::chrono::steady_clock::now();
+    for(size_t b = 0; b < blocks; b++) {
+        line.process(input[b % input.size()], out, delay_ms_at(b) * SAMPLES_PER_MS, FEEDBACK_Q15, WET_Q15);
+        if(keep_output) result.output.push_back(out);
+    }
+    auto elapsed = std::chrono::steady_clock::now() - start;
+    result.host_ns_per_block = std::chrono::duration<double, std::nano>(elapsed).count() / blocks;
+    return result;
+}
+
+static void report(const char* name, const Slow_Memory& memory, const Run_Result& result, size_t blocks) {
+    static constexpr double BLOCK_PERIOD_NS = 1e9 * App_Constants::PROCESSING_BLOCK_SIZE / App_Constants::AUDIO_SAMPLE_RATE_HZ;
+    double bus_ns = memory.bus_ns / blocks;
+    printf("  %-10s %7.1f reads + %6.1f writes, %6.0f bytes, bus %7.2f us/block (%5.1f%% of the block period), host %6.0f ns/block\n",
+            name, (double)memory.reads / blocks, (double)memory.writes / blocks, (double)memory.bytes / blocks,
+            bus_ns / 1000.0, 100.0 * bus_ns / BLOCK_PERIOD_NS, result.host_ns_per_block);
+}
+
+int main(int argc, char** argv) {
+    const long blocks = argc > 1 ? atol(argv[1]) : 20000;
+    if(blocks <= 0) {
+        fprintf(stderr, "Usage: %s [blocks]\n", argv[0]);
+        return 1;
+    }
+
+    //same buffer size the effect allocates with PSRAM fitted
+    const size_t max_delay_samples = (size_t)App_Constants::DELAY_MAX_TIME_PSRAM_MS * App_Constants::AUDIO_SAMPLE_RATE_HZ / 1000;
+    const size_t len = Block_Delay_Line::buffer_length_for(max_delay_samples);
+    const float start_delay = delay_ms_at(0) * App_Constants::AUDIO_SAMPLE_RATE_HZ / 1000.0f;
+
+    std::vector<Audio_Block_t> input(1024);
+    make_input(input);
+
+    Slow_Memory block_memory, sample_memory;
+    std::vector<int16_t> block_buffer(len, 0), sample_buffer(len, 0);
+    Block_Delay_Line block_line(&block_memory);
+    Per_Sample_Delay_Line sample_line(sample_memory);
+    block_line.attach(block_buffer.data(), len, start_delay);
+    sample_line.attach(sample_buffer.data(), len, start_delay);
+
+    Run_Result block_result = run(block_line, input, blocks, true);
+    Run_Result sample_result = run(sample_line, input, blocks, true);
+
+    size_t mismatched = 0;
+    for(size_t b = 0; b < (size_t)blocks; b++)
+        if(block_result.output[b] != sample_result.output[b]) mismatched++;
+
+    printf("%ld blocks of %zu samples, %zu sample delay line, time knob moving between 120 and 700ms\n",
+            blocks, App_Constants::PROCESSING_BLOCK_SIZE, len);
+    report("block", block_memory, block_result, blocks);
+    report("per sample", sample_memory, sample_result, blocks);
+    printf("  block access needs %.1fx less modeled bus time\n", sample_memory.bus_ns / block_memory.bus_ns);
+
+    if(mismatched) printf("FAILED: %zu blocks differ between the two versions\n", mismatched);
+    else printf("PASS: outputs identical\n");
+    return mismatched ? 1 : 0;
+}
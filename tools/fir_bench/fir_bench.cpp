@@ -0,0 +1,240 @@
+/*
+ * Host benchmark for the cab sim's FIR kernel
+ * Runs the same impulse response and the same input through two kernels, checks that they agree, and times them per block:
+ *      \--> old: the circular-buffer loop `Effect_Cab_Sim` used to run (Q1.31 table taps, 32x16 MAC per tap, wraparound check per tap)
+ *      \--> current: `FIR_Direct_Q15` (`lib/effects/effect_dsp/fir_direct_q15.cpp`), compiled straight from the firmware source
+ *
+ * Impulse response is a stand-in cabinet (decaying filtered noise, deterministic), put through the same steps as a real one:
+ *      \--> normalized with `IR_Process::normalize_to_q15()` at the cab sim headroom, like `tools/ir_compiler`
+ *      \--> written into the scaled Q1.31 `Impulse_Response_t` table format (what the old kernel ran directly)
+ *      \--> converted to Q15 taps the way `Effect_Cab_Sim::load_kernel()` does (what the current kernel runs)
+ * Both kernels are compared against a double-precision convolution with the table's taps
+ *      \--> they round differently (the old one truncates every product, the current one truncates each tap once),
+ *           so they don't agree bit for bit; each has to stay within its own rounding bound of the reference
+ *
+ * Host timings come from the plain C fallbacks of the DSP instructions (see `tools/host_shim`), not SMLALD/SMLALDX on the M7
+ *      \--> they show the effect of the loop structure (no per-tap wraparound, every loaded sample reused across 4 outputs),
+ *           not the cycle counts on the pedal; the remote-control perf counters give those
+ *
+ * Build (from this directory):
+ *      g++ -std=c++17 -O2 -I../host_shim -I../../lib/config -I../../lib/utils -I../../lib/rgb_led -I../../lib/effects \
+ *          -I../../lib/ir_loader fir_bench.cpp ../../lib/effects/effect_dsp/fir_direct_q15.cpp ../../lib/ir_loader/ir_process.cpp -o fir_bench
+ *
+ * Usage:
+ *      fir_bench [blocks]      (default 20000)
+ * Exits non-zero if the kernels don't agree
+ */
+
+#include <array>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <limits>
+#include <vector>
+
+#include <dspinst.h>
+#include <effect_dsp/fir_direct_q15.h>
+#include <ir_process.h>
+
+//========================= CAB SIM CONSTANTS (mirror Effect_Cab_Sim) =========================
+
+static constexpr size_t NUM_TAPS = 256; //`Effect_Cab_Sim::Impulse_Response_t`
+static constexpr size_t IMPULSE_POST_SCALE_SHIFT = 4; //`Effect_Cab_Sim::IMPULSE_POST_SCALE_SHIFT`
+static constexpr size_t SUM_SHIFT_AMT = 16 - IMPULSE_POST_SCALE_SHIFT;
+//saturation bounds of the accumulator before it's shifted down to 16 bits
+//multiplied rather than shifted since left-shifting the negative bound isn't defined
+static constexpr int32_t SUM_MAX = (int32_t)std::numeric_limits<int16_t>::max() * (1 << SUM_SHIFT_AMT);
+static constexpr int32_t SUM_MIN = (int32_t)std::numeric_limits<int16_t>::min() * (1 << SUM_SHIFT_AMT);
+typedef std::array<int32_t, NUM_TAPS> Impulse_Response_t;
+
+//========================= OLD KERNEL =========================
+
+//the circular-buffer convolution from before `FIR_Direct_Q15`, minus the effect around it
+class Old_Cab_FIR {
+public:
+    Old_Cab_FIR(const Impulse_Response_t& _impulse_kernel): impulse_kernel(_impulse_kernel) {}
+
+    void process(const Audio_Block_t& block_in, Audio_Block_t& block_out) {
+        for(size_t block_sample_index = 0; block_sample_index < block_in.size(); block_sample_index++) {
+            sample_memory[sample_memory_head] = block_in[block_sample_index];
+
+            int32_t sum = 0;
+            size_t sample_buffer_ptr = sample_memory_head; //most recent sample
+            for(const auto& tap : impulse_kernel) {
+                sum = signed_multiply_accumulate_32x16b(sum, tap, (uint32_t)sample_memory[sample_buffer_ptr]);
+                if(sample_buffer_ptr == 0) sample_buffer_ptr = sample_memory.size() - 1;
+                else sample_buffer_ptr--;
+            }
+
+            //taps are Q1.31 scaled down by the kernel length
+            sum = sum << 1;
+            sum = sum * impulse_kernel.size();
+
+            if(sum > SUM_MAX)
+                block_out[block_sample_index] = std::numeric_limits<int16_t>::max();
+            else if(sum < SUM_MIN)
+                block_out[block_sample_index] = std::numeric_limits<int16_t>::min();
+            else
+                block_out[block_sample_index] = (int16_t)(sum >> SUM_SHIFT_AMT);
+
+            sample_memory_head++;
+            if(sample_memory_head >= sample_memory.size()) sample_memory_head = 0;
+        }
+    }
+
+private:
+    const Impulse_Response_t& impulse_kernel;
+    std::array<int16_t, NUM_TAPS> sample_memory = {0};
+    size_t sample_memory_head = 0;
+};
+
+//========================= TEST DATA =========================
+
+//small deterministic generator so every run sees the same IR and input
+static uint32_t lcg_state = 12345;
+static float rand_unit() {
+    lcg_state = lcg_state * 1664525u + 1013904223u;
+    return (float)(lcg_state >> 8) / (float)(1u << 24) * 2.0f - 1.0f;
+}
+
+//decaying noise through a one-pole lowpass --> roughly the shape of a close-miked cabinet
+static void make_impulse_response(Impulse_Response_t& table, std::array<int16_t, NUM_TAPS>& taps_q15) {
+    std::array<float, NUM_TAPS> ir;
+    float lowpassed = 0;
+    for(size_t i = 0; i < NUM_TAPS; i++) {
+        lowpassed += 0.35f * (rand_unit() - lowpassed);
+        ir[i] = lowpassed * expf(-(float)i / 40.0f);
+    }
+
+    //normalize like `tools/ir_compiler`, then write the scaled Q1.31 table like its header output does
+    std::array<int16_t, NUM_TAPS> normalized;
+    IR_Process::normalize_to_q15(ir.data(), NUM_TAPS, normalized.data(), IMPULSE_POST_SCALE_SHIFT);
+    for(size_t i = 0; i < NUM_TAPS; i++)
+        table[i] = (int32_t)normalized[i] * (int32_t)(1 << SUM_SHIFT_AMT) / (int32_t)NUM_TAPS;
+
+    //and back to Q15 the way `Effect_Cab_Sim::load_kernel()` does
+    for(size_t i = 0; i < NUM_TAPS; i++) {
+        int32_t tap = (table[i] * (int32_t)NUM_TAPS) >> SUM_SHIFT_AMT;
+        taps_q15[i] = (int16_t)constrain(tap, (int32_t)std::numeric_limits<int16_t>::min(), (int32_t)std::numeric_limits<int16_t>::max());
+    }
+}
+
+//a guitar-ish level: a couple of tones plus some noise, a few thousand LSBs peak
+static void make_input(std::vector<Audio_Block_t>& blocks) {
+    size_t n = 0;
+    for(auto& block : blocks) {
+        for(auto& sample : block) {
+            float t = (float)n++ / 48000.0f;
+            float x = 3000.0f * sinf(2.0f * (float)M_PI * 110.0f * t) + 1500.0f * sinf(2.0f * (float)M_PI * 1375.0f * t)
+                    + 800.0f * rand_unit();
+            sample = (int16_t)lrintf(x);
+        }
+    }
+}
+
+//========================= CHECKS =========================
+
+struct Error_Stats {
+    double max_abs = 0;
+    double sum_sq = 0;
+    size_t count = 0;
+
+    void add(double err) {
+        max_abs = std::max(max_abs, fabs(err));
+        sum_sq += err * err;
+        count++;
+    }
+    double rms() const { return count ? sqrt(sum_sq / count) : 0; }
+};
+
+//double-precision convolution with the taps the table actually represents, clipped to int16_t like the kernels
+static void reference_output(const Impulse_Response_t& table, const std::vector<Audio_Block_t>& in, std::vector<double>& out) {
+    const double tap_scale = (double)NUM_TAPS * (double)(1 << IMPULSE_POST_SCALE_SHIFT) / 2147483648.0;
+    std::vector<double> x;
+    for(const auto& block : in) for(auto s : block) x.push_back(s);
+
+    out.assign(x.size(), 0);
+    for(size_t n = 0; n < x.size(); n++) {
+        double sum = 0;
+        for(size_t k = 0; k < NUM_TAPS && k <= n; k++) sum += table[k] * tap_scale * x[n - k];
+        out[n] = std::min(32767.0, std::max(-32768.0, sum));
+    }
+}
+
+//========================= MAIN =========================
+
+template<class Kernel>
+static double time_kernel(Kernel& kernel, const std::vector<Audio_Block_t>& in, size_t blocks, uint32_t& checksum) {
+    Audio_Block_t out;
+    auto start = std::chrono::steady_clock::now();
+    for(size_t b = 0; b < blocks; b++) {
+        kernel.process(in[b % in.size()], out);
+        checksum += (uint16_t)out[b % out.size()];
+    }
+    auto elapsed = std::chrono::steady_clock::now() - start;
+    return std::chrono::duration<double, std::nano>(elapsed).count() / blocks;
+}
+
+int main(int argc, char** argv) {
+    const long blocks = argc > 1 ? atol(argv[1]) : 20000;
+    if(blocks <= 0) {
+        fprintf(stderr, "Usage: %s [blocks]\n", argv[0]);
+        return 1;
+    }
+
+    static Impulse_Response_t table;
+    std::array<int16_t, NUM_TAPS> taps_q15;
+    make_impulse_response(table, taps_q15);
+
+    static constexpr size_t CHECK_BLOCKS = 64;
+    std::vector<Audio_Block_t> input(CHECK_BLOCKS);
+    make_input(input);
+
+    //run both kernels over the same input, from a clean history
+    Old_Cab_FIR old_fir(table);
+    static FIR_Direct_Q15 new_fir;
+    new_fir.set_kernel(App_Span<const int16_t>(taps_q15.data(), taps_q15.size()));
+
+    std::vector<double> reference;
+    reference_output(table, input, reference);
+
+    Error_Stats old_err, new_err, diff;
+    double peak_out = 0;
+    size_t n = 0;
+    for(const auto& block : input) {
+        Audio_Block_t old_out, new_out;
+        old_fir.process(block, old_out);
+        new_fir.process(block, new_out);
+        for(size_t i = 0; i < block.size(); i++, n++) {
+            old_err.add(old_out[i] - reference[n]);
+            new_err.add(new_out[i] - reference[n]);
+            diff.add(new_out[i] - old_out[i]);
+            peak_out = std::max(peak_out, fabs(reference[n]));
+        }
+    }
+
+    printf("%zu taps, %zu samples per block, %zu blocks checked (output peak %.0f)\n",
+            NUM_TAPS, App_Constants::PROCESSING_BLOCK_SIZE, CHECK_BLOCKS, peak_out);
+    printf("  old vs reference:     max %.1f LSB, rms %.2f LSB\n", old_err.max_abs, old_err.rms());
+    printf("  current vs reference: max %.1f LSB, rms %.2f LSB\n", new_err.max_abs, new_err.rms());
+    printf("  current vs old:       max %.1f LSB, rms %.2f LSB\n", diff.max_abs, diff.rms());
+
+    //old truncates every product before the x2 x256 >> 12 rescale --> up to 256 / 8 = 32 LSB low
+    //current truncates each tap to Q15 once and accumulates exactly --> within a couple of LSBs
+    static constexpr double OLD_MAX_ERROR_LSB = NUM_TAPS / 8.0;
+    static constexpr double CURRENT_MAX_ERROR_LSB = 2.0;
+    bool ok = old_err.max_abs <= OLD_MAX_ERROR_LSB + 1 && new_err.max_abs <= CURRENT_MAX_ERROR_LSB &&
+              diff.max_abs <= OLD_MAX_ERROR_LSB + CURRENT_MAX_ERROR_LSB;
+
+    //then time them over the same input, state carrying over from block to block like on the pedal
+    uint32_t checksum = 0; //keeps the compiler from throwing the output away
+    double old_ns = time_kernel(old_fir, input, blocks, checksum);
+    double new_ns = time_kernel(new_fir, input, blocks, checksum);
+    printf("%ld blocks (checksum %u):\n", blocks, (unsigned)checksum);
+    printf("  old circular buffer:  %8.0f ns/block\n", old_ns);
+    printf("  FIR_Direct_Q15:       %8.0f ns/block  (%.2fx)\n", new_ns, old_ns / new_ns);
+
+    printf(ok ? "PASS\n" : "FAILED: kernels don't agree\n");
+    return ok ? 0 : 1;
+}
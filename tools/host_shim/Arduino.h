@@ -0,0 +1,30 @@
+#pragma once
+
+/*
+ * Host stand-in for the parts of the Teensy core that the DSP code pulls in through `config.h` and friends
+ * Lets the host benchmarks compile the firmware's own DSP sources instead of copies of them
+ *      \--> types, math, `min()`/`max()`/`constrain()`
+ *      \--> pin names and `PROGMEM`, only so `config.h` parses; nothing here touches hardware
+ *
+ * Put this directory on the include path before anything under `lib/`
+ */
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <algorithm>
+
+using std::min;
+using std::max;
+
+template<class T> static inline T constrain(T x, T lo, T hi) { return x < lo ? lo : (x > hi ? hi : x); }
+
+#define PROGMEM
+
+//Teensy 4.1 analog pin numbers
+enum : uint8_t {
+    A0 = 14, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13,
+    A14 = 38, A15, A16, A17
+};
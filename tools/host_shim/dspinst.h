@@ -0,0 +1,32 @@
+#pragma once
+
+/*
+ * Host stand-in for Teensy's `dspinst.h`: plain C versions of the DSP instruction wrappers the firmware's DSP code uses
+ * Same results as the instructions themselves, just not single-cycle
+ */
+
+#include <stdint.h>
+
+//(a * b) >> 32
+static inline int32_t multiply_32x32_rshift32(int32_t a, int32_t b) { return ((int64_t)a * b) >> 32; }
+
+//sum + ((a * b[15:0]) >> 16)
+static inline int32_t signed_multiply_accumulate_32x16b(int32_t sum, int32_t a, uint32_t b) {
+    return sum + (int32_t)(((int64_t)a * (int16_t)(b & 0xFFFF)) >> 16);
+}
+
+//sum + ((a * b[31:16]) >> 16)
+static inline int32_t signed_multiply_accumulate_32x16t(int32_t sum, int32_t a, uint32_t b) {
+    return sum + (int32_t)(((int64_t)a * (int16_t)(b >> 16)) >> 16);
+}
+
+//a[31:16] in the top half, b[15:0] in the bottom
+static inline uint32_t pack_16t_16b(int32_t a, int32_t b) { return (a & 0xFFFF0000) | (b & 0x0000FFFF); }
+
+//saturate (val >> rshift) to a signed `bits`-bit value
+static inline int32_t signed_saturate_rshift(int32_t val, int bits, int rshift) {
+    int32_t shifted = val >> rshift;
+    const int32_t max_val = (1 << (bits - 1)) - 1;
+    const int32_t min_val = -(1 << (bits - 1));
+    return shifted > max_val ? max_val : (shifted < min_val ? min_val : shifted);
+}
@@ -0,0 +1,383 @@
+/*
+ * Offline cabinet impulse response compiler
+ * Batch-converts a directory of IR WAV files into kernels the firmware can use directly, processing files in parallel
+ *
+ * Processing for each file:
+ *      \--> read + downmix to mono, resample to the target sample rate           (shared with the firmware, `lib/ir_loader`)
+ *      \--> trim leading/trailing silence below a threshold relative to the peak
+ *      \--> optionally convert to minimum phase (real cepstrum method) to pack the energy into fewer taps
+ *      \--> truncate to the requested length with a short fade-out
+ *      \--> normalize against worst-case overflow with the cab sim headroom shift  (shared with the firmware, `lib/ir_loader`)
+ *
+ * Output formats:
+ *      \--> `header`: a ready-to-include header with an `Effect_Cab_Sim::Impulse_Response_t` in the scaled Q1.31 table format
+ *      \--> `blob`:   a `.cab` file (see `lib/ir_loader/cab_blob.h`) that can be dropped in the SD card cab directory
+ *
+ * Build (from this directory):
+ *      g++ -std=c++17 -O2 -pthread -I../../lib/ir_loader ir_compiler.cpp ../../lib/ir_loader/wav_reader.cpp \
+ *          ../../lib/ir_loader/ir_process.cpp ../../lib/ir_loader/cab_blob.cpp -o ir_compiler
+ *
+ * Usage:
+ *      ir_compiler <input dir> <output dir> [options]
+ *          --format header|blob    output format (default blob)
+ *          --length N              number of taps to keep (default 512 for blobs; header tables are always 256)
+ *          --rate HZ               target sample rate (default 48000)
+ *          --trim-db DB            trim silence below peak - DB (default 60, 0 disables)
+ *          --min-phase             convert to minimum phase before truncating
+ *          --headroom SHIFT        headroom shift to normalize with (default 4, matches `Effect_Cab_Sim::IMPULSE_POST_SCALE_SHIFT`)
+ *          --jobs N                number of worker threads (default: number of cores)
+ *      ir_compiler --self-test
+ *          writes a blob, then checks that the firmware's header checks accept it and reject mismatched ones
+ */
+
+#include <atomic>
+#include <cmath>
+#include <complex>
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <wav_reader.h>
+#include <ir_process.h>
+#include <cab_blob.h>
+
+namespace fs = std::filesystem;
+
+//size of the `Impulse_Response_t` table in `effect_cab_sim.h`
+static constexpr size_t HEADER_TABLE_TAPS = 256;
+
+//how many samples before the first sample above the trim threshold to keep
+static constexpr size_t TRIM_PREROLL = 8;
+
+//how many samples to fade out over at the end of the truncated kernel
+static constexpr size_t FADE_OUT_SAMPLES = 32;
+
+struct Options {
+    bool header_format = false;
+    size_t length = 512;
+    bool length_set = false;
+    uint32_t rate = 48000;
+    float trim_db = 60;
+    bool min_phase = false;
+    uint32_t headroom_shift = 4;
+    size_t jobs = 0;
+};
+
+//lets the WAV reader pull bytes out of a host file
+class File_Wav_Source : public Wav_Source {
+public:
+    File_Wav_Source(FILE* _file): file(_file) {}
+    size_t read(uint8_t* buf, size_t len) override { return fread(buf, 1, len, file); }
+private:
+    FILE* file;
+};
+
+//=========================== PROCESSING STAGES =========================
+
+//in-place iterative radix-2 FFT; length must be a power of two
+static void fft(std::vector<std::complex<double>>& x, bool inverse) {
+    const size_t n = x.size();
+    for(size_t i = 1, j = 0; i < n; i++) {
+        size_t bit = n >> 1;
+        for(; j & bit; bit >>= 1) j ^= bit;
+        j ^= bit;
+        if(i < j) std::swap(x[i], x[j]);
+    }
+    for(size_t len = 2; len <= n; len <<= 1) {
+        double angle = 2 * M_PI / len * (inverse ? 1 : -1);
+        std::complex<double> w_len(cos(angle), sin(angle));
+        for(size_t i = 0; i < n; i += len) {
+            std::complex<double> w(1);
+            for(size_t k = 0; k < len / 2; k++) {
+                std::complex<double> u = x[i + k], v = x[i + k + len / 2] * w;
+                x[i + k] = u + v;
+                x[i + k + len / 2] = u - v;
+                w *= w_len;
+            }
+        }
+    }
+    if(inverse) for(auto& v : x) v /= (double)n;
+}
+
+//convert to minimum phase with the real cepstrum method
+//magnitude response stays the same, energy gets pushed towards the start of the impulse response
+static std::vector<float> to_min_phase(const std::vector<float>& ir) {
+    //zero pad a bunch to keep time-aliasing of the cepstrum down
+    size_t n = 1;
+    while(n < ir.size() * 8) n <<= 1;
+    std::vector<std::complex<double>> x(n);
+    for(size_t i = 0; i < ir.size(); i++) x[i] = ir[i];
+
+    //real cepstrum --> ifft(log|X|)
+    fft(x, false);
+    for(auto& v : x) v = log(std::max(std::abs(v), 1e-9));
+    fft(x, true);
+
+    //fold the anti-causal part onto the causal part
+    for(size_t i = 1; i < n / 2; i++) x[i] *= 2.0;
+    for(size_t i = n / 2 + 1; i < n; i++) x[i] = 0;
+
+    //back out to the time domain
+    fft(x, false);
+    for(auto& v : x) v = std::exp(v);
+    fft(x, true);
+
+    std::vector<float> out(ir.size());
+    for(size_t i = 0; i < out.size(); i++) out[i] = (float)x[i].real();
+    return out;
+}
+
+//trim silence off the start and end of the impulse response
+static void trim(std::vector<float>& ir, float trim_db) {
+    if(trim_db <= 0 || ir.empty()) return;
+    float peak = 0;
+    for(float v : ir) peak = std::max(peak, std::fabs(v));
+    float threshold = peak * powf(10.0f, -trim_db / 20.0f);
+
+    size_t first = 0, last = ir.size() - 1;
+    while(first < ir.size() && std::fabs(ir[first]) < threshold) first++;
+    while(last > first && std::fabs(ir[last]) < threshold) last--;
+    first = first > TRIM_PREROLL ? first - TRIM_PREROLL : 0;
+
+    ir = std::vector<float>(ir.begin() + first, ir.begin() + last + 1);
+}
+
+//cut down to `length` taps, fading out the tail so we don't introduce a step
+static void truncate(std::vector<float>& ir, size_t length) {
+    if(ir.size() <= length) return;
+    ir.resize(length);
+    size_t fade = std::min(FADE_OUT_SAMPLES, length);
+    for(size_t i = 0; i < fade; i++)
+        ir[length - fade + i] *= 0.5f * (1.0f + cosf((float)M_PI * (i + 1) / fade));
+}
+
+//=========================== OUTPUT =========================
+
+//turn a file name into a C++ identifier, e.g. "Fender Twin.wav" -> "FENDER_TWIN"
+static std::string to_identifier(const std::string& stem) {
+    std::string id;
+    for(char c : stem) id += isalnum((unsigned char)c) ? (char)toupper((unsigned char)c) : '_';
+    if(id.empty() || isdigit((unsigned char)id[0])) id = "CAB_" + id;
+    return id;
+}
+
+//write the taps out as an `Impulse_Response_t` table
+//table taps are Q1.31 scaled down by the table length and the headroom factor
+//firmware converts these back with `(tap * length) >> (16 - headroom_shift)`
+static bool write_header(const fs::path& path, const std::string& source_name, const std::vector<int16_t>& taps, const Options& opt) {
+    std::ofstream out(path);
+    if(!out) return false;
+
+    const std::string id = to_identifier(path.stem().string());
+    out << "#pragma once\n\n";
+    out << "//generated by tools/ir_compiler from " << source_name << "\n";
+    out << "//" << opt.rate << "Hz, headroom shift " << opt.headroom_shift << (opt.min_phase ? ", minimum phase" : "") << "\n\n";
+    out << "#include <effect_cab_sim.h>\n\n";
+    out << "inline const Effect_Cab_Sim::Impulse_Response_t " << id << " = {\n";
+    for(size_t i = 0; i < HEADER_TABLE_TAPS; i++) {
+        int32_t q15 = i < taps.size() ? taps[i] : 0;
+        int32_t tap = q15 * (int32_t)(1 << (16 - opt.headroom_shift)) / (int32_t)HEADER_TABLE_TAPS;
+        out << (i % 7 == 0 ? "\t" : "") << tap << ",\t" << (i % 7 == 6 ? "\n" : "");
+    }
+    out << "\n};\n";
+    return (bool)out;
+}
+
+//write the taps out as a `.cab` blob
+static bool write_blob(const fs::path& path, const std::vector<int16_t>& taps, const Options& opt) {
+    std::ofstream out(path, std::ios::binary);
+    if(!out) return false;
+
+    uint8_t header[Cab_Blob::HEADER_BYTES];
+    Cab_Blob::write_header(header, {(uint16_t)opt.headroom_shift, opt.rate, (uint32_t)taps.size()});
+    out.write((const char*)header, sizeof(header));
+    for(int16_t tap : taps) {
+        uint8_t le[2] = {(uint8_t)(tap & 0xFF), (uint8_t)((uint16_t)tap >> 8)};
+        out.write((const char*)le, sizeof(le));
+    }
+    return (bool)out;
+}
+
+//=========================== PER-FILE PIPELINE =========================
+
+static std::string compile_one(const fs::path& in_path, const fs::path& out_dir, const Options& opt) {
+    FILE* file = fopen(in_path.string().c_str(), "rb");
+    if(!file) return "couldn't open";
+
+    //read in the entire impulse response
+    File_Wav_Source source(file);
+    Wav_Reader wav(source);
+    if(wav.parse_header() != Wav_Reader::OK) {
+        fclose(file);
+        return "not a supported WAV file";
+    }
+    std::vector<float> raw(wav.get_num_frames());
+    raw.resize(wav.read_frames(raw.data(), raw.size()));
+    fclose(file);
+
+    //resample the whole thing; trimming happens at the target rate
+    std::vector<float> ir(raw.size() * (size_t)opt.rate / wav.get_sample_rate() + 1);
+    ir.resize(IR_Process::resample(raw.data(), raw.size(), wav.get_sample_rate(), ir.data(), ir.size(), opt.rate));
+
+    trim(ir, opt.trim_db);
+    if(opt.min_phase) ir = to_min_phase(ir);
+    truncate(ir, opt.length);
+
+    std::vector<int16_t> taps(ir.size());
+    if(!IR_Process::normalize_to_q15(ir.data(), ir.size(), taps.data(), opt.headroom_shift)) return "impulse response is silent";
+
+    bool ok = opt.header_format ?
+        write_header(out_dir / (in_path.stem().string() + ".h"), in_path.filename().string(), taps, opt) :
+        write_blob(out_dir / (in_path.stem().string() + Cab_Blob::FILE_EXTENSION), taps, opt);
+    if(!ok) return "couldn't write output";
+
+    return "ok, " + std::to_string(taps.size()) + " taps";
+}
+
+//=========================== SELF TEST =========================
+
+//what the firmware's `Cab_IR_Library` expects of a blob (`App_Constants::AUDIO_SAMPLE_RATE_HZ`, `SD_CAB_MAX_TAPS`,
+//and `Effect_Cab_Sim::IMPULSE_POST_SCALE_SHIFT`)
+static constexpr uint32_t FIRMWARE_RATE = 48000;
+static constexpr uint32_t FIRMWARE_MAX_TAPS = 512;
+static constexpr uint32_t FIRMWARE_HEADROOM_SHIFT = 4;
+
+static int test_failures = 0;
+static void check(bool condition, const char* what) {
+    printf("  %s %s\n", condition ? "ok  " : "FAIL", what);
+    if(!condition) test_failures++;
+}
+
+//header of a blob as the firmware would see it, or an invalid one if it doesn't parse
+static bool read_blob_info(const fs::path& path, Cab_Blob::Info& info) {
+    std::ifstream in(path, std::ios::binary);
+    uint8_t header[Cab_Blob::HEADER_BYTES];
+    if(!in.read((char*)header, sizeof(header))) return false;
+    return Cab_Blob::parse_header(header, info);
+}
+
+static bool firmware_accepts(const Cab_Blob::Info& info) {
+    return Cab_Blob::is_compatible(info, FIRMWARE_RATE, FIRMWARE_MAX_TAPS, FIRMWARE_HEADROOM_SHIFT);
+}
+
+static int self_test() {
+    printf("Cab blob self-test:\n");
+    const fs::path dir = fs::temp_directory_path() / "ir_compiler_self_test";
+    fs::create_directories(dir);
+    const std::vector<int16_t> taps = {16384, -8192, 4096, -2048, 1024};
+
+    //blob written with the default options round-trips and loads
+    Options opt;
+    Cab_Blob::Info info = {};
+    check(write_blob(dir / "default.cab", taps, opt) && read_blob_info(dir / "default.cab", info) &&
+            info.headroom_shift == opt.headroom_shift && info.sample_rate == opt.rate && info.num_taps == taps.size(), "header round trip");
+    check(firmware_accepts(info), "default blob accepted");
+
+    //a different headroom shift would play at the wrong gain
+    opt.headroom_shift = 2;
+    check(write_blob(dir / "headroom.cab", taps, opt) && read_blob_info(dir / "headroom.cab", info) && !firmware_accepts(info),
+            "wrong headroom shift rejected");
+    opt.headroom_shift = FIRMWARE_HEADROOM_SHIFT;
+
+    //a different rate would play at the wrong pitch
+    opt.rate = 44100;
+    check(write_blob(dir / "rate.cab", taps, opt) && read_blob_info(dir / "rate.cab", info) && !firmware_accepts(info),
+            "wrong sample rate rejected");
+    opt.rate = FIRMWARE_RATE;
+
+    //tap counts the FIR can't run
+    check(!firmware_accepts({FIRMWARE_HEADROOM_SHIFT, FIRMWARE_RATE, 0}), "empty kernel rejected");
+    check(!firmware_accepts({FIRMWARE_HEADROOM_SHIFT, FIRMWARE_RATE, FIRMWARE_MAX_TAPS + 1}), "too many taps rejected");
+    check(firmware_accepts({FIRMWARE_HEADROOM_SHIFT, FIRMWARE_RATE, FIRMWARE_MAX_TAPS}), "longest kernel accepted");
+
+    //not a blob at all
+    uint8_t header[Cab_Blob::HEADER_BYTES];
+    Cab_Blob::write_header(header, {FIRMWARE_HEADROOM_SHIFT, FIRMWARE_RATE, 1});
+    header[0] = 'X';
+    check(!Cab_Blob::parse_header(header, info), "bad magic rejected");
+
+    fs::remove_all(dir);
+    printf(test_failures ? "FAILED: %d checks\n" : "all passed\n", test_failures);
+    return test_failures ? 1 : 0;
+}
+
+//=========================== MAIN =========================
+
+static void usage() {
+    fprintf(stderr, "usage: ir_compiler <input dir> <output dir> [--format header|blob] [--length N] [--rate HZ]\n"
+                    "                   [--trim-db DB] [--min-phase] [--headroom SHIFT] [--jobs N]\n"
+                    "       ir_compiler --self-test\n");
+}
+
+int main(int argc, char** argv) {
+    if(argc == 2 && strcmp(argv[1], "--self-test") == 0) return self_test();
+    if(argc < 3) {
+        usage();
+        return 1;
+    }
+    const fs::path in_dir = argv[1];
+    const fs::path out_dir = argv[2];
+
+    //parse options
+    Options opt;
+    for(int i = 3; i < argc; i++) {
+        std::string arg = argv[i];
+        bool has_val = i + 1 < argc;
+        if(arg == "--format" && has_val) opt.header_format = std::string(argv[++i]) == "header";
+        else if(arg == "--length" && has_val) { opt.length = std::stoul(argv[++i]); opt.length_set = true; }
+        else if(arg == "--rate" && has_val) opt.rate = std::stoul(argv[++i]);
+        else if(arg == "--trim-db" && has_val) opt.trim_db = std::stof(argv[++i]);
+        else if(arg == "--min-phase") opt.min_phase = true;
+        else if(arg == "--headroom" && has_val) opt.headroom_shift = std::stoul(argv[++i]);
+        else if(arg == "--jobs" && has_val) opt.jobs = std::stoul(argv[++i]);
+        else {
+            usage();
+            return 1;
+        }
+    }
+    if(opt.header_format && (!opt.length_set || opt.length > HEADER_TABLE_TAPS)) opt.length = HEADER_TABLE_TAPS;
+    if(opt.length == 0 || opt.rate == 0 || opt.headroom_shift > 15) {
+        usage();
+        return 1;
+    }
+
+    //collect all the WAV files in the input directory
+    std::vector<fs::path> inputs;
+    for(const auto& entry : fs::directory_iterator(in_dir)) {
+        std::string ext = entry.path().extension().string();
+        for(auto& c : ext) c = tolower((unsigned char)c);
+        if(entry.is_regular_file() && ext == ".wav") inputs.push_back(entry.path());
+    }
+    if(inputs.empty()) {
+        fprintf(stderr, "no WAV files found in %s\n", in_dir.string().c_str());
+        return 1;
+    }
+    fs::create_directories(out_dir);
+
+    //hand files out to worker threads
+    size_t num_jobs = opt.jobs ? opt.jobs : std::max(1u, std::thread::hardware_concurrency());
+    num_jobs = std::min(num_jobs, inputs.size());
+    std::vector<std::string> results(inputs.size());
+    std::atomic<size_t> next_input(0);
+    std::vector<std::thread> workers;
+    for(size_t t = 0; t < num_jobs; t++) {
+        workers.emplace_back([&]() {
+            for(size_t i = next_input++; i < inputs.size(); i = next_input++)
+                results[i] = compile_one(inputs[i], out_dir, opt);
+        });
+    }
+    for(auto& worker : workers) worker.join();
+
+    //report how everything went
+    int failures = 0;
+    for(size_t i = 0; i < inputs.size(); i++) {
+        printf("%s: %s\n", inputs[i].filename().string().c_str(), results[i].c_str());
+        if(results[i].compare(0, 2, "ok") != 0) failures++;
+    }
+    return failures ? 2 : 0;
+}
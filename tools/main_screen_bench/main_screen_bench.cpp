@@ -0,0 +1,264 @@
+/*
+ * Host microbenchmark for the main screen's per-frame render cost
+ * Draws the main screen's layout into an offscreen U8g2 frame buffer a few ways, and times each per frame:
+ *      \--> full redraw: clear, signal pipe (two triangles and a bar), every effect icon and the settings icon, then the selection box
+ *           once with icons copied out of the effects by value (old `get_icon()`), once through a reference (current `get_icon()`)
+ *      \--> cached: copy the pre-rendered background into the frame buffer, then the selection box
+ *           once asking the selected effect for its theme color every frame (old), once using the color cached at chain change (current)
+ * Also times just fetching every effect's icon and theme color, by value vs. by reference
+ *
+ * Layout and sizes match `Main_Screen` (`lib/ui_pages/main_screen.cpp`) and the icon constants in `config.h`
+ *      \--> icon bitmaps are stand-in checkerboards; `drawXBMP()` cost depends on how many pixels are set, real icons are in the same ballpark
+ *      \--> effects are stand-ins with the same metadata accessors as `Effect_Interface`, called through a base pointer
+ *      \--> the parameter text is drawn the same way in both, so it's left out
+ * Also checks that both ways produce exactly the same frame
+ *
+ * Needs a checkout of U8g2 (https://github.com/olikraus/u8g2); only its C sources are used, no display is attached
+ *      \--> the numbers are mostly U8g2's rasterizer, so they only mean something against the real library;
+ *           building against anything else is an error rather than a quietly different benchmark
+ *      \--> no results are recorded for it yet (it's never been run against U8g2), so there's no measured speedup to quote;
+ *           what the cached layer does take out of a frame is the clear, both triangles, the bar and all five bitmaps,
+ *           in exchange for one frame buffer sized copy
+ *
+ * Build (from this directory):
+ *      g++ -std=c++17 -O2 -I$U8G2/csrc main_screen_bench.cpp $U8G2/csrc/u8*.c -o main_screen_bench
+ *
+ * Usage:
+ *      main_screen_bench [frames]      (default 100000)
+ */
+
+#include <array>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+#include <u8g2.h>
+
+//every real `u8g2.h` defines the circle/ellipse section masks, stand-ins usually don't bother
+#ifndef U8G2_DRAW_ALL
+#error "main_screen_bench needs the real U8g2 sources, see the build line at the top of this file"
+#endif
+
+//========================= LAYOUT (mirrors Main_Screen) =========================
+
+static constexpr u8g2_uint_t NUM_EFFECTS = 4;
+static constexpr u8g2_uint_t EFFECT_ICON_WIDTH = 27;
+static constexpr u8g2_uint_t EFFECT_ICON_HEIGHT = 41;
+static constexpr u8g2_uint_t EFFECT_PADDING = 3;
+
+static constexpr u8g2_uint_t SETTINGS_ICON_WIDTH = 23;
+static constexpr u8g2_uint_t SETTINGS_ICON_HEIGHT = 13;
+static constexpr u8g2_uint_t SETTINGS_ICON_X_PADDING = 2;
+static constexpr u8g2_uint_t SETTINGS_ICON_Y_PADDING = 1;
+
+typedef std::array<uint8_t, (EFFECT_ICON_WIDTH + 7) / 8 * EFFECT_ICON_HEIGHT> Effect_Icon_t;
+static Effect_Icon_t effect_icon;
+static Effect_Icon_t effect_icon_alt;
+static std::array<uint8_t, (SETTINGS_ICON_WIDTH + 7) / 8 * SETTINGS_ICON_HEIGHT> settings_icon;
+
+static u8g2_uint_t icon_start_x;
+static u8g2_uint_t icon_start_y;
+
+//========================= STAND-IN EFFECTS =========================
+
+//just the metadata accessors of `Effect_Interface`, old (icon by value) and current (icon by reference)
+struct Color { uint8_t r, g, b; };
+
+class Bench_Effect {
+public:
+    virtual ~Bench_Effect() {}
+    virtual Effect_Icon_t get_icon_copy() = 0;
+    virtual const Effect_Icon_t& get_icon() = 0;
+    virtual Color get_theme_color() = 0;
+};
+
+//two flavors so the compiler can't see through the virtual calls
+class Bench_Effect_A : public Bench_Effect {
+public:
+    Effect_Icon_t get_icon_copy() override { return effect_icon; }
+    const Effect_Icon_t& get_icon() override { return effect_icon; }
+    Color get_theme_color() override { return {255, 0, 0}; }
+};
+class Bench_Effect_B : public Bench_Effect {
+public:
+    Effect_Icon_t get_icon_copy() override { return effect_icon_alt; }
+    const Effect_Icon_t& get_icon() override { return effect_icon_alt; }
+    Color get_theme_color() override { return {0, 0, 255}; }
+};
+
+static std::array<Bench_Effect*, NUM_EFFECTS> effects;
+
+//what the main screen holds onto for each channel, refreshed when the chain changes
+static std::array<const Effect_Icon_t*, NUM_EFFECTS> cached_icons;
+static std::array<Color, NUM_EFFECTS> cached_colors;
+
+//========================= DRAWING =========================
+
+//same shapes as `Main_Screen::render_background()`
+//`copy_icons` fetches each icon by value like the old accessor did, otherwise uses the cached references
+static void draw_background(u8g2_t* u8g2, bool copy_icons) {
+    const u8g2_uint_t width = u8g2_GetDisplayWidth(u8g2);
+    const u8g2_uint_t height = u8g2_GetDisplayHeight(u8g2);
+
+    u8g2_ClearBuffer(u8g2);
+
+    //signal pipe: input triangle, output triangle, bar across the screen
+    const u8g2_uint_t tri_height = 9;
+    const u8g2_uint_t tri_width = 4;
+    const u8g2_uint_t tri_y_mid = height - EFFECT_PADDING - ((EFFECT_ICON_HEIGHT + 1) >> 1);
+    const u8g2_uint_t tri_y_start = tri_y_mid - ((tri_height + 1) >> 1);
+    const u8g2_uint_t tri_y_end = tri_y_mid + ((tri_height + 1) >> 1);
+    u8g2_DrawTriangle(u8g2, 0, tri_y_start, 0, tri_y_end, tri_width, tri_y_mid);
+    u8g2_DrawTriangle(u8g2, width - tri_width - 1, tri_y_start, width - tri_width - 1, tri_y_end, width, tri_y_mid);
+
+    const u8g2_uint_t rect_height = 3;
+    u8g2_DrawBox(u8g2, 0, height - EFFECT_PADDING - ((EFFECT_ICON_HEIGHT + rect_height) >> 1), width - tri_width, rect_height);
+
+    //effect icons
+    const u8g2_uint_t total_icon_width = NUM_EFFECTS * (EFFECT_ICON_WIDTH + EFFECT_PADDING) - EFFECT_PADDING;
+    icon_start_x = (width - total_icon_width) >> 1;
+    icon_start_y = height - EFFECT_ICON_HEIGHT - EFFECT_PADDING;
+    u8g2_uint_t x_coord = icon_start_x;
+    for(u8g2_uint_t i = 0; i < NUM_EFFECTS; i++) {
+        if(copy_icons) {
+            Effect_Icon_t icon = effects[i]->get_icon_copy();
+            u8g2_DrawXBMP(u8g2, x_coord, icon_start_y, EFFECT_ICON_WIDTH, EFFECT_ICON_HEIGHT, icon.data());
+        }
+        else u8g2_DrawXBMP(u8g2, x_coord, icon_start_y, EFFECT_ICON_WIDTH, EFFECT_ICON_HEIGHT, cached_icons[i]->data());
+        x_coord += EFFECT_ICON_WIDTH + EFFECT_PADDING;
+    }
+
+    //settings icon
+    u8g2_DrawXBMP(  u8g2, width - SETTINGS_ICON_WIDTH - SETTINGS_ICON_X_PADDING, SETTINGS_ICON_Y_PADDING,
+                    SETTINGS_ICON_WIDTH, SETTINGS_ICON_HEIGHT, settings_icon.data());
+}
+
+//inverted rounded box around the selected effect, as in `Main_Screen::draw()`
+static void draw_selection(u8g2_t* u8g2, u8g2_uint_t selected) {
+    const u8g2_uint_t icon_expand = (EFFECT_PADDING + 1) >> 1;
+    u8g2_SetDrawColor(u8g2, 2);
+    u8g2_DrawRBox(  u8g2, (icon_start_x - icon_expand) + (EFFECT_ICON_WIDTH + EFFECT_PADDING) * selected, icon_start_y - icon_expand,
+                    EFFECT_ICON_WIDTH + (icon_expand << 1), EFFECT_ICON_HEIGHT + (icon_expand << 1), 1);
+    u8g2_SetDrawColor(u8g2, 1);
+}
+
+//no display attached, so the byte and GPIO callbacks just say "done"
+static uint8_t byte_cb_none(u8x8_t*, uint8_t, uint8_t, void*) { return 1; }
+static uint8_t gpio_cb_none(u8x8_t*, uint8_t, uint8_t, void*) { return 1; }
+
+//========================= MAIN =========================
+
+int main(int argc, char** argv) {
+    const long frames = argc > 1 ? atol(argv[1]) : 100000;
+    if(frames <= 0) {
+        fprintf(stderr, "Usage: %s [frames]\n", argv[0]);
+        return 1;
+    }
+
+    //stand-in icons, half their pixels set
+    for(size_t i = 0; i < effect_icon.size(); i++) effect_icon[i] = (i / ((EFFECT_ICON_WIDTH + 7) / 8)) & 1 ? 0xAA : 0x55;
+    for(size_t i = 0; i < effect_icon_alt.size(); i++) effect_icon_alt[i] = (i / ((EFFECT_ICON_WIDTH + 7) / 8)) & 1 ? 0x55 : 0xAA;
+    for(size_t i = 0; i < settings_icon.size(); i++) settings_icon[i] = (i / ((SETTINGS_ICON_WIDTH + 7) / 8)) & 1 ? 0xAA : 0x55;
+
+    //stand-in effect chain, and what the main screen would cache from it
+    for(size_t i = 0; i < NUM_EFFECTS; i++) {
+        effects[i] = (i + frames) & 1 ? static_cast<Bench_Effect*>(new Bench_Effect_A()) : new Bench_Effect_B();
+        cached_icons[i] = &effects[i]->get_icon();
+        cached_colors[i] = effects[i]->get_theme_color();
+    }
+
+    //same display type as the firmware, full frame buffer
+    u8g2_t u8g2;
+    u8g2_Setup_sh1106_i2c_128x64_noname_f(&u8g2, U8G2_R0, byte_cb_none, gpio_cb_none);
+    uint8_t* frame = u8g2_GetBufferPtr(&u8g2);
+    const size_t frame_bytes = 8 * u8g2_GetBufferTileWidth(&u8g2) * u8g2_GetBufferTileHeight(&u8g2);
+
+    //pre-render the background once, like the page does when the chain changes
+    draw_background(&u8g2, false);
+    std::array<uint8_t, 1024> background;
+    if(frame_bytes > background.size()) {
+        fprintf(stderr, "Frame buffer is %zu bytes, expected at most %zu\n", frame_bytes, background.size());
+        return 1;
+    }
+    memcpy(background.data(), frame, frame_bytes);
+
+    //every way has to end up with the same picture
+    std::array<uint8_t, 1024> reference;
+    for(u8g2_uint_t selected = 0; selected < NUM_EFFECTS; selected++) {
+        draw_background(&u8g2, true);
+        draw_selection(&u8g2, selected);
+        memcpy(reference.data(), frame, frame_bytes);
+
+        draw_background(&u8g2, false);
+        draw_selection(&u8g2, selected);
+        bool same = memcmp(reference.data(), frame, frame_bytes) == 0;
+
+        memcpy(frame, background.data(), frame_bytes);
+        draw_selection(&u8g2, selected);
+        same = same && memcmp(reference.data(), frame, frame_bytes) == 0;
+
+        if(!same) {
+            fprintf(stderr, "Frames differ between render paths with effect %u selected\n", (unsigned)selected);
+            return 1;
+        }
+    }
+
+    //time each way, cycling the selection like someone turning the main knob
+    using clock = std::chrono::steady_clock;
+    uint32_t checksum = 0; //keeps the compiler from throwing the frames away
+
+    auto time_ns = [&](auto&& render_frame) {
+        auto start = clock::now();
+        for(long i = 0; i < frames; i++) {
+            render_frame(i);
+            checksum += frame[i % frame_bytes];
+        }
+        return std::chrono::duration<double, std::nano>(clock::now() - start).count() / frames;
+    };
+
+    const double full_copy_ns = time_ns([&](long i) {
+        draw_background(&u8g2, true);
+        draw_selection(&u8g2, i % NUM_EFFECTS);
+    });
+    const double full_ref_ns = time_ns([&](long i) {
+        draw_background(&u8g2, false);
+        draw_selection(&u8g2, i % NUM_EFFECTS);
+    });
+    const double cached_query_ns = time_ns([&](long i) {
+        memcpy(frame, background.data(), frame_bytes);
+        Color color = effects[i % NUM_EFFECTS]->get_theme_color(); //what the LED gets set to
+        checksum += color.r;
+        draw_selection(&u8g2, i % NUM_EFFECTS);
+    });
+    const double cached_ns = time_ns([&](long i) {
+        memcpy(frame, background.data(), frame_bytes);
+        checksum += cached_colors[i % NUM_EFFECTS].r;
+        draw_selection(&u8g2, i % NUM_EFFECTS);
+    });
+
+    //and just the metadata, every effect's icon and color once per frame
+    const double meta_copy_ns = time_ns([&](long i) {
+        for(Bench_Effect* effect : effects) {
+            Effect_Icon_t icon = effect->get_icon_copy();
+            checksum += icon[i % icon.size()] + effect->get_theme_color().g;
+        }
+    });
+    const double meta_ref_ns = time_ns([&](long i) {
+        for(Bench_Effect* effect : effects) {
+            const Effect_Icon_t& icon = effect->get_icon();
+            checksum += icon[i % icon.size()] + effect->get_theme_color().g;
+        }
+    });
+
+    printf("%ld frames, %zu byte frame buffer, %zu byte icons\n", frames, frame_bytes, sizeof(Effect_Icon_t));
+    printf("  full redraw, icons by value:      %10.1f ns/frame\n", full_copy_ns);
+    printf("  full redraw, icons by reference:  %10.1f ns/frame\n", full_ref_ns);
+    printf("  cached layer, color queried:      %10.1f ns/frame\n", cached_query_ns);
+    printf("  cached layer, color cached:       %10.1f ns/frame\n", cached_ns);
+    printf("  metadata fetch, by value:         %10.1f ns/frame\n", meta_copy_ns);
+    printf("  metadata fetch, by reference:     %10.1f ns/frame\n", meta_ref_ns);
+    printf("(checksum %u)\n", (unsigned)checksum);
+    for(Bench_Effect* effect : effects) delete effect;
+    return 0;
+}
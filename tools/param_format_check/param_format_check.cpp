@@ -0,0 +1,177 @@
+/*
+ * Host check for the parameter value formatter (`lib/effect_params/param_format.h`)
+ *      \--> formats a table of values and compares against the expected text (rounding, negatives, clamping, units, truncation)
+ *      \--> formats a few parameters the way the effects declare them (decimals + `App_Strings` units)
+ *      \--> replaces the global `operator new`/`malloc` counters, then runs a simulated render loop
+ *           (every parameter's value text fetched every frame, values changing like someone turning knobs)
+ *           and checks that it made zero heap allocations
+ *
+ * Build (from this directory):
+ *      g++ -std=c++17 -O2 -I../host_shim -I../../lib/config -I../../lib/utils -I../../lib/rgb_led -I../../lib/effect_params \
+ *          param_format_check.cpp ../../lib/effect_params/param_format.cpp -o param_format_check
+ *
+ * Usage:
+ *      param_format_check [frames]     (default 100000)
+ * Exits non-zero if anything fails
+ */
+
+#include <array>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <new>
+
+#include <param_format.h>
+#include <app_strings.h> //units the effects pass to their parameters
+
+//========================= ALLOCATION COUNTING =========================
+
+static size_t allocation_count = 0;
+
+void* operator new(size_t size) {
+    allocation_count++;
+    void* ptr = malloc(size == 0 ? 1 : size);
+    if(ptr == nullptr) throw std::bad_alloc();
+    return ptr;
+}
+void* operator new[](size_t size) { return operator new(size); }
+void operator delete(void* ptr) noexcept { free(ptr); }
+void operator delete[](void* ptr) noexcept { free(ptr); }
+void operator delete(void* ptr, size_t) noexcept { free(ptr); }
+void operator delete[](void* ptr, size_t) noexcept { free(ptr); }
+
+//========================= FORMATTING CASES =========================
+
+struct Format_Case {
+    float value;
+    uint8_t decimals;
+    const char* units;
+    size_t buf_size;
+    const char* expected;
+};
+
+static const Format_Case FORMAT_CASES[] = {
+    {0.0f,          1, "",      16, "0.0"},
+    {1.0f,          1, "",      16, "1.0"},
+    {1.04f,         1, "",      16, "1.0"},
+    {1.05f,         1, "",      16, "1.1"},     //1.05f is a hair above 1.05
+    {0.96f,         1, "",      16, "1.0"},     //rounding carries into the integer part
+    {-12.34f,       1, "dB",    16, "-12.3dB"},
+    {-0.04f,        1, "dB",    16, "0.0dB"},   //rounds to zero, no sign
+    {440.0f,        0, "Hz",    16, "440Hz"},
+    {19999.6f,      0, "Hz",    16, "20000Hz"},
+    {50.0f,         0, "%",     16, "50%"},
+    {3.14159f,      3, "",      16, "3.142"},
+    {2.5f,          9, "",      16, "2.5000"},  //decimals clamped to MAX_DECIMALS
+    {1e12f,         0, "",      16, "4294967040"}, //clamped to the fixed point range
+    {-123.45f,      2, "ms",    6,  "-123."},   //truncated to the buffer
+    {7.0f,          1, "",      1,  ""},
+};
+
+static bool check_formatting() {
+    bool ok = true;
+    for(const Format_Case& c : FORMAT_CASES) {
+        std::array<char, 32> buf;
+        buf.fill('#');
+        size_t len = Param_Format::format(buf.data(), c.buf_size, c.value, c.decimals, c.units);
+        bool pass = strcmp(buf.data(), c.expected) == 0 && len == strlen(c.expected);
+        if(!pass) {
+            printf("FAIL: format(%g, %u decimals, \"%s\", %zu bytes) gave \"%s\" (%zu), expected \"%s\"\n",
+                    c.value, (unsigned)c.decimals, c.units, c.buf_size, buf.data(), len, c.expected);
+            ok = false;
+        }
+    }
+
+    //cache should only report a change when the value actually changes
+    Param_Value_Text text(1, "Hz");
+    bool cache_ok = text.update(100.0f) && strcmp(text.c_str(), "100.0Hz") == 0 && !text.update(100.0f) &&
+                    text.update(101.0f) && strcmp(text.c_str(), "101.0Hz") == 0;
+    if(!cache_ok) {
+        printf("FAIL: Param_Value_Text didn't track value changes\n");
+        ok = false;
+    }
+
+    return ok;
+}
+
+//========================= EFFECT PARAMETERS =========================
+
+//same decimals and units as the parameter declarations in the effects
+struct Param_Case {
+    const char* name;
+    uint8_t decimals;
+    App_String units;
+    float value;
+    const char* expected;
+};
+
+static const Param_Case PARAM_CASES[] = {
+    {"EQ gain",             1, App_Strings::UNITS_DB,       -11.5f, "-11.5dB"},
+    {"delay time",          0, App_Strings::UNITS_MS,       350.0f, "350ms"},
+    {"mod delay rate",      2, App_Strings::UNITS_HZ,       0.05f,  "0.05Hz"},
+    {"compressor ratio",    1, App_Strings::UNITS_RATIO,    4.0f,   "4.0:1"},
+    {"gate threshold",      0, App_Strings::UNITS_DB,       -55.0f, "-55dB"},
+    {"reverb decay",        1, App_Strings::UNITS_S,        1.5f,   "1.5s"},
+};
+
+static bool check_effect_params() {
+    bool ok = true;
+    for(const Param_Case& c : PARAM_CASES) {
+        Param_Value_Text text(c.decimals, c.units.c_str());
+        text.update(c.value);
+        if(strcmp(text.c_str(), c.expected) != 0) {
+            printf("FAIL: %s showed \"%s\", expected \"%s\"\n", c.name, text.c_str(), c.expected);
+            ok = false;
+        }
+    }
+    return ok;
+}
+
+//========================= RENDER LOOP =========================
+
+//roughly what an effect edit page does: every parameter's text fetched every frame, a knob moving now and then
+static bool check_render_loop(long frames) {
+    static constexpr size_t NUM_PARAMS = 5;
+    std::array<Param_Value_Text, NUM_PARAMS> texts = {
+        Param_Value_Text(1, ""), Param_Value_Text(0, "Hz"), Param_Value_Text(1, "dB"), Param_Value_Text(0, "%"), Param_Value_Text(2, "ms")
+    };
+    std::array<float, NUM_PARAMS> values = {1.0f, 440.0f, -6.0f, 50.0f, 12.5f};
+
+    size_t allocations_before = allocation_count;
+    size_t reformats = 0;
+    size_t checksum = 0; //keeps the compiler from throwing the text away
+    for(long frame = 0; frame < frames; frame++) {
+        //a knob turns every few frames
+        if(frame % 3 == 0) values[frame % NUM_PARAMS] += (frame & 8) ? 0.1f : -0.1f;
+
+        for(size_t i = 0; i < NUM_PARAMS; i++) {
+            if(texts[i].update(values[i])) reformats++;
+            checksum += (unsigned char)texts[i].c_str()[0];
+        }
+    }
+    size_t allocations = allocation_count - allocations_before;
+
+    printf("%ld frames x %zu parameters: %zu reformats, %zu heap allocations (checksum %zu)\n",
+            frames, NUM_PARAMS, reformats, allocations, checksum);
+    if(allocations != 0) {
+        printf("FAIL: render loop allocated\n");
+        return false;
+    }
+    return true;
+}
+
+//========================= MAIN =========================
+
+int main(int argc, char** argv) {
+    const long frames = argc > 1 ? atol(argv[1]) : 100000;
+    if(frames <= 0) {
+        fprintf(stderr, "Usage: %s [frames]\n", argv[0]);
+        return 1;
+    }
+
+    bool ok = check_formatting();
+    ok = check_effect_params() && ok;
+    ok = check_render_loop(frames) && ok;
+    printf(ok ? "PASS\n" : "FAILED\n");
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,125 @@
+/*
+ * Command-line front end for the remote-control client
+ * Controls the pedal (or `remote_sim`) over its USB serial port
+ *
+ * Build (from this directory):
+ *      g++ -std=c++17 -O2 -I. -I../../lib/remote remote_cli.cpp remote_client.cpp ../../lib/remote/remote_protocol.cpp -o remote_cli
+ *
+ * Usage:
+ *      remote_cli [--port DEV] <command>
+ *          info                        protocol version, chain shape, CPU budget per block
+ *          effects                     list the effects that can be loaded
+ *          slots                       what's loaded in every slot, with its parameters
+ *          replace SLOT EFFECT         load an effect (by index in `effects`) into a slot
+ *          get SLOT PARAM              read a parameter
+ *          set SLOT PARAM VALUE        write a parameter (prints the value it landed on)
+ *          perf [--reset]              CPU cycles per slot (last block and peak), optionally resetting the peaks
+ */
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include <unistd.h>
+
+#include <remote_client.h>
+
+static void usage() {
+    fprintf(stderr, "usage: remote_cli [--port DEV] info | effects | slots | replace SLOT EFFECT | get SLOT PARAM | "
+                    "set SLOT PARAM VALUE | perf [--reset]\n");
+}
+
+//say why a call failed
+static int fail(Remote_Client& client, const char* what) {
+    if(client.timed_out()) fprintf(stderr, "%s: no response\n", what);
+    else fprintf(stderr, "%s: failed with status %u\n", what, (unsigned)client.get_last_status());
+    return 1;
+}
+
+static void print_param(uint8_t param, const Remote_Client::Param_Info& p) {
+    printf("    [%u] %-8s %g (%g to %g)\n", (unsigned)param, p.label.c_str(), p.value, p.min, p.max);
+}
+
+int main(int argc, char** argv) {
+    std::string port = "/dev/ttyACM0";
+    int arg = 1;
+    if(arg + 1 < argc && strcmp(argv[arg], "--port") == 0) {
+        port = argv[arg + 1];
+        arg += 2;
+    }
+    if(arg >= argc) {
+        usage();
+        return 1;
+    }
+    std::string command = argv[arg++];
+    std::vector<std::string> args(argv + arg, argv + argc);
+
+    int fd = Fd_Transport::open_serial(port);
+    if(fd < 0) {
+        fprintf(stderr, "Couldn't open %s\n", port.c_str());
+        return 1;
+    }
+    Fd_Transport transport(fd);
+    Remote_Client client(transport);
+
+    //everything needs the shape of the chain
+    Remote_Client::Info info;
+    if(!client.get_info(info)) return fail(client, "info");
+
+    if(command == "info") {
+        printf("Protocol version %u: %u slots, %u effects available, %u parameters per slot, %u CPU cycles per block\n",
+                info.version, info.num_slots, info.num_effects, info.params_per_slot, info.cycles_per_block);
+    }
+    else if(command == "effects") {
+        for(uint8_t e = 0; e < info.num_effects; e++) {
+            std::string name;
+            if(!client.get_effect_name(e, name)) return fail(client, "effects");
+            printf("[%u] %s\n", (unsigned)e, name.c_str());
+        }
+    }
+    else if(command == "slots") {
+        for(uint8_t s = 0; s < info.num_slots; s++) {
+            uint8_t effect;
+            std::string name = "?";
+            if(client.get_slot(s, effect)) client.get_effect_name(effect, name);
+            printf("Slot %u: %s\n", (unsigned)s, name.c_str());
+
+            //parameters can have gaps, so try every index
+            for(uint8_t p = 0; p < info.params_per_slot; p++) {
+                Remote_Client::Param_Info param;
+                if(client.get_param(s, p, param)) print_param(p, param);
+            }
+        }
+    }
+    else if(command == "replace" && args.size() == 2) {
+        if(!client.replace_slot(atoi(args[0].c_str()), atoi(args[1].c_str()))) return fail(client, "replace");
+    }
+    else if(command == "get" && args.size() == 2) {
+        Remote_Client::Param_Info param;
+        uint8_t p = atoi(args[1].c_str());
+        if(!client.get_param(atoi(args[0].c_str()), p, param)) return fail(client, "get");
+        print_param(p, param);
+    }
+    else if(command == "set" && args.size() == 3) {
+        float actual;
+        if(!client.set_param(atoi(args[0].c_str()), atoi(args[1].c_str()), atof(args[2].c_str()), &actual)) return fail(client, "set");
+        printf("%g\n", actual);
+    }
+    else if(command == "perf") {
+        std::vector<Remote_Client::Perf> perf;
+        bool reset = !args.empty() && args[0] == "--reset";
+        if(!client.get_perf(perf, reset)) return fail(client, "perf");
+        for(size_t s = 0; s < perf.size(); s++)
+            printf("Slot %u: %u cycles (peak %u, %.1f%%)\n", (unsigned)s, perf[s].cycles, perf[s].peak_cycles,
+                    100.0 * perf[s].peak_cycles / info.cycles_per_block);
+    }
+    else {
+        usage();
+        return 1;
+    }
+
+    close(fd);
+    return 0;
+}
@@ -0,0 +1,199 @@
+#include <remote_client.h>
+
+#include <chrono>
+
+#include <fcntl.h>
+#include <poll.h>
+#include <termios.h>
+#include <unistd.h>
+
+using namespace Remote_Protocol;
+using Clock = std::chrono::steady_clock;
+
+//=========================== TRANSPORT =========================
+
+bool Fd_Transport::write(const uint8_t* data, size_t len) {
+    while(len > 0) {
+        ssize_t n = ::write(fd, data, len);
+        if(n <= 0) return false;
+        data += n;
+        len -= n;
+    }
+    return true;
+}
+
+int Fd_Transport::read(uint8_t* data, size_t max_len, int timeout_ms) {
+    pollfd pfd = {fd, POLLIN, 0};
+    int ready = poll(&pfd, 1, timeout_ms);
+    if(ready <= 0) return ready;
+    return ::read(fd, data, max_len);
+}
+
+//raw mode, nothing translated; USB CDC ignores the baud rate anyway
+int Fd_Transport::open_serial(const std::string& path) {
+    int fd = open(path.c_str(), O_RDWR | O_NOCTTY);
+    if(fd < 0) return -1;
+
+    termios tty;
+    if(tcgetattr(fd, &tty) == 0) {
+        cfmakeraw(&tty);
+        tcsetattr(fd, TCSANOW, &tty);
+    }
+    return fd;
+}
+
+//=========================== CLIENT =========================
+
+bool Remote_Client::transact(Message& request, Message& response) {
+    last_status = STATUS_OK;
+    last_timed_out = false;
+
+    request.sequence = next_sequence++;
+    uint8_t encoded[MAX_ENCODED];
+    size_t encoded_len = encode(request, encoded);
+    if(!transport.write(encoded, encoded_len)) return false;
+
+    //skip over anything that isn't our response
+    Clock::time_point deadline = Clock::now() + std::chrono::milliseconds(timeout_ms);
+    uint8_t buf[256];
+    while(true) {
+        int remaining_ms = std::chrono::duration_cast<std::chrono::milliseconds>(deadline - Clock::now()).count();
+        if(remaining_ms <= 0) break;
+        int n = transport.read(buf, sizeof(buf), remaining_ms);
+        if(n < 0) return false;
+
+        for(int i = 0; i < n; i++) {
+            if(!decoder.feed(buf[i])) continue;
+            const Message& m = decoder.get_message();
+            if(m.command != (request.command | RESPONSE_FLAG) || m.sequence != request.sequence || m.length < 1) continue;
+
+            //bytes after this in `buf` belong to whatever comes next, which we don't care about yet
+            response = m;
+            last_status = (Status)response.payload[0];
+            return last_status == STATUS_OK;
+        }
+    }
+
+    last_timed_out = true;
+    return false;
+}
+
+bool Remote_Client::get_info(Info& info) {
+    Message request, response;
+    request.command = CMD_GET_INFO;
+    if(!transact(request, response)) return false;
+
+    Payload_Reader in(response, 1);
+    info.version = in.get_u8();
+    info.num_slots = in.get_u8();
+    info.num_effects = in.get_u8();
+    info.params_per_slot = in.get_u8();
+    info.cycles_per_block = in.get_u32();
+    return !in.underflowed();
+}
+
+bool Remote_Client::get_effect_name(uint8_t effect, std::string& name) {
+    Message request, response;
+    request.command = CMD_GET_EFFECT_NAME;
+    Payload_Writer out(request);
+    out.put_u8(effect);
+    if(!transact(request, response)) return false;
+
+    char buf[MAX_NAME + 1];
+    Payload_Reader in(response, 1);
+    in.get_string(buf, sizeof(buf));
+    name = buf;
+    return !in.underflowed();
+}
+
+bool Remote_Client::get_slot(uint8_t slot, uint8_t& effect) {
+    Message request, response;
+    request.command = CMD_GET_SLOT;
+    Payload_Writer out(request);
+    out.put_u8(slot);
+    if(!transact(request, response)) return false;
+
+    Payload_Reader in(response, 1);
+    effect = in.get_u8();
+    return !in.underflowed();
+}
+
+bool Remote_Client::replace_slot(uint8_t slot, uint8_t effect) {
+    Message request, response;
+    request.command = CMD_REPLACE_SLOT;
+    Payload_Writer out(request);
+    out.put_u8(slot);
+    out.put_u8(effect);
+    return transact(request, response);
+}
+
+bool Remote_Client::get_param(uint8_t slot, uint8_t param, Param_Info& info) {
+    Message request, response;
+    request.command = CMD_GET_PARAM;
+    Payload_Writer out(request);
+    out.put_u8(slot);
+    out.put_u8(param);
+    if(!transact(request, response)) return false;
+
+    char buf[MAX_NAME + 1];
+    Payload_Reader in(response, 1);
+    info.value = in.get_f32();
+    info.min = in.get_f32();
+    info.max = in.get_f32();
+    in.get_string(buf, sizeof(buf));
+    info.label = buf;
+    return !in.underflowed();
+}
+
+bool Remote_Client::set_param(uint8_t slot, uint8_t param, float value, float* actual) {
+    Message request, response;
+    request.command = CMD_SET_PARAM;
+    Payload_Writer out(request);
+    out.put_u8(slot);
+    out.put_u8(param);
+    out.put_f32(value);
+    if(!transact(request, response)) return false;
+
+    Payload_Reader in(response, 1);
+    float v = in.get_f32();
+    if(actual) *actual = v;
+    return !in.underflowed();
+}
+
+bool Remote_Client::get_perf(std::vector<Perf>& perf, bool reset_peaks) {
+    Message request, response;
+    request.command = CMD_GET_PERF;
+    Payload_Writer out(request);
+    out.put_u8(reset_peaks ? 1 : 0);
+    if(!transact(request, response)) return false;
+
+    Payload_Reader in(response, 1);
+    perf.clear();
+    while(in.remaining() >= 8) {
+        Perf p;
+        p.cycles = in.get_u32();
+        p.peak_cycles = in.get_u32();
+        perf.push_back(p);
+    }
+    return true;
+}
+
+bool Remote_Client::start_capture(uint8_t tap_point) {
+    Message request, response;
+    request.command = CMD_CAPTURE_START;
+    Payload_Writer out(request);
+    out.put_u8(tap_point);
+    return transact(request, response);
+}
+
+bool Remote_Client::stop_capture() {
+    Message request, response;
+    request.command = CMD_CAPTURE_STOP;
+    return transact(request, response);
+}
+
+bool Remote_Client::start_throughput_test() {
+    Message request, response;
+    request.command = CMD_THROUGHPUT_TEST;
+    return transact(request, response);
+}
@@ -0,0 +1,94 @@
+#pragma once
+
+/*
+ * Host-side client library for the remote-control protocol (see `lib/remote/remote_protocol.h`)
+ *
+ * `Remote_Client` turns each protocol command into a blocking call:
+ *      \--> sends the request, then reads until the matching response (same command + sequence number) shows up or it times out
+ *      \--> anything else on the line (capture frames, debug prints, stale responses) is skipped over by the frame decoder
+ *      \--> every call returns true on success; `get_last_status()` says why a call failed
+ *
+ * Talks through a `Transport`, so it works the same over the real serial port, a pty, or a socket
+ */
+
+#include <stdint.h>
+#include <string>
+#include <vector>
+
+#include <remote_protocol.h>
+
+//something to move bytes to and from the device
+class Transport {
+public:
+    virtual ~Transport() {}
+    virtual bool write(const uint8_t* data, size_t len) = 0;
+
+    //read up to `max_len` bytes, waiting at most `timeout_ms` for the first one; returns the number read (0 on timeout, <0 on error)
+    virtual int read(uint8_t* data, size_t max_len, int timeout_ms) = 0;
+};
+
+//transport over a POSIX file descriptor (serial port, pty, socket)
+class Fd_Transport : public Transport {
+public:
+    Fd_Transport(int _fd): fd(_fd) {}
+    bool write(const uint8_t* data, size_t len) override;
+    int read(uint8_t* data, size_t max_len, int timeout_ms) override;
+
+    //open a serial device (or pty) in raw mode; returns the descriptor, or -1
+    static int open_serial(const std::string& path);
+
+private:
+    int fd;
+};
+
+class Remote_Client {
+public:
+    struct Info {
+        uint8_t version;
+        uint8_t num_slots;
+        uint8_t num_effects;
+        uint8_t params_per_slot;
+        uint32_t cycles_per_block;
+    };
+
+    struct Param_Info {
+        float value;
+        float min;
+        float max;
+        std::string label;
+    };
+
+    struct Perf {
+        uint32_t cycles;
+        uint32_t peak_cycles;
+    };
+
+    Remote_Client(Transport& _transport, int _timeout_ms = 1000): transport(_transport), timeout_ms(_timeout_ms) {}
+
+    bool get_info(Info& info);
+    bool get_effect_name(uint8_t effect, std::string& name);
+    bool get_slot(uint8_t slot, uint8_t& effect);
+    bool replace_slot(uint8_t slot, uint8_t effect);
+    bool get_param(uint8_t slot, uint8_t param, Param_Info& info);
+    bool set_param(uint8_t slot, uint8_t param, float value, float* actual = nullptr);
+    bool get_perf(std::vector<Perf>& perf, bool reset_peaks = false);
+    bool start_capture(uint8_t tap_point);
+    bool stop_capture();
+    bool start_throughput_test();
+
+    //why the last call failed (`STATUS_OK` if it timed out or the transport failed)
+    inline Remote_Protocol::Status get_last_status() { return last_status; }
+    inline bool timed_out() { return last_timed_out; }
+
+private:
+    Transport& transport;
+    const int timeout_ms;
+    uint8_t next_sequence = 0;
+    Remote_Protocol::Frame_Decoder decoder;
+    Remote_Protocol::Status last_status = Remote_Protocol::STATUS_OK;
+    bool last_timed_out = false;
+
+    //send `request` (sequence number filled in here) and wait for its response
+    //true if a response came back with `STATUS_OK`; response payload is left after the status byte
+    bool transact(Remote_Protocol::Message& request, Remote_Protocol::Message& response);
+};
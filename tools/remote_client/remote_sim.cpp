@@ -0,0 +1,334 @@
+/*
+ * Stand-in for the pedal's remote-control port, so the protocol and the client can be exercised on Linux without hardware
+ *
+ * Runs the same `Remote_Server` the firmware does, on top of a simulated chain (a handful of fake effects with parameters)
+ *      \--> default: opens a pseudo-terminal and prints its path; point `remote_cli --port` (or anything else) at it
+ *      \--> `--self-test`: connects a `Remote_Client` to the server through a socket pair and runs every command,
+ *              including malformed frames, out-of-range requests, and responses sent right behind capture frames;
+ *              exits non-zero if anything doesn't come back as expected
+ *
+ * Build (from this directory):
+ *      g++ -std=c++17 -O2 -pthread -I. -I../../lib/remote -I../../lib/usb_capture remote_sim.cpp remote_client.cpp \
+ *          ../../lib/remote/remote_protocol.cpp ../../lib/remote/remote_server.cpp ../../lib/usb_capture/capture_frame.cpp -o remote_sim
+ *
+ * Usage:
+ *      remote_sim [--self-test]
+ */
+
+#include <algorithm>
+#include <array>
+#include <cerrno>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <fcntl.h>
+#include <poll.h>
+#include <sys/socket.h>
+#include <termios.h>
+#include <unistd.h>
+
+#include <remote_server.h>
+#include <remote_client.h>
+#include <capture_frame.h>
+
+//=========================== SIMULATED CHAIN =========================
+
+//a fake effect: a name and up to `PARAMS_PER_SLOT` parameters
+struct Sim_Param {
+    const char* label;
+    float min;
+    float max;
+    float step;
+    float default_value;
+};
+
+struct Sim_Effect {
+    const char* name;
+    std::vector<Sim_Param> params;
+};
+
+static const std::vector<Sim_Effect> SIM_EFFECTS = {
+    {"Passthrough", {}},
+    {"Volume", {{"Vol", -40, 12, 0.5f, 0}}},
+    {"Overdrive", {{"Drive", 0, 40, 1, 12}, {"Curve", 0, 2, 1, 0}}},
+    {"Delay", {{"Time", 10, 1000, 10, 350}, {"Fdbk", 0, 95, 1, 40}, {"Mix", 0, 100, 1, 30}}},
+};
+
+class Sim_Target : public Remote_Target {
+public:
+    static constexpr uint8_t NUM_SLOTS = 4;
+    static constexpr uint8_t PARAMS_PER_SLOT = 5;
+    static constexpr uint32_t CYCLES_PER_BLOCK = 1600000; //600MHz, 128 samples at 48kHz
+
+    Sim_Target() { for(uint8_t s = 0; s < NUM_SLOTS; s++) replace_slot(s, 0); }
+
+    uint8_t get_num_slots() override { return NUM_SLOTS; }
+    uint8_t get_num_effects() override { return SIM_EFFECTS.size(); }
+    uint8_t get_params_per_slot() override { return PARAMS_PER_SLOT; }
+    uint32_t get_cycles_per_block() override { return CYCLES_PER_BLOCK; }
+
+    void get_effect_name(uint8_t effect, char* name) override {
+        strncpy(name, SIM_EFFECTS[effect].name, Remote_Protocol::MAX_NAME);
+    }
+
+    bool get_slot_effect(uint8_t slot, uint8_t& effect) override {
+        effect = slots[slot].effect;
+        return true;
+    }
+
+    //fresh instance, parameters back at their defaults
+    void replace_slot(uint8_t slot, uint8_t effect) override {
+        slots[slot].effect = effect;
+        const std::vector<Sim_Param>& params = SIM_EFFECTS[effect].params;
+        for(size_t p = 0; p < params.size(); p++) slots[slot].values[p] = params[p].default_value;
+    }
+
+    bool get_param(uint8_t slot, uint8_t param, float& value, float& min, float& max, char* label) override {
+        const Sim_Param* p = lookup(slot, param);
+        if(!p) return false;
+        value = slots[slot].values[param];
+        min = p->min;
+        max = p->max;
+        strncpy(label, p->label, Remote_Protocol::MAX_NAME);
+        return true;
+    }
+
+    //clamp and snap to the step like the real parameters do
+    bool set_param(uint8_t slot, uint8_t param, float value, float& actual) override {
+        const Sim_Param* p = lookup(slot, param);
+        if(!p) return false;
+        value = std::min(std::max(value, p->min), p->max);
+        actual = p->min + std::round((value - p->min) / p->step) * p->step;
+        slots[slot].values[param] = actual;
+        return true;
+    }
+
+    //made-up but stable numbers: more parameters --> more cycles
+    void get_perf(uint8_t slot, uint32_t& cycles, uint32_t& peak_cycles) override {
+        cycles = 2000 + 15000 * SIM_EFFECTS[slots[slot].effect].params.size();
+        peak_cycles = peaks_reset ? cycles : cycles + 500;
+    }
+    void reset_perf_peaks() override { peaks_reset = true; }
+
+    bool start_capture(uint8_t tap_point) override {
+        if(tap_point > NUM_SLOTS) return false;
+        capturing = true;
+        return true;
+    }
+    void stop_capture() override { capturing = false; }
+    void start_throughput_test() override {}
+
+    bool capturing = false;
+
+private:
+    struct Slot {
+        uint8_t effect = 0;
+        std::array<float, PARAMS_PER_SLOT> values = {0};
+    };
+    std::array<Slot, NUM_SLOTS> slots;
+    bool peaks_reset = false;
+
+    const Sim_Param* lookup(uint8_t slot, uint8_t param) {
+        const std::vector<Sim_Param>& params = SIM_EFFECTS[slots[slot].effect].params;
+        return param < params.size() ? &params[param] : nullptr;
+    }
+};
+
+//pump bytes from `fd` through the server until the other end goes away (or `stop` is set)
+static void serve(int fd, Remote_Server& server, const volatile bool& stop) {
+    uint8_t buf[256];
+    uint8_t response[Remote_Protocol::MAX_ENCODED];
+    while(!stop) {
+        pollfd pfd = {fd, POLLIN, 0};
+        if(poll(&pfd, 1, 50) <= 0) continue;
+        ssize_t n = read(fd, buf, sizeof(buf));
+        if(n <= 0) {
+            //pty master reads fail while nothing has the slave open; just wait for a client
+            if(n < 0 && errno == EIO) {
+                usleep(50000);
+                continue;
+            }
+            return;
+        }
+        for(ssize_t i = 0; i < n; i++) {
+            size_t len = server.feed(buf[i], response);
+            if(len > 0 && write(fd, response, len) != (ssize_t)len) return;
+        }
+    }
+}
+
+//=========================== SELF TEST =========================
+
+static int failures = 0;
+static void check(bool condition, const char* what) {
+    printf("  %s %s\n", condition ? "ok  " : "FAIL", what);
+    if(!condition) failures++;
+}
+
+static int self_test() {
+    int fds[2];
+    if(socketpair(AF_UNIX, SOCK_STREAM, 0, fds) != 0) {
+        perror("socketpair");
+        return 1;
+    }
+
+    Sim_Target target;
+    Remote_Server server(target);
+    volatile bool stop = false;
+    std::thread server_thread(serve, fds[1], std::ref(server), std::cref(stop));
+
+    Fd_Transport transport(fds[0]);
+    Remote_Client client(transport, 500);
+    printf("Remote protocol self-test:\n");
+
+    Remote_Client::Info info;
+    check(client.get_info(info) && info.version == Remote_Protocol::VERSION && info.num_slots == Sim_Target::NUM_SLOTS
+            && info.num_effects == SIM_EFFECTS.size() && info.cycles_per_block == Sim_Target::CYCLES_PER_BLOCK, "get info");
+
+    std::string name;
+    bool names_ok = true;
+    for(uint8_t e = 0; e < SIM_EFFECTS.size(); e++)
+        names_ok &= client.get_effect_name(e, name) && name == SIM_EFFECTS[e].name;
+    check(names_ok, "list effects");
+    check(!client.get_effect_name(SIM_EFFECTS.size(), name) && client.get_last_status() == Remote_Protocol::STATUS_BAD_INDEX,
+            "effect index out of range");
+
+    uint8_t effect = 0xFF;
+    check(client.replace_slot(2, 3) && client.get_slot(2, effect) && effect == 3, "replace slot");
+    check(!client.replace_slot(Sim_Target::NUM_SLOTS, 0) && client.get_last_status() == Remote_Protocol::STATUS_BAD_INDEX,
+            "slot out of range");
+
+    Remote_Client::Param_Info param;
+    check(client.get_param(2, 0, param) && param.label == "Time" && param.value == 350 && param.min == 10 && param.max == 1000,
+            "get parameter");
+    float actual = 0;
+    check(client.set_param(2, 0, 503, &actual) && actual == 500, "set parameter (snapped to step)");
+    check(client.set_param(2, 1, 500, &actual) && actual == 95, "set parameter (clamped)");
+    check(client.get_param(2, 0, param) && param.value == 500, "parameter reads back");
+    check(!client.get_param(2, 4, param) && client.get_last_status() == Remote_Protocol::STATUS_BAD_INDEX, "missing parameter");
+
+    std::vector<Remote_Client::Perf> perf;
+    check(client.get_perf(perf, true) && perf.size() == Sim_Target::NUM_SLOTS && perf[2].peak_cycles > perf[2].cycles, "perf counters");
+    check(client.get_perf(perf) && perf[2].peak_cycles == perf[2].cycles, "perf peaks reset");
+
+    check(client.start_capture(Sim_Target::NUM_SLOTS) && target.capturing, "start capture");
+    check(client.stop_capture() && !target.capturing, "stop capture");
+    check(!client.start_capture(Sim_Target::NUM_SLOTS + 1), "capture tap out of range");
+
+    //garbage, a corrupted frame, and a wrong-length request in front of a good one --> server resyncs and carries on
+    //the half-finished frame at the end of the garbage gets cut off by the corrupted frame's leading zero, so that's 3 errors
+    uint32_t errors_before = server.get_error_count();
+    Remote_Protocol::Message bad;
+    bad.command = Remote_Protocol::CMD_GET_INFO;
+    uint8_t encoded[Remote_Protocol::MAX_ENCODED];
+    size_t len = Remote_Protocol::encode(bad, encoded);
+    encoded[2] ^= 0x40; //command byte, after the leading zero and the first code byte
+    const uint8_t garbage[] = {'h', 'e', 'l', 'l', 'o', 0, 0x05, 0x01};
+    transport.write(garbage, sizeof(garbage));
+    transport.write(encoded, len);
+    check(client.get_info(info), "recovers after garbage and a corrupted frame");
+    check(server.get_error_count() == errors_before + 3, "malformed frames counted");
+
+    bad.length = 3;
+    len = Remote_Protocol::encode(bad, encoded);
+    transport.write(encoded, len);
+    uint8_t reply[64];
+    int n = transport.read(reply, sizeof(reply), 500);
+    Remote_Protocol::Frame_Decoder decoder;
+    bool got_bad_length = false;
+    for(int i = 0; i < n; i++)
+        if(decoder.feed(reply[i])) got_bad_length = decoder.get_message().payload[0] == Remote_Protocol::STATUS_BAD_LENGTH;
+    check(got_bad_length, "wrong payload length rejected");
+
+    //long payload with zeros in it survives the COBS round trip
+    Remote_Protocol::Message big;
+    big.command = 0x7F;
+    big.sequence = 0;
+    for(size_t i = 0; i < Remote_Protocol::MAX_PAYLOAD; i++) big.payload[i] = (i % 3 == 0) ? 0 : i;
+    big.length = Remote_Protocol::MAX_PAYLOAD;
+    len = Remote_Protocol::encode(big, encoded);
+    Remote_Protocol::Frame_Decoder loop_decoder;
+    bool round_trip = false;
+    for(size_t i = 0; i < len; i++) {
+        if(loop_decoder.feed(encoded[i])) {
+            const Remote_Protocol::Message& m = loop_decoder.get_message();
+            round_trip = m.length == big.length && std::equal(big.payload.begin(), big.payload.begin() + big.length, m.payload.begin());
+        }
+    }
+    check(round_trip, "COBS round trip of a full payload");
+
+    //the firmware's capture stream shares the port --> a response right behind a capture frame still has to decode
+    //capture frames end in sample and CRC bytes that are mostly non-zero, so this only works because responses lead with a zero
+    std::array<int16_t, Capture_Frame::MAX_SAMPLES> samples;
+    std::array<uint8_t, Capture_Frame::MAX_FRAME_BYTES> capture;
+    Remote_Protocol::Message stop_reply;
+    stop_reply.command = Remote_Protocol::CMD_CAPTURE_STOP | Remote_Protocol::RESPONSE_FLAG;
+    stop_reply.length = 1;
+    stop_reply.payload[0] = Remote_Protocol::STATUS_OK;
+    static constexpr size_t CAPTURE_TRIALS = 1000;
+    size_t decoded = 0;
+    for(size_t trial = 0; trial < CAPTURE_TRIALS; trial++) {
+        for(size_t i = 0; i < samples.size(); i++) samples[i] = (int16_t)((trial * 7919 + i * 104729) & 0xFFFF);
+        Capture_Frame::Info frame_info = {(uint32_t)trial, Sim_Target::NUM_SLOTS, 0, (uint16_t)samples.size()};
+        size_t capture_len = Capture_Frame::write(capture.data(), frame_info, samples.data());
+
+        stop_reply.sequence = trial;
+        len = Remote_Protocol::encode(stop_reply, encoded);
+        Remote_Protocol::Frame_Decoder capture_decoder;
+        for(size_t i = 0; i < capture_len; i++) capture_decoder.feed(capture[i]);
+        for(size_t i = 0; i < len; i++) {
+            if(capture_decoder.feed(encoded[i]) && capture_decoder.get_message().sequence == stop_reply.sequence) decoded++;
+        }
+    }
+    check(decoded == CAPTURE_TRIALS, "responses decode right behind capture frames");
+
+    //same thing end to end: capture frame lands on the wire just before the server answers a stop
+    check(client.start_capture(Sim_Target::NUM_SLOTS), "start capture for streaming");
+    Capture_Frame::Info frame_info = {0, Sim_Target::NUM_SLOTS, 0, (uint16_t)samples.size()};
+    size_t capture_len = Capture_Frame::write(capture.data(), frame_info, samples.data());
+    check(write(fds[1], capture.data(), capture_len) == (ssize_t)capture_len && client.stop_capture() && !target.capturing,
+            "stop capture with a capture frame in front of the response");
+
+    stop = true;
+    server_thread.join();
+    close(fds[0]);
+    close(fds[1]);
+
+    printf("%s (%d failure%s)\n", failures ? "FAILED" : "PASSED", failures, failures == 1 ? "" : "s");
+    return failures ? 1 : 0;
+}
+
+//=========================== MAIN =========================
+
+int main(int argc, char** argv) {
+    if(argc > 1 && strcmp(argv[1], "--self-test") == 0) return self_test();
+    if(argc > 1) {
+        fprintf(stderr, "usage: remote_sim [--self-test]\n");
+        return 1;
+    }
+
+    //pseudo-terminal, raw so nothing gets translated
+    int master = posix_openpt(O_RDWR | O_NOCTTY);
+    if(master < 0 || grantpt(master) != 0 || unlockpt(master) != 0) {
+        perror("posix_openpt");
+        return 1;
+    }
+    termios tty;
+    if(tcgetattr(master, &tty) == 0) {
+        cfmakeraw(&tty);
+        tcsetattr(master, TCSANOW, &tty);
+    }
+    printf("Simulated pedal listening on %s\n", ptsname(master));
+    fflush(stdout);
+
+    Sim_Target target;
+    Remote_Server server(target);
+    volatile bool stop = false;
+    serve(master, server, stop);
+    return 0;
+}